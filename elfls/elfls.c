@@ -10,6 +10,10 @@
 #include <errno.h>
 #include <unistd.h>
 #include <getopt.h>
+#include <fcntl.h>
+#include <ar.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
 #include <elf.h>
 
 #include "elfrw.h"
@@ -23,6 +27,15 @@
  */
 #define nomem() (fputs("Out of memory!\n", stderr), exit(EXIT_FAILURE))
 
+/* The most bytes of a file area that will be examined for a string.
+ */
+#define	MAXSTRING	4096
+
+/* The number of entries of a note's descriptor that are read from the
+ * file at one time.
+ */
+#define	NOTECHUNK	64
+
 /* Structure used to organize strings to be displayed in a list.
  */
 typedef	struct textline {
@@ -31,18 +44,73 @@ typedef	struct textline {
     int		left;	/* how much more the string can grow */
 } textline;
 
+/* The available output formats.
+ */
+enum { FMT_TEXT = 0, FMT_JSONL, FMT_CSV };
+
+/* Flags indicating which fields of a record are present.
+ */
+#define	RF_INDEX	0x0001
+#define	RF_TYPE		0x0002
+#define	RF_FLAGS	0x0004
+#define	RF_OFFSET	0x0008
+#define	RF_SIZE		0x0010
+#define	RF_ADDR		0x0020
+#define	RF_MEMSZ	0x0040
+#define	RF_LINK		0x0080
+#define	RF_INFO		0x0100
+#define	RF_NAME		0x0200
+#define	RF_HASH		0x0400
+
+/* Structure used to hold one entry of the machine-readable output.
+ * Each record is written out as soon as it is filled in.
+ */
+typedef struct record {
+    char const *kind;		/* what the record describes */
+    unsigned	fields;		/* which of the fields below are present */
+    unsigned long index;	/* the entry's index within its table */
+    char const *type;		/* the entry's type */
+    char const *flags;		/* the entry's permission flags */
+    unsigned long offset;	/* the entry's position within the file */
+    unsigned long size;		/* the entry's size within the file */
+    unsigned long addr;		/* the entry's memory address */
+    unsigned long memsz;	/* the entry's size in memory */
+    unsigned long link;		/* the entry's link field */
+    unsigned long info;		/* the entry's info field */
+    char const *name;		/* the entry's name or contents */
+    unsigned long long hash;	/* the fingerprint of the entry's contents */
+} record;
+
+/* Structure used to remember the fingerprint of a section's contents
+ * until all of the files have been examined.
+ */
+typedef struct fingerprint {
+    unsigned long long hash;	/* the fingerprint of the contents */
+    unsigned long size;		/* the size of the contents */
+    char const *filename;	/* the file containing the contents */
+    char       *name;		/* the name of the section */
+} fingerprint;
+
 /* The online help text.
  */
 static char const *yowzitch = 
     "Usage: elfls [OPTIONS] FILE...\n"
+    "       elfls -L INDEX BUILDID...\n"
     "Display information about the contents of ELF files.\n\n"
     "  -c, --sources       Display list of source files.\n"
     "  -d, --dependencies  Display list of dependencies.\n"
     "  -P, --nophdr        Omit the program header table.\n"
     "  -S, --noshdr        Omit the section header table.\n"
+    "  -N, --nonotes       Omit the contents of core file notes.\n"
     "  -i, --nostr         Don't display some section contents.\n"
     "  -p, --nopos         Omit file position column.\n"
     "  -w, --width=N       Set maximum width of output.\n"
+    "  -f, --format=FMT    Set output format: text, jsonl, or csv.\n"
+    "  -x, --hash          Display a fingerprint of each entry's contents.\n"
+    "  -g, --group         List sections with identical contents.\n"
+    "  -B, --build-id-index=INDEX\n"
+    "                      Write the files' build IDs to INDEX.\n"
+    "  -L, --lookup=INDEX  Find the files with the given build IDs.\n"
     "      --help          Display this help and exit.\n"
     "      --version       Display version information and exit.\n";
 
@@ -70,18 +138,30 @@ static Elf64_Shdr      *shshstr = NULL;	/* sh with the sh string table */
 static char const      *programname;	/* name of this program */
 static char const      *thefilename;	/* name of current file */
 static FILE	       *thefile;	/* handle to current file */
+static unsigned char const *theimage;	/* mapped contents of current file */
+static unsigned long	theimagesize;	/* size of the mapped contents */
 
 static int		phdrls = TRUE;	/* TRUE = show ph table */
 static int		shdrls = TRUE;	/* TRUE = show sh table */
+static int		notels = TRUE;	/* TRUE = show core notes */
 static int		srcfls = FALSE;	/* TRUE = show source files */
 static int		ldepls = FALSE;	/* TRUE = show libraries */
 static int		dostrs = TRUE;	/* TRUE = show entry strings */
 static int		dooffs = TRUE;	/* TRUE = show file offsets */
+static int		dohash = FALSE;	/* TRUE = show content hashes */
+static int		dogroup = FALSE; /* TRUE = show identical sections */
+static char const      *idindex = NULL;	/* build ID index to create */
+static char const      *idlookup = NULL; /* build ID index to search */
+
+static fingerprint     *prints = NULL;	/* remembered section fingerprints */
+static int		printcount = 0;	/* number of entries in prints */
+static int		printsalloc = 0; /* allocated size of prints */
 
 static char		sizefmt[8];	/* num digits to show sizes */
 static char		addrfmt[8];	/* num digits to show addresses */
 static char		offsetfmt[8];	/* num digits to show offsets */
 static int		outwidth;	/* maximum width of output */
+static int		outformat = FMT_TEXT;	/* the output format */
 
 /* The error-reporting function.
  */
@@ -151,11 +231,24 @@ static int append(textline *line, char const *fmt, ...)
     return line->left;
 }
 
+/* Make a textline array holding a copy of each string in a list.
+ */
+static textline *getnamelines(char const **names, int count)
+{
+    textline   *lines;
+    int		i;
+
+    lines = gettextlines(count);
+    for (i = 0 ; i < count ; ++i)
+	append(lines + i, "%s", names[i]);
+    return lines;
+}
+
 /* Function to pass to qsort().
  */
-static int linesorter(const void *i1, const void *i2)
+static int namesorter(const void *i1, const void *i2)
 {
-    return strcmp(((textline*)i1)->str, ((textline*)i2)->str);
+    return strcmp(*(char const**)i1, *(char const**)i2);
 }
 
 /* Output the given textline array strings to a stream, nicely
@@ -218,6 +311,190 @@ static void outputlist(FILE *fp, textline *lines, int count,
     fputc('\n', fp);
 }
 
+/*
+ * Record output functions.
+ */
+
+/* Return the length of the UTF-8 sequence at the start of a string,
+ * or zero if it is not a valid multibyte sequence.
+ */
+static int utf8len(unsigned char const *p)
+{
+    unsigned long c;
+    int n, i;
+
+    if (*p >= 0xC2 && *p <= 0xDF) {
+	n = 2;
+	c = *p & 0x1F;
+    } else if (*p >= 0xE0 && *p <= 0xEF) {
+	n = 3;
+	c = *p & 0x0F;
+    } else if (*p >= 0xF0 && *p <= 0xF4) {
+	n = 4;
+	c = *p & 0x07;
+    } else {
+	return 0;
+    }
+    for (i = 1 ; i < n ; ++i) {
+	if ((p[i] & 0xC0) != 0x80)
+	    return 0;
+	c = (c << 6) | (p[i] & 0x3F);
+    }
+    if ((n == 3 && c < 0x800) || (n == 4 && (c < 0x10000 || c > 0x10FFFF))
+			      || (c >= 0xD800 && c <= 0xDFFF))
+	return 0;
+    return n;
+}
+
+/* Output a string as a JSON string literal. Valid UTF-8 sequences
+ * are copied unchanged. Control characters, quotes and backslashes
+ * are escaped, as are any bytes that are not part of a valid UTF-8
+ * sequence, so that the output is valid JSON regardless of the
+ * file's contents.
+ */
+static void putjsonstr(FILE *fp, char const *str)
+{
+    unsigned char const *p;
+    int n;
+
+    putc('"', fp);
+    for (p = (unsigned char const*)str ; *p ; ++p) {
+	if (*p == '"' || *p == '\\') {
+	    putc('\\', fp);
+	    putc(*p, fp);
+	} else if (*p < ' ' || *p == 0x7F) {
+	    fprintf(fp, "\\u%04X", *p);
+	} else if (*p < 0x80) {
+	    putc(*p, fp);
+	} else if ((n = utf8len(p))) {
+	    fwrite(p, 1, n, fp);
+	    p += n - 1;
+	} else {
+	    fprintf(fp, "\\u%04X", *p);
+	}
+    }
+    putc('"', fp);
+}
+
+/* Output a string as a CSV field, quoting it only if necessary.
+ */
+static void putcsvstr(FILE *fp, char const *str)
+{
+    if (!str[strcspn(str, ",\"\r\n")]) {
+	fputs(str, fp);
+	return;
+    }
+    putc('"', fp);
+    for ( ; *str ; ++str) {
+	if (*str == '"')
+	    putc('"', fp);
+	putc(*str, fp);
+    }
+    putc('"', fp);
+}
+
+/* Output the column names of the CSV format.
+ */
+static void outputcsvheader(FILE *fp)
+{
+    fputs("file,kind,index,type,flags,offset,size,addr,memsz,link,info,name,"
+	  "hash\n", fp);
+}
+
+/* Output one record as a JSON object on a line by itself. Only the
+ * fields that are present are included.
+ */
+static void outputjsonrecord(FILE *fp, record const *rec)
+{
+    fputs("{\"file\":", fp);
+    putjsonstr(fp, thefilename);
+    fputs(",\"kind\":", fp);
+    putjsonstr(fp, rec->kind);
+    if (rec->fields & RF_INDEX)
+	fprintf(fp, ",\"index\":%lu", rec->index);
+    if (rec->fields & RF_TYPE) {
+	fputs(",\"type\":", fp);
+	putjsonstr(fp, rec->type);
+    }
+    if (rec->fields & RF_FLAGS) {
+	fputs(",\"flags\":", fp);
+	putjsonstr(fp, rec->flags);
+    }
+    if (rec->fields & RF_OFFSET)
+	fprintf(fp, ",\"offset\":%lu", rec->offset);
+    if (rec->fields & RF_SIZE)
+	fprintf(fp, ",\"size\":%lu", rec->size);
+    if (rec->fields & RF_ADDR)
+	fprintf(fp, ",\"addr\":%lu", rec->addr);
+    if (rec->fields & RF_MEMSZ)
+	fprintf(fp, ",\"memsz\":%lu", rec->memsz);
+    if (rec->fields & RF_LINK)
+	fprintf(fp, ",\"link\":%lu", rec->link);
+    if (rec->fields & RF_INFO)
+	fprintf(fp, ",\"info\":%lu", rec->info);
+    if (rec->fields & RF_NAME) {
+	fputs(",\"name\":", fp);
+	putjsonstr(fp, rec->name);
+    }
+    if (rec->fields & RF_HASH)
+	fprintf(fp, ",\"hash\":\"%016llX\"", rec->hash);
+    fputs("}\n", fp);
+}
+
+/* Output one record as a line of comma-separated values. Fields that
+ * are not present are left empty.
+ */
+static void outputcsvrecord(FILE *fp, record const *rec)
+{
+    putcsvstr(fp, thefilename);
+    putc(',', fp);
+    fputs(rec->kind, fp);
+    putc(',', fp);
+    if (rec->fields & RF_INDEX)
+	fprintf(fp, "%lu", rec->index);
+    putc(',', fp);
+    if (rec->fields & RF_TYPE)
+	putcsvstr(fp, rec->type);
+    putc(',', fp);
+    if (rec->fields & RF_FLAGS)
+	putcsvstr(fp, rec->flags);
+    putc(',', fp);
+    if (rec->fields & RF_OFFSET)
+	fprintf(fp, "%lu", rec->offset);
+    putc(',', fp);
+    if (rec->fields & RF_SIZE)
+	fprintf(fp, "%lu", rec->size);
+    putc(',', fp);
+    if (rec->fields & RF_ADDR)
+	fprintf(fp, "%lu", rec->addr);
+    putc(',', fp);
+    if (rec->fields & RF_MEMSZ)
+	fprintf(fp, "%lu", rec->memsz);
+    putc(',', fp);
+    if (rec->fields & RF_LINK)
+	fprintf(fp, "%lu", rec->link);
+    putc(',', fp);
+    if (rec->fields & RF_INFO)
+	fprintf(fp, "%lu", rec->info);
+    putc(',', fp);
+    if (rec->fields & RF_NAME)
+	putcsvstr(fp, rec->name);
+    putc(',', fp);
+    if (rec->fields & RF_HASH)
+	fprintf(fp, "%016llX", rec->hash);
+    putc('\n', fp);
+}
+
+/* Output a record in the selected format.
+ */
+static void outputrecord(FILE *fp, record const *rec)
+{
+    if (outformat == FMT_JSONL)
+	outputjsonrecord(fp, rec);
+    else
+	outputcsvrecord(fp, rec);
+}
+
 /*
  * Generic file-reading functions.
  */
@@ -241,7 +518,8 @@ static void *getarea(long offset, unsigned long size)
 
 /* Read a null-terminated string from the current file, up to a given
  * size, into a static buffer. If skip is nonzero, then skip over NULs
- * at the beginning of the string.
+ * at the beginning of the string. No more than MAXSTRING bytes are
+ * ever examined, regardless of the size of the area.
  */
 static char const *getstring(unsigned long offset, unsigned long size,
 			     int skip)
@@ -253,6 +531,8 @@ static char const *getstring(unsigned long offset, unsigned long size,
 
     if (!size)
 	return "";
+    if (size > MAXSTRING)
+	size = MAXSTRING;
     if (size > buflen) {
 	if (!(buf = realloc(buf, size + 1)))
 	    nomem();
@@ -279,6 +559,251 @@ static char const *getstring(unsigned long offset, unsigned long size,
     return str;
 }
 
+/*
+ * Content fingerprinting functions.
+ */
+
+/* The constants used by the hash function.
+ */
+#define	PRIME64_1	0x9E3779B185EBCA87ULL
+#define	PRIME64_2	0xC2B2AE3D27D4EB4FULL
+#define	PRIME64_3	0x165667B19E3779F9ULL
+#define	PRIME64_4	0x85EBCA77C2B2AE63ULL
+#define	PRIME64_5	0x27D4EB2F165667C5ULL
+
+#define	rotl64(x, n)	(((x) << (n)) | ((x) >> (64 - (n))))
+
+/* Read little-endian words from an arbitrarily aligned address.
+ */
+static inline unsigned long long get64(unsigned char const *p)
+{
+    unsigned long long n;
+
+    memcpy(&n, p, sizeof n);
+#if defined __BYTE_ORDER__ && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    n = __builtin_bswap64(n);
+#endif
+    return n;
+}
+
+static inline unsigned long long get32(unsigned char const *p)
+{
+    unsigned int n;
+
+    memcpy(&n, p, sizeof n);
+#if defined __BYTE_ORDER__ && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    n = __builtin_bswap32(n);
+#endif
+    return n;
+}
+
+static inline unsigned long long hashround(unsigned long long acc,
+					   unsigned long long input)
+{
+    acc += input * PRIME64_2;
+    acc = rotl64(acc, 31);
+    return acc * PRIME64_1;
+}
+
+static inline unsigned long long hashmerge(unsigned long long acc,
+					   unsigned long long val)
+{
+    acc ^= hashround(0, val);
+    return acc * PRIME64_1 + PRIME64_4;
+}
+
+/* Compute a 64-bit fingerprint of a block of memory. This is the
+ * XXH64 algorithm: the bulk of the data is consumed 32 bytes at a
+ * time by four independent accumulators, which lets the processor
+ * keep several multiplies in flight at once, and so it can keep up
+ * with memory bandwidth.
+ */
+static unsigned long long hashbytes(unsigned char const *p,
+				    unsigned long size)
+{
+    unsigned char const *end = p + size;
+    unsigned long long v1, v2, v3, v4, h;
+
+    if (size >= 32) {
+	v1 = PRIME64_1 + PRIME64_2;
+	v2 = PRIME64_2;
+	v3 = 0;
+	v4 = -PRIME64_1;
+	do {
+	    v1 = hashround(v1, get64(p));
+	    v2 = hashround(v2, get64(p + 8));
+	    v3 = hashround(v3, get64(p + 16));
+	    v4 = hashround(v4, get64(p + 24));
+	    p += 32;
+	} while (p + 32 <= end);
+	h = rotl64(v1, 1) + rotl64(v2, 7) + rotl64(v3, 12) + rotl64(v4, 18);
+	h = hashmerge(h, v1);
+	h = hashmerge(h, v2);
+	h = hashmerge(h, v3);
+	h = hashmerge(h, v4);
+    } else {
+	h = PRIME64_5;
+    }
+    h += size;
+
+    for ( ; p + 8 <= end ; p += 8) {
+	h ^= hashround(0, get64(p));
+	h = rotl64(h, 27) * PRIME64_1 + PRIME64_4;
+    }
+    if (p + 4 <= end) {
+	h ^= get32(p) * PRIME64_1;
+	h = rotl64(h, 23) * PRIME64_2 + PRIME64_3;
+	p += 4;
+    }
+    for ( ; p < end ; ++p) {
+	h ^= *p * PRIME64_5;
+	h = rotl64(h, 11) * PRIME64_1;
+    }
+
+    h ^= h >> 33;
+    h *= PRIME64_2;
+    h ^= h >> 29;
+    h *= PRIME64_3;
+    h ^= h >> 32;
+    return h;
+}
+
+/* Compute the fingerprint of an area of the current file. FALSE is
+ * returned if the area is empty, if the file is not mapped into
+ * memory, or if the area lies outside of the file.
+ */
+static int getareahash(unsigned long offset, unsigned long size,
+		       unsigned long long *hash)
+{
+    if (!size || !theimage || offset > theimagesize
+			   || size > theimagesize - offset)
+	return FALSE;
+    *hash = hashbytes(theimage + offset, size);
+    return TRUE;
+}
+
+/* Remember the fingerprint of an entry in the current file, so that
+ * identical contents can be grouped together at the end.
+ */
+static void addfingerprint(unsigned long long hash, unsigned long size,
+			   char const *name)
+{
+    fingerprint *fp;
+
+    if (printcount == printsalloc) {
+	printsalloc = printsalloc ? 2 * printsalloc : 256;
+	if (!(prints = realloc(prints, printsalloc * sizeof *prints)))
+	    nomem();
+    }
+    fp = prints + printcount++;
+    fp->hash = hash;
+    fp->size = size;
+    fp->filename = thefilename;
+    if (!(fp->name = strdup(name)))
+	nomem();
+}
+
+/* Remember the fingerprints of the current file's sections, or of its
+ * segments if it has no section header table. Empty entries are
+ * ignored. Since the filename may not outlive the current file (as
+ * with archive members), a private copy of it is made.
+ */
+static void savefingerprints(void)
+{
+    unsigned long long hash;
+    char const *filename;
+    char	name[32];
+    int		first, i;
+
+    filename = thefilename;
+    if (!(thefilename = strdup(thefilename)))
+	nomem();
+    first = printcount;
+    if (secthdrs) {
+	for (i = 0 ; i < elffhdr.e_shnum ; ++i) {
+	    if (secthdr[i].sh_type == SHT_NOBITS)
+		continue;
+	    if (!getareahash(secthdr[i].sh_offset, secthdr[i].sh_size, &hash))
+		continue;
+	    if (!sectstr)
+		sprintf(name, "section %d", i);
+	    addfingerprint(hash, secthdr[i].sh_size,
+			   sectstr ? sectstr + secthdr[i].sh_name : name);
+	}
+    } else if (proghdrs) {
+	for (i = 0 ; i < elffhdr.e_phnum ; ++i) {
+	    if (!getareahash(proghdr[i].p_offset, proghdr[i].p_filesz, &hash))
+		continue;
+	    sprintf(name, "segment %d", i);
+	    addfingerprint(hash, proghdr[i].p_filesz, name);
+	}
+    }
+    if (printcount == first)
+	free((void*)thefilename);
+    thefilename = filename;
+}
+
+/* Function to pass to qsort() to sort the fingerprints so that
+ * identical contents are adjacent, and the largest contents come
+ * first.
+ */
+static int printsorter(void const *a, void const *b)
+{
+    fingerprint const *fa = a;
+    fingerprint const *fb = b;
+
+    if (fa->size != fb->size)
+	return fa->size < fb->size ? 1 : -1;
+    if (fa->hash != fb->hash)
+	return fa->hash < fb->hash ? -1 : 1;
+    return 0;
+}
+
+/* Display each set of sections that have identical contents, along
+ * with the total number of bytes that are duplicated.
+ */
+static void outputgroups(FILE *fp)
+{
+    record		rec;
+    unsigned long	total = 0;
+    int			groups = 0;
+    int			i, j, n;
+
+    qsort(prints, printcount, sizeof *prints, printsorter);
+    for (i = 0 ; i < printcount ; i = j) {
+	for (j = i + 1 ; j < printcount ; ++j)
+	    if (prints[j].hash != prints[i].hash
+				|| prints[j].size != prints[i].size)
+		break;
+	if ((n = j - i) < 2)
+	    continue;
+	total += (n - 1) * prints[i].size;
+	if (outformat == FMT_TEXT) {
+	    if (!groups)
+		fputs("Identical contents:\n", fp);
+	    fprintf(fp, "%016llX %lX bytes, %d copies\n",
+		    prints[i].hash, prints[i].size, n);
+	    for ( ; i < j ; ++i)
+		fprintf(fp, "    %s %s\n", prints[i].filename, prints[i].name);
+	} else {
+	    rec.kind = "duplicate";
+	    rec.fields = RF_INDEX | RF_SIZE | RF_INFO | RF_NAME | RF_HASH;
+	    rec.index = groups;
+	    rec.size = prints[i].size;
+	    rec.info = n;
+	    rec.hash = prints[i].hash;
+	    for ( ; i < j ; ++i) {
+		thefilename = prints[i].filename;
+		rec.name = prints[i].name;
+		outputrecord(fp, &rec);
+	    }
+	}
+	++groups;
+    }
+    if (outformat == FMT_TEXT && groups)
+	fprintf(fp, "%d groups, %lX bytes duplicated\n", groups, total);
+}
+
 /*
  * Functions for examining ELF structures.
  */
@@ -422,13 +947,15 @@ static int readsecthdrs(void)
 
 /* Extract the list of source files, if present. The source files are
  * determined by loading the symbol table section (and its associated
- * string table) and looking up symbols of type STT_FILE.
+ * string table) and looking up symbols of type STT_FILE. The names
+ * are returned as pointers into the string table, which is returned
+ * in pstrs; the caller frees both.
  */
-static int getsrcfiles(textline **plines)
+static int getsrcfiles(char const ***pnames, char **pstrs)
 {
     Elf64_Sym  *syms;
     char       *nmstr;
-    textline   *lines;
+    char const **names;
     char       *str;
     unsigned	strtab, count, i;
     int		j, n;
@@ -455,24 +982,27 @@ static int getsrcfiles(textline **plines)
 	free(syms);
 	return 0;
     }
-    lines = gettextlines(count);
+    if (!(names = malloc(count * sizeof *names)))
+	nomem();
     n = 0;
     for (i = 0 ; i < count ; ++i) {
 	if (ELF64_ST_TYPE(syms[i].st_info) != STT_FILE)
 	    continue;
 	str = nmstr + syms[i].st_name;
 	for (j = 0 ; j < n ; ++j)
-	    if (!strcmp(lines[j].str, str))
+	    if (!strcmp(names[j], str))
 		break;
 	if (j == n)
-	    append(lines + n++, "%s", str);
+	    names[n++] = str;
     }
     free(syms);
-    free(nmstr);
-    if (n)
-	*plines = lines;
-    else
-	free(lines);
+    if (n) {
+	*pnames = names;
+	*pstrs = nmstr;
+    } else {
+	free(names);
+	free(nmstr);
+    }
     return n;
 }
 
@@ -484,11 +1014,11 @@ static int getsrcfiles(textline **plines)
  * the program header table needs to be searched again to find the
  * part that will be loaded at that location.
  */
-static int getlibraries(textline **plines)
+static int getlibraries(char const ***pnames, char **pstrs)
 {
     Elf64_Dyn  *dyns;
     char       *nmstr;
-    textline   *lines;
+    char const **names;
     char       *str;
     unsigned long strtab = 0, strsz = 0;
     unsigned	count, i, j, n;
@@ -529,27 +1059,67 @@ static int getlibraries(textline **plines)
     if (!(nmstr = getarea(proghdr[i].p_offset + (strtab - proghdr[i].p_vaddr),
 			  strsz)))
 	return 0;
-    lines = gettextlines(n);
+    if (!(names = malloc((n ? n : 1) * sizeof *names)))
+	nomem();
     n = 0;
     for (i = 0 ; i < count ; ++i) {
 	if (dyns[i].d_tag != DT_NEEDED)
 	    continue;
 	str = nmstr + dyns[i].d_un.d_val;
 	for (j = 0 ; j < n ; ++j)
-	    if (!strcmp(lines[j].str, str))
+	    if (!strcmp(names[j], str))
 		break;
 	if (j == n)
-	    append(lines + n++, "%s", str);
+	    names[n++] = str;
     }
     free(dyns);
-    free(nmstr);
-    if (n)
-	*plines = lines;
-    else
-	free(lines);
+    if (n) {
+	*pnames = names;
+	*pstrs = nmstr;
+    } else {
+	free(names);
+	free(nmstr);
+    }
     return n;
 }
 
+/* Iterate over the notes in an area of the current file, calling fn
+ * once for each note with its type and owner name, and the location
+ * and size of its descriptor. Only the note headers and names are
+ * read here; it is left up to fn to read as much of the descriptor
+ * as it needs. Note names longer than the buffer are truncated.
+ */
+static void walknotes(FILE *fp, unsigned long offset, unsigned long size,
+		      unsigned long align,
+		      void (*fn)(FILE*, Elf64_Word, char const*,
+				 unsigned long, unsigned long))
+{
+    char		name[32];
+    Elf64_Word		namesz, descsz, type;
+    unsigned long	pos, end, descoff;
+    unsigned long	n;
+
+    if (align != 8)
+	align = 4;
+    end = offset + size;
+    for (pos = offset ; pos + 12 <= end ; ) {
+	if (fseek(thefile, pos, SEEK_SET)
+			|| elfrw_read_Word(thefile, &namesz) != 1
+			|| elfrw_read_Word(thefile, &descsz) != 1
+			|| elfrw_read_Word(thefile, &type) != 1)
+	    return;
+	descoff = pos + 12 + ((namesz + align - 1) & ~(align - 1));
+	if (descoff > end || descsz > end - descoff)
+	    return;
+	n = namesz < sizeof name ? namesz : sizeof name - 1;
+	if (n && fread(name, n, 1, thefile) != 1)
+	    return;
+	name[n] = '\0';
+	fn(fp, type, name, descoff, descsz);
+	pos = descoff + ((descsz + align - 1) & ~(align - 1));
+    }
+}
+
 /*
  * Output-generating functions.
  */
@@ -594,10 +1164,36 @@ static void makenumberfmts(void)
     sprintf(addrfmt, "%%0%dlX", i);
 }
 
+/* Return a short name for the current file's machine type, or NULL
+ * if the machine type is not recognized.
+ */
+static char const *machinename(void)
+{
+    switch (elffhdr.e_machine) {
+      case EM_M32:	return "AT&T M32";
+      case EM_386:	return "Intel 386";
+      case EM_X86_64:	return "Intel x86-64";
+      case EM_860:	return "Intel 860";
+      case EM_MIPS:	return "MIPS";
+      case EM_68K:	return "Motorola 68k";
+      case EM_88K:	return "Motorola 88k";
+      case EM_SPARC:	return "SPARC";
+      case EM_S390:	return "IBM S390";
+      case EM_ALPHA:	return "Digital Alpha";
+      case EM_ARM:	return "ARM";
+      case EM_PARISC:	return "HPPA";
+      case EM_PPC:	return "PowerPC";
+      case EM_PPC64:	return "64-bit PowerPC";
+    }
+    return NULL;
+}
+
 /* Display a one-line description of the ELF file.
  */
 static void describeehdr(FILE *fp)
 {
+    char const *str;
+
     fprintf(fp, "%s", thefilename);
 
     switch (elffhdr.e_type) {
@@ -608,23 +1204,10 @@ static void describeehdr(FILE *fp)
       default:		fprintf(fp, "?(%u)", elffhdr.e_type);	break;
     }
 
-    switch (elffhdr.e_machine) {
-      case EM_M32:	fprintf(fp, " (AT&T M32)");		break;
-      case EM_386:	fprintf(fp, " (Intel 386)");		break;
-      case EM_X86_64:	fprintf(fp, " (Intel x86-64)");		break;
-      case EM_860:	fprintf(fp, " (Intel 860)");		break;
-      case EM_MIPS:	fprintf(fp, " (MIPS)");			break;
-      case EM_68K:	fprintf(fp, " (Motorola 68k)");		break;
-      case EM_88K:	fprintf(fp, " (Motorola 88k)");		break;
-      case EM_SPARC:	fprintf(fp, " (SPARC)");		break;
-      case EM_S390:	fprintf(fp, " (IBM S390)");		break;
-      case EM_ALPHA:	fprintf(fp, " (Digital Alpha)");	break;
-      case EM_ARM:	fprintf(fp, " (ARM)");			break;
-      case EM_PARISC:	fprintf(fp, " (HPPA)");			break;
-      case EM_PPC:	fprintf(fp, " (PowerPC)");		break;
-      case EM_PPC64:	fprintf(fp, " (64-bit PowerPC)");	break;
-      default:		fprintf(fp, " (?%u)", elffhdr.e_machine); break;
-    }
+    if ((str = machinename()))
+	fprintf(fp, " (%s)", str);
+    else
+	fprintf(fp, " (?%u)", elffhdr.e_machine);
 
     fputc('\n', fp);
 }
@@ -820,143 +1403,1304 @@ static void describeshdr(textline *line, Elf64_Shdr *shdr)
 }
 
 /*
- * Top-level functions.
+ * Record-generating functions.
  */
 
-/* Parse the command-line options.
+/* Return the name of a type value, as given in the ELF standard minus
+ * the prefix. Unrecognized values are returned as a hex number.
  */
-static void readoptions(int argc, char *argv[])
+static char const *typename(unsigned long type, char const *str)
 {
-    static char const *optstring = "cdiPpSw:";
-    static struct option const options[] = {
-	{ "sources", no_argument, NULL, 'c' },
-	{ "dependencies", no_argument, NULL, 'd' },
-	{ "nophdr", no_argument, NULL, 'P' },
-	{ "noshdr", no_argument, NULL, 'S' },
-	{ "nostr", no_argument, NULL, 'i' },
-	{ "nopos", no_argument, NULL, 'p' },
-	{ "width", required_argument, NULL, 'w' },
-	{ "help", no_argument, NULL, 'H' },
-	{ "version", no_argument, NULL, 'V' },
-	{ 0, 0, 0, 0 }
-    };
+    static char	buf[24];
 
-    char const *str;
-    int n;
+    if (str)
+	return str;
+    sprintf(buf, "0x%lX", type);
+    return buf;
+}
 
-    programname = argv[0];
-    if (argc == 1) {
-	fputs(yowzitch, stdout);
-	exit(EXIT_SUCCESS);
+static char const *elftypename(unsigned type)
+{
+    switch (type) {
+      case ET_REL:		return "REL";
+      case ET_EXEC:		return "EXEC";
+      case ET_DYN:		return "DYN";
+      case ET_CORE:		return "CORE";
     }
+    return typename(type, NULL);
+}
 
-    if (!(str = getenv("COLUMNS")) || (outwidth = atoi(str)) <= 0)
-	outwidth = 80;
-
-    while ((n = getopt_long(argc, argv, optstring, options, NULL)) != EOF) {
-	switch (n) {
-	  case 'c':	srcfls = TRUE;			break;
-	  case 'd':	ldepls = TRUE;			break;
-	  case 'P':	phdrls = FALSE;			break;
-	  case 'S':	shdrls = FALSE;			break;
-	  case 'i':	dostrs = FALSE;			break;
-	  case 'p':	dooffs = FALSE;			break;
-	  case 'w':	outwidth = atoi(optarg);	break;
-	  case 'H':	fputs(yowzitch, stdout);	exit(EXIT_SUCCESS);
-	  case 'V':	fputs(vourzhon, stdout);	exit(EXIT_SUCCESS);
-	  default:
-	    fprintf(stderr, "Try --help for more information.\n");
-	    exit(EXIT_FAILURE);
-	}
+static char const *phdrtypename(unsigned long type)
+{
+    switch (type) {
+      case PT_NULL:		return "NULL";
+      case PT_LOAD:		return "LOAD";
+      case PT_DYNAMIC:		return "DYNAMIC";
+      case PT_INTERP:		return "INTERP";
+      case PT_NOTE:		return "NOTE";
+      case PT_SHLIB:		return "SHLIB";
+      case PT_PHDR:		return "PHDR";
+      case PT_TLS:		return "TLS";
+#ifdef PT_GNU_EH_FRAME
+      case PT_GNU_EH_FRAME:	return "GNU_EH_FRAME";
+#endif
+#ifdef PT_GNU_STACK
+      case PT_GNU_STACK:	return "GNU_STACK";
+#endif
+#ifdef PT_GNU_RELRO
+      case PT_GNU_RELRO:	return "GNU_RELRO";
+#endif
     }
-    if (outwidth < 0) {
-	err("invalid width parameter.");
-	exit(EXIT_FAILURE);
+    return typename(type, NULL);
+}
+
+static char const *shdrtypename(unsigned long type)
+{
+    switch (type) {
+      case SHT_NULL:		return "NULL";
+      case SHT_PROGBITS:	return "PROGBITS";
+      case SHT_SYMTAB:		return "SYMTAB";
+      case SHT_STRTAB:		return "STRTAB";
+      case SHT_RELA:		return "RELA";
+      case SHT_HASH:		return "HASH";
+      case SHT_DYNAMIC:		return "DYNAMIC";
+      case SHT_NOTE:		return "NOTE";
+      case SHT_NOBITS:		return "NOBITS";
+      case SHT_REL:		return "REL";
+      case SHT_SHLIB:		return "SHLIB";
+      case SHT_DYNSYM:		return "DYNSYM";
+      case SHT_INIT_ARRAY:	return "INIT_ARRAY";
+      case SHT_FINI_ARRAY:	return "FINI_ARRAY";
+      case SHT_PREINIT_ARRAY:	return "PREINIT_ARRAY";
+      case SHT_GROUP:		return "GROUP";
+      case SHT_SYMTAB_SHNDX:	return "SYMTAB_SHNDX";
+#ifdef SHT_GNU_HASH
+      case SHT_GNU_HASH:	return "GNU_HASH";
+#endif
+#ifdef SHT_GNU_verdef
+      case SHT_GNU_verdef:	return "GNU_verdef";
+      case SHT_GNU_verneed:	return "GNU_verneed";
+      case SHT_GNU_versym:	return "GNU_versym";
+#endif
     }
+    return typename(type, NULL);
 }
 
-/* main().
+/* Output a record describing the file as a whole.
  */
-int main(int argc, char *argv[])
+static void recordehdr(FILE *fp)
 {
-    textline   *lines = NULL;
-    char      **arg;
-    int		ret = 0;
-    int		count, i;
-
-    readoptions(argc, argv);
-    if (optind == argc) {
-	err("nothing to do.");
-	exit(EXIT_FAILURE);
+    record	rec;
+
+    rec.kind = "file";
+    rec.fields = RF_TYPE | RF_NAME;
+    rec.type = elftypename(elffhdr.e_type);
+    rec.name = machinename();
+    if (!rec.name)
+	rec.name = typename(elffhdr.e_machine, NULL);
+    if (elffhdr.e_entry) {
+	rec.fields |= RF_ADDR;
+	rec.addr = elffhdr.e_entry;
     }
+    outputrecord(fp, &rec);
+}
 
-    for (arg = argv + optind ; (thefilename = *arg) != NULL ; ++arg) {
-	if (!(thefile = fopen(thefilename, "rb"))) {
-	    perror(thefilename);
-	    ++ret;
-	    continue;
-	}
-	if (!readelfhdr() || !readproghdrs() || !readsecthdrs()) {
-	    fclose(thefile);
-	    ++ret;
-	    continue;
-	}
+/* Output a record for each entry in the program header table. The
+ * contents of the interpreter entry are included if present.
+ */
+static void recordphdrs(FILE *fp)
+{
+    Elf64_Phdr *phdr;
+    record	rec;
+    char	flags[4];
+    int		i;
 
-	describeehdr(stdout);
-	if (ldepls && proghdrs) {
-	    if ((count = getlibraries(&lines))) {
-		outputlist(stdout, lines, count, "Dependencies: ");
-		free(lines);
-	    }
+    rec.kind = "segment";
+    rec.flags = flags;
+    flags[3] = '\0';
+    for (i = 0, phdr = proghdr ; i < elffhdr.e_phnum ; ++i, ++phdr) {
+	rec.fields = RF_INDEX | RF_TYPE | RF_FLAGS | RF_OFFSET | RF_SIZE
+				       | RF_ADDR | RF_MEMSZ;
+	rec.index = i;
+	rec.type = phdrtypename(phdr->p_type);
+	flags[0] = phdr->p_flags & PF_R ? 'r' : '-';
+	flags[1] = phdr->p_flags & PF_W ? 'w' : '-';
+	flags[2] = phdr->p_flags & PF_X ? phdr == phentry ? 's' : 'x' : '-';
+	rec.offset = phdr->p_offset;
+	rec.size = phdr->p_filesz;
+	rec.addr = phdr->p_vaddr;
+	rec.memsz = phdr->p_memsz;
+	if (dostrs && phdr->p_type == PT_INTERP) {
+	    rec.name = getstring(phdr->p_offset, phdr->p_filesz, FALSE);
+	    if (*rec.name)
+		rec.fields |= RF_NAME;
 	}
-	if (srcfls && secthdrs) {
-	    if ((count = getsrcfiles(&lines))) {
-		qsort(lines, count, sizeof *lines, linesorter);
-		outputlist(stdout, lines, count, "Source files: ");
-		free(lines);
+	if (dohash && getareahash(phdr->p_offset, phdr->p_filesz, &rec.hash))
+	    rec.fields |= RF_HASH;
+	outputrecord(fp, &rec);
+    }
+}
+
+/* Output a record for each entry in the section header table.
+ */
+static void recordshdrs(FILE *fp)
+{
+    Elf64_Shdr *shdr;
+    record	rec;
+    char	flags[4];
+    int		i;
+
+    rec.kind = "section";
+    rec.flags = flags;
+    flags[3] = '\0';
+    for (i = 0, shdr = secthdr ; i < elffhdr.e_shnum ; ++i, ++shdr) {
+	rec.fields = RF_INDEX | RF_TYPE | RF_FLAGS | RF_OFFSET | RF_SIZE
+				       | RF_ADDR | RF_LINK | RF_INFO;
+	rec.index = i;
+	rec.type = shdrtypename(shdr->sh_type);
+	flags[0] = shdr->sh_flags & SHF_ALLOC ? 'r' : '-';
+	flags[1] = shdr->sh_flags & SHF_WRITE ? 'w' : '-';
+	flags[2] = shdr->sh_flags & SHF_EXECINSTR ? 'x' : '-';
+	rec.offset = shdr->sh_offset;
+	rec.size = shdr->sh_size;
+	rec.addr = shdr->sh_addr;
+	rec.link = shdr->sh_link;
+	rec.info = shdr->sh_info;
+	if (sectstr) {
+	    rec.fields |= RF_NAME;
+	    rec.name = sectstr + shdr->sh_name;
+	}
+	if (dohash && shdr->sh_type != SHT_NOBITS
+		   && getareahash(shdr->sh_offset, shdr->sh_size, &rec.hash))
+	    rec.fields |= RF_HASH;
+	outputrecord(fp, &rec);
+    }
+}
+
+/* Output a record for each string in a list.
+ */
+static void recordlist(FILE *fp, char const **names, int count,
+		       char const *kind)
+{
+    record	rec;
+    int		i;
+
+    rec.kind = kind;
+    rec.fields = RF_INDEX | RF_NAME;
+    for (i = 0 ; i < count ; ++i) {
+	rec.index = i;
+	rec.name = names[i];
+	outputrecord(fp, &rec);
+    }
+}
+
+/*
+ * Core file note functions.
+ */
+
+/* The number of threads found so far in the current core file.
+ */
+static unsigned long threadnum;
+
+/* Return the name of an auxiliary vector entry type, or NULL.
+ */
+static char const *auxvtypename(unsigned long type)
+{
+    switch (type) {
+      case AT_NULL:		return "AT_NULL";
+      case AT_IGNORE:		return "AT_IGNORE";
+      case AT_EXECFD:		return "AT_EXECFD";
+      case AT_PHDR:		return "AT_PHDR";
+      case AT_PHENT:		return "AT_PHENT";
+      case AT_PHNUM:		return "AT_PHNUM";
+      case AT_PAGESZ:		return "AT_PAGESZ";
+      case AT_BASE:		return "AT_BASE";
+      case AT_FLAGS:		return "AT_FLAGS";
+      case AT_ENTRY:		return "AT_ENTRY";
+      case AT_NOTELF:		return "AT_NOTELF";
+      case AT_UID:		return "AT_UID";
+      case AT_EUID:		return "AT_EUID";
+      case AT_GID:		return "AT_GID";
+      case AT_EGID:		return "AT_EGID";
+      case AT_CLKTCK:		return "AT_CLKTCK";
+      case AT_PLATFORM:		return "AT_PLATFORM";
+      case AT_HWCAP:		return "AT_HWCAP";
+      case AT_SECURE:		return "AT_SECURE";
+      case AT_BASE_PLATFORM:	return "AT_BASE_PLATFORM";
+      case AT_RANDOM:		return "AT_RANDOM";
+#ifdef AT_HWCAP2
+      case AT_HWCAP2:		return "AT_HWCAP2";
+#endif
+      case AT_EXECFN:		return "AT_EXECFN";
+      case AT_SYSINFO:		return "AT_SYSINFO";
+      case AT_SYSINFO_EHDR:	return "AT_SYSINFO_EHDR";
+#ifdef AT_MINSIGSTKSZ
+      case AT_MINSIGSTKSZ:	return "AT_MINSIGSTKSZ";
+#endif
+    }
+    return NULL;
+}
+
+/* Display a thread's process ID and current signal, as found in an
+ * NT_PRSTATUS note. Only the first few fields of the structure are
+ * read. The ID follows the signal information and two sigset words,
+ * which are the size of a long on the target.
+ */
+static void showprstatus(FILE *fp, unsigned long offset, unsigned long size)
+{
+    record		rec;
+    Elf64_Half		cursig;
+    Elf64_Word		pid;
+    unsigned long	pidoff;
+
+    pidoff = elffhdr.e_ident[EI_CLASS] == ELFCLASS64 ? 32 : 24;
+    if (size < pidoff + 4)
+	return;
+    if (fseek(thefile, offset + 12, SEEK_SET)
+			|| elfrw_read_Half(thefile, &cursig) != 1
+			|| fseek(thefile, offset + pidoff, SEEK_SET)
+			|| elfrw_read_Word(thefile, &pid) != 1)
+	return;
+    if (outformat == FMT_TEXT) {
+	fprintf(fp, "  thread %u", pid);
+	if (cursig)
+	    fprintf(fp, " (signal %u)", cursig);
+	fputc('\n', fp);
+    } else {
+	rec.kind = "thread";
+	rec.fields = RF_INDEX | RF_INFO | RF_LINK;
+	rec.index = threadnum;
+	rec.info = pid;
+	rec.link = cursig;
+	outputrecord(fp, &rec);
+    }
+    ++threadnum;
+}
+
+/* Display the contents of an NT_AUXV note, which is simply an array
+ * of pairs of words.
+ */
+static void showauxv(FILE *fp, unsigned long offset, unsigned long size)
+{
+    record		rec;
+    Elf64_Addr		pair[2];
+    char const	       *str;
+    unsigned long	count, i;
+
+    count = size / (elffhdr.e_ident[EI_CLASS] == ELFCLASS64 ? 16 : 8);
+    if (fseek(thefile, offset, SEEK_SET))
+	return;
+    for (i = 0 ; i < count ; ++i) {
+	if (elfrw_read_Addr(thefile, &pair[0]) != 1
+			|| elfrw_read_Addr(thefile, &pair[1]) != 1)
+	    return;
+	if (pair[0] == AT_NULL)
+	    break;
+	str = auxvtypename(pair[0]);
+	if (outformat == FMT_TEXT) {
+	    if (str)
+		fprintf(fp, "  auxv %s %lX\n", str, (unsigned long)pair[1]);
+	    else
+		fprintf(fp, "  auxv %lu %lX\n", (unsigned long)pair[0],
+					       (unsigned long)pair[1]);
+	} else {
+	    rec.kind = "auxv";
+	    rec.fields = RF_INDEX | RF_TYPE | RF_ADDR;
+	    rec.index = i;
+	    rec.type = typename(pair[0], str);
+	    rec.addr = pair[1];
+	    outputrecord(fp, &rec);
+	}
+    }
+}
+
+/* Display the contents of an NT_FILE note. The note contains a count
+ * and a page size, followed by a triplet of addresses for each mapped
+ * file, followed by the filenames. The triplets and the filenames are
+ * read in parallel, NOTECHUNK entries at a time, so that the amount
+ * of memory used does not depend on the number of mappings.
+ */
+static void showmappedfiles(FILE *fp, unsigned long offset,
+			    unsigned long size)
+{
+    Elf64_Addr		triplets[NOTECHUNK][3];
+    Elf64_Addr		count, pagesize;
+    record		rec;
+    char		name[MAXSTRING];
+    unsigned long	wordsize, namepos, end;
+    unsigned long	i, j, n;
+    int			ch, len;
+
+    wordsize = elffhdr.e_ident[EI_CLASS] == ELFCLASS64 ? 8 : 4;
+    if (size < 2 * wordsize)
+	return;
+    if (fseek(thefile, offset, SEEK_SET)
+			|| elfrw_read_Addr(thefile, &count) != 1
+			|| elfrw_read_Addr(thefile, &pagesize) != 1)
+	return;
+    if (count > (size - 2 * wordsize) / (3 * wordsize))
+	return;
+    end = offset + size;
+    namepos = offset + (2 + 3 * count) * wordsize;
+
+    for (i = 0 ; i < count ; i += n) {
+	n = count - i < NOTECHUNK ? count - i : NOTECHUNK;
+	if (fseek(thefile, offset + (2 + 3 * i) * wordsize, SEEK_SET))
+	    return;
+	for (j = 0 ; j < n ; ++j)
+	    if (elfrw_read_Addr(thefile, &triplets[j][0]) != 1
+			|| elfrw_read_Addr(thefile, &triplets[j][1]) != 1
+			|| elfrw_read_Addr(thefile, &triplets[j][2]) != 1)
+		return;
+	if (fseek(thefile, namepos, SEEK_SET))
+	    return;
+	for (j = 0 ; j < n ; ++j) {
+	    len = 0;
+	    while (namepos < end && (ch = getc(thefile)) != EOF) {
+		++namepos;
+		if (!ch)
+		    break;
+		if (len < (int)sizeof name - 1)
+		    name[len++] = ch < ' ' || ch > '~' ? '.' : ch;
+	    }
+	    name[len] = '\0';
+	    if (outformat == FMT_TEXT) {
+		fputs("  file ", fp);
+		fprintf(fp, addrfmt, (unsigned long)triplets[j][0]);
+		fputc('-', fp);
+		fprintf(fp, addrfmt, (unsigned long)triplets[j][1]);
+		fprintf(fp, " %lX %s\n",
+			(unsigned long)(triplets[j][2] * pagesize), name);
+	    } else {
+		rec.kind = "mapping";
+		rec.fields = RF_INDEX | RF_OFFSET | RF_ADDR | RF_MEMSZ
+					     | RF_NAME;
+		rec.index = i + j;
+		rec.addr = triplets[j][0];
+		rec.memsz = triplets[j][1] - triplets[j][0];
+		rec.offset = triplets[j][2] * pagesize;
+		rec.name = name;
+		outputrecord(fp, &rec);
 	    }
 	}
+    }
+}
 
-	makenumberfmts();
-	if (phdrls && proghdrs) {
-	    printf("Program header table entries: %d", elffhdr.e_phnum);
-	    if (dooffs)
-		printf(" (%lX - %lX)",
-		       (unsigned long)elffhdr.e_phoff,
-		       (unsigned long)elffhdr.e_phoff +
-				elffhdr.e_phnum * elffhdr.e_phentsize);
-	    putchar('\n');
-	    lines = gettextlines(elffhdr.e_phnum);
-	    for (i = 0 ; i < elffhdr.e_phnum ; ++i) {
-		append(lines + i, "%2d ", i);
-		describephdr(lines + i, proghdr + i);
+/* Display the contents of a single core file note, if it is one of
+ * the types that the program knows how to decode.
+ */
+static void showcorenote(FILE *fp, Elf64_Word type, char const *name,
+			 unsigned long offset, unsigned long size)
+{
+    if (strcmp(name, "CORE"))
+	return;
+    switch (type) {
+      case NT_PRSTATUS:	showprstatus(fp, offset, size);		break;
+      case NT_AUXV:	showauxv(fp, offset, size);		break;
+#ifdef NT_FILE
+      case NT_FILE:	showmappedfiles(fp, offset, size);	break;
+#endif
+    }
+}
+
+/* Display the decoded contents of a core file's notes. Only the note
+ * segments are read, and they are read piecemeal, so the cost is the
+ * same regardless of how big the process's memory image was.
+ */
+static void listcorenotes(FILE *fp)
+{
+    int i;
+
+    threadnum = 0;
+    if (outformat == FMT_TEXT)
+	fputs("Core file notes:\n", fp);
+    for (i = 0 ; i < elffhdr.e_phnum ; ++i)
+	if (proghdr[i].p_type == PT_NOTE)
+	    walknotes(fp, proghdr[i].p_offset, proghdr[i].p_filesz,
+		      proghdr[i].p_align, showcorenote);
+}
+
+/*
+ * Build ID index functions.
+ */
+
+/* The index file consists of a header, a table of fixed-size entries
+ * sorted by key, and the filenames that the entries refer to. All
+ * numbers are stored as 64-bit little-endian values, so that the
+ * index can be searched in place after being mapped into memory.
+ * The first byte of a key is the length of the build ID, and the
+ * remainder holds the ID, padded with zeros.
+ */
+#define	IDMAGIC		"ELFLSBID"
+#define	IDHDRSIZE	16
+#define	IDKEYSIZE	40
+#define	IDENTRYSIZE	(IDKEYSIZE + 8)
+
+/* Structure used to hold one entry of the build ID index while it is
+ * being collected.
+ */
+typedef struct buildid {
+    unsigned char key[IDKEYSIZE];	/* the length and bytes of the ID */
+    unsigned long pathoff;		/* position of the filename */
+} buildid;
+
+/* The most build IDs that are held in memory at one time. Larger
+ * sets are sorted in runs of this size, which are kept in a temporary
+ * file and merged together when the index is written out. The
+ * filenames are likewise kept in a temporary file.
+ */
+#define	IDRUNSIZE	65536
+
+/* The number of entries of each run that are read into memory at one
+ * time during the merge.
+ */
+#define	IDMERGEBUF	256
+
+static buildid	       *ids = NULL;	/* the current run of build IDs */
+static unsigned long	idcount = 0;	/* number of entries in ids */
+static unsigned long	idsalloc = 0;	/* allocated size of ids */
+static unsigned long	idtotal = 0;	/* number of IDs found in all */
+static FILE	       *idruns = NULL;	/* the runs already sorted */
+static FILE	       *idpaths = NULL;	/* the collected filenames */
+static unsigned long	idpathsize = 0;	/* total length of idpaths */
+static int		idfound;	/* TRUE if current file has an ID */
+
+/* Store a build ID, given in binary, as a key.
+ */
+static void makeidkey(unsigned char key[IDKEYSIZE],
+		      unsigned char const *id, unsigned long size)
+{
+    if (size > IDKEYSIZE - 1)
+	size = IDKEYSIZE - 1;
+    memset(key, 0, IDKEYSIZE);
+    key[0] = size;
+    memcpy(key + 1, id, size);
+}
+
+/* Store a build ID, given in hexadecimal, as a key. FALSE is returned
+ * if the string is not a valid ID.
+ */
+static int makeidkeyfromhex(unsigned char key[IDKEYSIZE], char const *str)
+{
+    unsigned char	id[IDKEYSIZE];
+    unsigned long	size;
+    int			d, i;
+
+    for (size = 0 ; *str && size < sizeof id ; ++size) {
+	for (i = 0 ; i < 2 ; ++i, ++str) {
+	    if (*str >= '0' && *str <= '9')
+		d = *str - '0';
+	    else if (*str >= 'a' && *str <= 'f')
+		d = *str - 'a' + 10;
+	    else if (*str >= 'A' && *str <= 'F')
+		d = *str - 'A' + 10;
+	    else
+		return FALSE;
+	    id[size] = (id[size] << 4) | d;
+	}
+    }
+    if (*str || size == 0 || size > IDKEYSIZE - 1)
+	return FALSE;
+    makeidkey(key, id, size);
+    return TRUE;
+}
+
+/* Report an error with one of the temporary files and exit.
+ */
+static void idfileerr(void)
+{
+    err("temporary file: %s", strerror(errno));
+    exit(EXIT_FAILURE);
+}
+
+/* Write a number to a file as a 64-bit little-endian value.
+ */
+static int putle64(FILE *fp, unsigned long long n)
+{
+    unsigned char	buf[8];
+    int			i;
+
+    for (i = 0 ; i < 8 ; ++i, n >>= 8)
+	buf[i] = n & 0xFF;
+    return fwrite(buf, 8, 1, fp) == 1;
+}
+
+/* Read a 64-bit little-endian value from memory.
+ */
+static unsigned long long getle64(unsigned char const *p)
+{
+    unsigned long long n;
+    int i;
+
+    n = 0;
+    for (i = 7 ; i >= 0 ; --i)
+	n = (n << 8) | p[i];
+    return n;
+}
+
+/* Function to pass to qsort() to sort the build IDs by key, keeping
+ * entries with the same ID in the order they were found.
+ */
+static int idsorter(void const *a, void const *b)
+{
+    buildid const *id1 = a;
+    buildid const *id2 = b;
+    int n;
+
+    n = memcmp(id1->key, id2->key, IDKEYSIZE);
+    if (n)
+	return n;
+    return id1->pathoff < id2->pathoff ? -1 : id1->pathoff > id2->pathoff;
+}
+
+/* Sort the build IDs currently in memory, and write them out as
+ * index entries.
+ */
+static void writeidentries(FILE *fp)
+{
+    unsigned long i;
+
+    qsort(ids, idcount, sizeof *ids, idsorter);
+    for (i = 0 ; i < idcount ; ++i) {
+	fwrite(ids[i].key, IDKEYSIZE, 1, fp);
+	putle64(fp, ids[i].pathoff);
+    }
+    idcount = 0;
+}
+
+/* Move the build IDs currently in memory to a new sorted run.
+ */
+static void flushidrun(void)
+{
+    if (!idruns && !(idruns = tmpfile()))
+	idfileerr();
+    writeidentries(idruns);
+    if (ferror(idruns))
+	idfileerr();
+}
+
+/* Remember the build ID of the current file, if the given note is a
+ * build ID note. Only the first such note in a file is used.
+ */
+static void addbuildid(FILE *fp, Elf64_Word type, char const *name,
+		       unsigned long offset, unsigned long size)
+{
+    unsigned char	id[IDKEYSIZE];
+    unsigned long	n;
+    buildid	       *entry;
+
+    (void)fp;
+    if (idfound || type != NT_GNU_BUILD_ID || strcmp(name, "GNU"))
+	return;
+    if (size == 0)
+	return;
+    if (size > sizeof id - 1)
+	size = sizeof id - 1;
+    if (fseek(thefile, offset, SEEK_SET) || fread(id, size, 1, thefile) != 1)
+	return;
+    idfound = TRUE;
+
+    if (idcount == IDRUNSIZE)
+	flushidrun();
+    if (idcount == idsalloc) {
+	idsalloc = idsalloc ? 2 * idsalloc : 1024;
+	if (!(ids = realloc(ids, idsalloc * sizeof *ids)))
+	    nomem();
+    }
+    if (!idpaths && !(idpaths = tmpfile()))
+	idfileerr();
+    n = strlen(thefilename) + 1;
+    if (fwrite(thefilename, n, 1, idpaths) != 1)
+	idfileerr();
+    entry = ids + idcount++;
+    makeidkey(entry->key, id, size);
+    entry->pathoff = idpathsize;
+    idpathsize += n;
+    ++idtotal;
+}
+
+/* Find the build ID of the current file. The note segments are
+ * examined first, and the note sections are used as a fallback.
+ */
+static int collectbuildid(void)
+{
+    int i;
+
+    idfound = FALSE;
+    for (i = 0 ; i < elffhdr.e_phnum && !idfound ; ++i)
+	if (proghdr[i].p_type == PT_NOTE)
+	    walknotes(NULL, proghdr[i].p_offset, proghdr[i].p_filesz,
+		      proghdr[i].p_align, addbuildid);
+    if (secthdrs)
+	for (i = 0 ; i < elffhdr.e_shnum && !idfound ; ++i)
+	    if (secthdr[i].sh_type == SHT_NOTE)
+		walknotes(NULL, secthdr[i].sh_offset, secthdr[i].sh_size,
+			  secthdr[i].sh_addralign, addbuildid);
+    return idfound;
+}
+
+/* Merge the sorted runs of build IDs into a single sorted list of
+ * index entries. The runs are read a few entries at a time, and the
+ * entry that sorts first is repeatedly selected from among them.
+ */
+static void mergeidruns(FILE *fp)
+{
+    struct {
+	unsigned long	next;		/* the next entry to read */
+	unsigned long	end;		/* the end of the run */
+	unsigned char  *buf;		/* the entries read so far */
+	long		count;		/* the number of entries in buf */
+	long		pos;		/* the current entry in buf */
+    }		       *runs;
+    unsigned char const *p, *q;
+    unsigned long	runcount, i, j, k;
+    long		n;
+
+    if (fflush(idruns))
+	idfileerr();
+    runcount = (idtotal + IDRUNSIZE - 1) / IDRUNSIZE;
+    if (!(runs = malloc(runcount * (sizeof *runs
+					+ IDMERGEBUF * IDENTRYSIZE))))
+	nomem();
+    for (i = 0 ; i < runcount ; ++i) {
+	runs[i].next = i * IDRUNSIZE;
+	runs[i].end = runs[i].next + IDRUNSIZE;
+	if (runs[i].end > idtotal)
+	    runs[i].end = idtotal;
+	runs[i].buf = (unsigned char*)(runs + runcount)
+					+ i * IDMERGEBUF * IDENTRYSIZE;
+	runs[i].count = runs[i].pos = 0;
+    }
+
+    for (k = 0 ; k < idtotal ; ++k) {
+	j = runcount;
+	for (i = 0 ; i < runcount ; ++i) {
+	    if (runs[i].pos == runs[i].count) {
+		if (runs[i].next == runs[i].end)
+		    continue;
+		n = runs[i].end - runs[i].next;
+		if (n > IDMERGEBUF)
+		    n = IDMERGEBUF;
+		if (pread(fileno(idruns), runs[i].buf, n * IDENTRYSIZE,
+			  runs[i].next * IDENTRYSIZE) != n * IDENTRYSIZE)
+		    idfileerr();
+		runs[i].next += n;
+		runs[i].count = n;
+		runs[i].pos = 0;
 	    }
-	    formatlist(stdout, lines, elffhdr.e_phnum);
-	    free(lines);
+	    if (j == runcount) {
+		j = i;
+		continue;
+	    }
+	    p = runs[i].buf + runs[i].pos * IDENTRYSIZE;
+	    q = runs[j].buf + runs[j].pos * IDENTRYSIZE;
+	    n = memcmp(p, q, IDKEYSIZE);
+	    if (n < 0 || (n == 0 && getle64(p + IDKEYSIZE)
+					< getle64(q + IDKEYSIZE)))
+		j = i;
 	}
+	fwrite(runs[j].buf + runs[j].pos * IDENTRYSIZE, IDENTRYSIZE, 1, fp);
+	++runs[j].pos;
+    }
+    free(runs);
+}
 
-	if (shdrls && secthdrs) {
-	    printf("Section header table entries: %d", elffhdr.e_shnum);
-	    if (dooffs)
-		printf(" (%lX - %lX)",
-		       (unsigned long)elffhdr.e_shoff,
-		       (unsigned long)elffhdr.e_shoff +
-					elffhdr.e_shnum * elffhdr.e_shentsize);
-	    putchar('\n');
-	    lines = gettextlines(elffhdr.e_shnum);
-	    for (i = 0 ; i < elffhdr.e_shnum ; ++i) {
-		append(lines + i, "%2d ", i);
-		describeshdr(lines + i, secthdr + i);
+/* Sort the collected build IDs and write them out as an index file.
+ * If all of the IDs fit in memory they are simply sorted there;
+ * otherwise the sorted runs are merged. The filenames are then
+ * copied over from their temporary file.
+ */
+static int writebuildidindex(char const *filename)
+{
+    FILE	       *fp;
+    char		buf[BUFSIZ];
+    size_t		n;
+
+    if (!(fp = fopen(filename, "wb")))
+	return err("%s: %s", filename, strerror(errno));
+    fwrite(IDMAGIC, 8, 1, fp);
+    putle64(fp, idtotal);
+    if (idruns) {
+	if (idcount)
+	    flushidrun();
+	mergeidruns(fp);
+    } else {
+	writeidentries(fp);
+    }
+    if (idpaths) {
+	rewind(idpaths);
+	while ((n = fread(buf, 1, sizeof buf, idpaths)) > 0)
+	    fwrite(buf, 1, n, fp);
+	if (ferror(idpaths))
+	    idfileerr();
+    }
+    if (ferror(fp) | fclose(fp))
+	return err("%s: %s", filename, strerror(errno));
+    return TRUE;
+}
+
+/* Look up each of the given build IDs in an index file, and display
+ * the names of the files that have them. The index is mapped into
+ * memory and binary-searched in place, so only the pages that are
+ * actually touched are read in. The return value is the number of
+ * IDs that could not be found.
+ */
+static int lookupbuildids(char const *filename, char **idstrs)
+{
+    unsigned char	key[IDKEYSIZE];
+    unsigned char const *map, *entry, *paths;
+    unsigned long	count, pathssize, lo, hi, mid, off;
+    struct stat		st;
+    int			fd, failures = 0;
+
+    if ((fd = open(filename, O_RDONLY)) < 0 || fstat(fd, &st)) {
+	err("%s: %s", filename, strerror(errno));
+	exit(EXIT_FAILURE);
+    }
+    if (st.st_size < IDHDRSIZE) {
+	err("%s: not a build ID index.", filename);
+	exit(EXIT_FAILURE);
+    }
+    map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map == MAP_FAILED) {
+	err("%s: %s", filename, strerror(errno));
+	exit(EXIT_FAILURE);
+    }
+    close(fd);
+    count = getle64(map + 8);
+    if (memcmp(map, IDMAGIC, 8)
+		|| count > (unsigned long)(st.st_size - IDHDRSIZE)
+							/ IDENTRYSIZE) {
+	err("%s: not a build ID index.", filename);
+	exit(EXIT_FAILURE);
+    }
+    paths = map + IDHDRSIZE + count * IDENTRYSIZE;
+    pathssize = st.st_size - IDHDRSIZE - count * IDENTRYSIZE;
+
+    for ( ; *idstrs ; ++idstrs) {
+	if (!makeidkeyfromhex(key, *idstrs)) {
+	    err("%s: invalid build ID.", *idstrs);
+	    ++failures;
+	    continue;
+	}
+	lo = 0;
+	hi = count;
+	while (lo < hi) {
+	    mid = lo + (hi - lo) / 2;
+	    if (memcmp(map + IDHDRSIZE + mid * IDENTRYSIZE,
+		       key, IDKEYSIZE) < 0)
+		lo = mid + 1;
+	    else
+		hi = mid;
+	}
+	entry = map + IDHDRSIZE + lo * IDENTRYSIZE;
+	if (lo == count || memcmp(entry, key, IDKEYSIZE)) {
+	    err("%s: build ID not found.", *idstrs);
+	    ++failures;
+	    continue;
+	}
+	for ( ; lo < count && !memcmp(entry, key, IDKEYSIZE)
+	      ; ++lo, entry += IDENTRYSIZE) {
+	    off = getle64(entry + IDKEYSIZE);
+	    if (off >= pathssize
+		    || !memchr(paths + off, '\0', pathssize - off)) {
+		err("%s: corrupted index entry.", filename);
+		++failures;
+		break;
 	    }
-	    formatlist(stdout, lines, elffhdr.e_shnum);
+	    printf("%s\n", paths + off);
+	}
+    }
+
+    munmap((void*)map, st.st_size);
+    return failures;
+}
+
+/*
+ * Top-level functions.
+ */
+
+/* Display the contents of the current file in the human-readable
+ * format.
+ */
+static void listfiletext(FILE *fp)
+{
+    unsigned long long hash;
+    textline   *lines = NULL;
+    char const **names;
+    char       *strs;
+    int		count, i;
+
+    describeehdr(fp);
+    if (ldepls && proghdrs) {
+	if ((count = getlibraries(&names, &strs))) {
+	    lines = getnamelines(names, count);
+	    outputlist(fp, lines, count, "Dependencies: ");
+	    free(lines);
+	    free(names);
+	    free(strs);
+	}
+    }
+    if (srcfls && secthdrs) {
+	if ((count = getsrcfiles(&names, &strs))) {
+	    qsort(names, count, sizeof *names, namesorter);
+	    lines = getnamelines(names, count);
+	    outputlist(fp, lines, count, "Source files: ");
 	    free(lines);
+	    free(names);
+	    free(strs);
+	}
+    }
+
+    makenumberfmts();
+    if (phdrls && proghdrs) {
+	fprintf(fp, "Program header table entries: %d", elffhdr.e_phnum);
+	if (dooffs)
+	    fprintf(fp, " (%lX - %lX)",
+		    (unsigned long)elffhdr.e_phoff,
+		    (unsigned long)elffhdr.e_phoff +
+				elffhdr.e_phnum * elffhdr.e_phentsize);
+	fputc('\n', fp);
+	lines = gettextlines(elffhdr.e_phnum);
+	for (i = 0 ; i < elffhdr.e_phnum ; ++i) {
+	    append(lines + i, "%2d ", i);
+	    describephdr(lines + i, proghdr + i);
+	    if (dohash && getareahash(proghdr[i].p_offset,
+				      proghdr[i].p_filesz, &hash))
+		append(lines + i, " %016llX", hash);
+	}
+	formatlist(fp, lines, elffhdr.e_phnum);
+	free(lines);
+    }
+    if (notels && proghdrs && elffhdr.e_type == ET_CORE)
+	listcorenotes(fp);
+
+    if (shdrls && secthdrs) {
+	fprintf(fp, "Section header table entries: %d", elffhdr.e_shnum);
+	if (dooffs)
+	    fprintf(fp, " (%lX - %lX)",
+		    (unsigned long)elffhdr.e_shoff,
+		    (unsigned long)elffhdr.e_shoff +
+				elffhdr.e_shnum * elffhdr.e_shentsize);
+	fputc('\n', fp);
+	lines = gettextlines(elffhdr.e_shnum);
+	for (i = 0 ; i < elffhdr.e_shnum ; ++i) {
+	    append(lines + i, "%2d ", i);
+	    describeshdr(lines + i, secthdr + i);
+	    if (dohash && secthdr[i].sh_type != SHT_NOBITS
+		       && getareahash(secthdr[i].sh_offset,
+				      secthdr[i].sh_size, &hash))
+		append(lines + i, " %016llX", hash);
+	}
+	formatlist(fp, lines, elffhdr.e_shnum);
+	free(lines);
+    }
+}
+
+/* Output the contents of the current file as a stream of records.
+ * Nothing is measured or padded, so each record can be written out
+ * as soon as it is generated.
+ */
+static void listfilerecords(FILE *fp)
+{
+    char const **names;
+    char       *strs;
+    int		count;
+
+    recordehdr(fp);
+    if (ldepls && proghdrs) {
+	if ((count = getlibraries(&names, &strs))) {
+	    recordlist(fp, names, count, "dependency");
+	    free(names);
+	    free(strs);
 	}
+    }
+    if (srcfls && secthdrs) {
+	if ((count = getsrcfiles(&names, &strs))) {
+	    qsort(names, count, sizeof *names, namesorter);
+	    recordlist(fp, names, count, "source");
+	    free(names);
+	    free(strs);
+	}
+    }
+    if (phdrls && proghdrs)
+	recordphdrs(fp);
+    if (notels && proghdrs && elffhdr.e_type == ET_CORE)
+	listcorenotes(fp);
+    if (shdrls && secthdrs)
+	recordshdrs(fp);
+}
+
+/* List the contents of the ELF file currently open as thefile. All
+ * of the per-file state is discarded afterwards.
+ */
+static int listfile(void)
+{
+    int r;
+
+    proghdrs = secthdrs = FALSE;
+    phentry = NULL;
+    shshstr = NULL;
+    r = readelfhdr() && readproghdrs() && readsecthdrs();
+    if (r && idindex) {
+	collectbuildid();
+    } else if (r) {
+	if (outformat == FMT_TEXT)
+	    listfiletext(stdout);
+	else
+	    listfilerecords(stdout);
+	if (dogroup)
+	    savefingerprints();
+    }
+    free(proghdr);
+    free(secthdr);
+    free(sectstr);
+    proghdr = NULL;
+    secthdr = NULL;
+    sectstr = NULL;
+    return r;
+}
+
+/* Parse the decimal number in an archive member header field.
+ */
+static unsigned long arnumber(char const *field, int size)
+{
+    unsigned long n;
+    int i;
 
+    n = 0;
+    for (i = 0 ; i < size && field[i] >= '0' && field[i] <= '9' ; ++i)
+	n = n * 10 + field[i] - '0';
+    return n;
+}
+
+/* Read a big-endian number from an archive symbol table.
+ */
+static unsigned long arword(unsigned char const *p, int size)
+{
+    unsigned long n;
+    int i;
+
+    n = 0;
+    for (i = 0 ; i < size ; ++i)
+	n = (n << 8) | p[i];
+    return n;
+}
+
+/* Report the contents of an archive's symbol table, given the size of
+ * the numbers it uses.
+ */
+static void describearmap(unsigned char const *map, unsigned long size,
+			  int wordsize, char const *arname)
+{
+    record		rec;
+    unsigned long	count;
+
+    if (idindex || size < (unsigned long)wordsize)
+	return;
+    count = arword(map, wordsize);
+    if (count > (size - wordsize) / wordsize) {
+	err("%s: invalid archive symbol table.", arname);
+	return;
+    }
+    if (outformat == FMT_TEXT) {
+	printf("%s (archive index: %lu symbols)\n", arname, count);
+    } else {
+	rec.kind = "armap";
+	rec.fields = RF_SIZE | RF_INFO;
+	rec.size = size;
+	rec.info = count;
+	outputrecord(stdout, &rec);
+    }
+}
+
+/* List every ELF object contained in a static archive. The whole
+ * archive is mapped into memory once, and each member is then read
+ * in place as its own in-memory stream. Members that are not ELF
+ * files are silently skipped. The return value is the number of
+ * members that could not be listed.
+ */
+static int listarchive(char const *arname)
+{
+    struct ar_hdr const	*hdr;
+    unsigned char const	*map;
+    char const	       *longnames = NULL;
+    unsigned long	longnamessize = 0;
+    unsigned long	pos, next, size, msize, n;
+    char const	       *name;
+    char	       *fullname = NULL;
+    struct stat		st;
+    int			namelen;
+    int			failures = 0;
+
+    if (fstat(fileno(thefile), &st)) {
+	err(NULL);
+	fclose(thefile);
+	return 1;
+    }
+    size = st.st_size;
+    map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fileno(thefile), 0);
+    if (map == MAP_FAILED) {
+	err(NULL);
+	fclose(thefile);
+	return 1;
+    }
+    fclose(thefile);
+
+    for (pos = SARMAG ; pos + sizeof *hdr <= size ; pos = next) {
+	hdr = (struct ar_hdr const*)(map + pos);
+	if (memcmp(hdr->ar_fmag, ARFMAG, sizeof hdr->ar_fmag)) {
+	    err("%s: invalid archive member header at %lX.", arname, pos);
+	    ++failures;
+	    break;
+	}
+	msize = arnumber(hdr->ar_size, sizeof hdr->ar_size);
+	pos += sizeof *hdr;
+	if (msize > size - pos) {
+	    err("%s: truncated archive member at %lX.", arname, pos);
+	    ++failures;
+	    break;
+	}
+	next = pos + msize + ((pos + msize) & 1);
+
+	name = hdr->ar_name;
+	if (name[0] == '/') {
+	    if (name[1] == ' ') {
+		describearmap(map + pos, msize, 4, arname);
+		continue;
+	    } else if (!memcmp(name, "/SYM64/ ", 8)) {
+		describearmap(map + pos, msize, 8, arname);
+		continue;
+	    } else if (name[1] == '/') {
+		longnames = (char const*)map + pos;
+		longnamessize = msize;
+		continue;
+	    }
+	    n = arnumber(name + 1, sizeof hdr->ar_name - 1);
+	    if (!longnames || n >= longnamessize) {
+		err("%s: invalid long member name at %lX.", arname, pos);
+		++failures;
+		continue;
+	    }
+	    name = longnames + n;
+	    for (namelen = 0 ; n + namelen < longnamessize ; ++namelen)
+		if (name[namelen] == '/' || name[namelen] == '\n')
+		    break;
+	} else if (!memcmp(name, "#1/", 3)) {
+	    n = arnumber(name + 3, sizeof hdr->ar_name - 3);
+	    if (n > msize) {
+		err("%s: invalid long member name at %lX.", arname, pos);
+		++failures;
+		continue;
+	    }
+	    name = (char const*)map + pos;
+	    for (namelen = 0 ; namelen < (int)n && name[namelen] ; ++namelen) ;
+	    pos += n;
+	    msize -= n;
+	    if (!memcmp(name, "__.SYMDEF", 9))
+		continue;
+	} else {
+	    for (namelen = 0 ; namelen < (int)sizeof hdr->ar_name ; ++namelen)
+		if (name[namelen] == '/' || name[namelen] == ' ')
+		    break;
+	}
+
+	if (msize < SELFMAG || memcmp(map + pos, ELFMAG, SELFMAG))
+	    continue;
+	if (!(fullname = realloc(fullname, strlen(arname) + namelen + 3)))
+	    nomem();
+	sprintf(fullname, "%s(%.*s)", arname, namelen, name);
+	thefilename = fullname;
+	if (!(thefile = fmemopen((void*)(map + pos), msize, "rb"))) {
+	    err(NULL);
+	    ++failures;
+	    continue;
+	}
+	theimage = map + pos;
+	theimagesize = msize;
+	if (!listfile())
+	    ++failures;
 	fclose(thefile);
-	free(proghdr);
-	free(secthdr);
-	free(sectstr);
     }
 
+    theimage = NULL;
+    thefilename = arname;
+    free(fullname);
+    munmap((void*)map, size);
+    return failures;
+}
+
+/* Parse the command-line options.
+ */
+static void readoptions(int argc, char *argv[])
+{
+    static char const *optstring = "B:cdf:giL:NPpSw:x";
+    static struct option const options[] = {
+	{ "sources", no_argument, NULL, 'c' },
+	{ "dependencies", no_argument, NULL, 'd' },
+	{ "nophdr", no_argument, NULL, 'P' },
+	{ "noshdr", no_argument, NULL, 'S' },
+	{ "nonotes", no_argument, NULL, 'N' },
+	{ "nostr", no_argument, NULL, 'i' },
+	{ "nopos", no_argument, NULL, 'p' },
+	{ "width", required_argument, NULL, 'w' },
+	{ "format", required_argument, NULL, 'f' },
+	{ "hash", no_argument, NULL, 'x' },
+	{ "group", no_argument, NULL, 'g' },
+	{ "build-id-index", required_argument, NULL, 'B' },
+	{ "lookup", required_argument, NULL, 'L' },
+	{ "help", no_argument, NULL, 'H' },
+	{ "version", no_argument, NULL, 'V' },
+	{ 0, 0, 0, 0 }
+    };
+
+    char const *str;
+    int n;
+
+    programname = argv[0];
+    if (argc == 1) {
+	fputs(yowzitch, stdout);
+	exit(EXIT_SUCCESS);
+    }
+
+    if (!(str = getenv("COLUMNS")) || (outwidth = atoi(str)) <= 0)
+	outwidth = 80;
+
+    while ((n = getopt_long(argc, argv, optstring, options, NULL)) != EOF) {
+	switch (n) {
+	  case 'c':	srcfls = TRUE;			break;
+	  case 'd':	ldepls = TRUE;			break;
+	  case 'P':	phdrls = FALSE;			break;
+	  case 'S':	shdrls = FALSE;			break;
+	  case 'N':	notels = FALSE;			break;
+	  case 'i':	dostrs = FALSE;			break;
+	  case 'p':	dooffs = FALSE;			break;
+	  case 'w':	outwidth = atoi(optarg);	break;
+	  case 'x':	dohash = TRUE;			break;
+	  case 'g':	dogroup = TRUE;			break;
+	  case 'B':	idindex = optarg;		break;
+	  case 'L':	idlookup = optarg;		break;
+	  case 'f':
+	    if (!strcmp(optarg, "text"))
+		outformat = FMT_TEXT;
+	    else if (!strcmp(optarg, "jsonl") || !strcmp(optarg, "json"))
+		outformat = FMT_JSONL;
+	    else if (!strcmp(optarg, "csv"))
+		outformat = FMT_CSV;
+	    else {
+		err("invalid format: %s.", optarg);
+		exit(EXIT_FAILURE);
+	    }
+	    break;
+	  case 'H':	fputs(yowzitch, stdout);	exit(EXIT_SUCCESS);
+	  case 'V':	fputs(vourzhon, stdout);	exit(EXIT_SUCCESS);
+	  default:
+	    fprintf(stderr, "Try --help for more information.\n");
+	    exit(EXIT_FAILURE);
+	}
+    }
+    if (outwidth < 0) {
+	err("invalid width parameter.");
+	exit(EXIT_FAILURE);
+    }
+}
+
+/* List the contents of the named file, which may be either an ELF
+ * file or an archive of them. The return value is the number of files
+ * that could not be listed.
+ */
+static int listpath(char const *filename)
+{
+    struct stat	st;
+    char	magic[SARMAG];
+    int		ret = 0;
+
+    thefilename = filename;
+    if (!(thefile = fopen(thefilename, "rb"))) {
+	perror(thefilename);
+	return 1;
+    }
+    if (fread(magic, SARMAG, 1, thefile) == 1) {
+	if (!memcmp(magic, ARMAG, SARMAG)) {
+	    return listarchive(thefilename);
+	} else if (!memcmp(magic, "!<thin>\n", SARMAG)) {
+	    err("%s: thin archives are not supported.", thefilename);
+	    fclose(thefile);
+	    return 1;
+	}
+    }
+    rewind(thefile);
+    if ((dohash || dogroup) && !fstat(fileno(thefile), &st)
+			    && S_ISREG(st.st_mode) && st.st_size > 0) {
+	theimagesize = st.st_size;
+	theimage = mmap(NULL, theimagesize, PROT_READ, MAP_PRIVATE,
+			fileno(thefile), 0);
+	if (theimage == MAP_FAILED)
+	    theimage = NULL;
+    }
+    if (!listfile())
+	++ret;
+    if (theimage) {
+	munmap((void*)theimage, theimagesize);
+	theimage = NULL;
+    }
+    fclose(thefile);
     return ret;
 }
+
+/* List the files named on standard input, one per line. The same
+ * buffer is reused for each line; anything that needs a name to
+ * outlive its file makes its own copy.
+ */
+static int listpathsfromstdin(void)
+{
+    char       *line = NULL;
+    size_t	linesize = 0;
+    ssize_t	n;
+    int		ret = 0;
+
+    while ((n = getline(&line, &linesize, stdin)) > 0) {
+	if (line[n - 1] == '\n')
+	    line[--n] = '\0';
+	if (n == 0)
+	    continue;
+	ret += listpath(line);
+    }
+    free(line);
+    return ret;
+}
+
+/* main().
+ */
+int main(int argc, char *argv[])
+{
+    char      **arg;
+    int		ret = 0;
+
+    readoptions(argc, argv);
+    if (optind == argc) {
+	err("nothing to do.");
+	exit(EXIT_FAILURE);
+    }
+
+    if (idlookup)
+	return lookupbuildids(idlookup, argv + optind) ? EXIT_FAILURE : 0;
+
+    if (outformat != FMT_TEXT)
+	setvbuf(stdout, NULL, _IOFBF, 65536);
+    if (outformat == FMT_CSV && !idindex)
+	outputcsvheader(stdout);
+
+    for (arg = argv + optind ; *arg ; ++arg) {
+	if (!strcmp(*arg, "-"))
+	    ret += listpathsfromstdin();
+	else
+	    ret += listpath(*arg);
+    }
+
+    if (idindex && !writebuildidindex(idindex))
+	++ret;
+    if (dogroup)
+	outputgroups(stdout);
+    return ret ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,3451 @@
+/* This file is automatically generated by mknames. */
+enum { prefixcount = 32 };
+static char const *prefixes[prefixcount] = {
+  "AT_",
+  "DF_",
+  "DF_1_",
+  "DTF_",
+  "DT_",
+  "EF_",
+  "ELFCLASS",
+  "ELFDATA",
+  "ELFMAG",
+  "ELFOSABI_",
+  "ELF_NOTE_OS_",
+  "EM_",
+  "ET_",
+  "EV_",
+  "NT_",
+  "NT_GNU_",
+  "PF_",
+  "PT_",
+  "R_",
+  "SHF_",
+  "SHN_",
+  "SHT_",
+  "STB_",
+  "STN_",
+  "STT_",
+  "STV_",
+  "SYMINFO_BT_",
+  "SYMINFO_FLG_",
+  "VER_DEF_",
+  "VER_FLG_",
+  "VER_NDX_",
+  "VER_NEED_",
+};
+enum { machineidcount = 14 };
+static int machineids[machineidcount] = {
+  EM_NONE,
+  EM_386,
+  EM_S390,
+  EM_68K,
+  EM_ALPHA,
+  EM_ARM,
+  EM_PARISC,
+  EM_IA_64,
+  EM_MIPS,
+  EM_PPC,
+  EM_PPC64,
+  EM_SH,
+  EM_SPARC,
+  EM_X86_64,
+};
+static struct name _na_AT_[] = {
+  { "AT_IGNORE", AT_IGNORE, 0 },
+  { "AT_ICACHEBSIZE", AT_ICACHEBSIZE, 0 },
+  { "AT_L2_CACHESIZE", AT_L2_CACHESIZE, 0 },
+  { "AT_SYSINFO_EHDR", AT_SYSINFO_EHDR, 0 },
+  { "AT_L1I_CACHESIZE", AT_L1I_CACHESIZE, 0 },
+  { "AT_NULL", AT_NULL, 0 },
+  { "AT_L1D_CACHESHAPE", AT_L1D_CACHESHAPE, 0 },
+  { "AT_MINSIGSTKSZ", AT_MINSIGSTKSZ, 0 },
+  { "AT_L3_CACHEGEOMETRY", AT_L3_CACHEGEOMETRY, 0 },
+  { "AT_UID", AT_UID, 0 },
+  { "AT_L2_CACHESHAPE", AT_L2_CACHESHAPE, 0 },
+  { "AT_NOTELF", AT_NOTELF, 0 },
+  { "AT_RANDOM", AT_RANDOM, 0 },
+  { "AT_FPUCW", AT_FPUCW, 0 },
+  { "AT_SECURE", AT_SECURE, 0 },
+  { "AT_GID", AT_GID, 0 },
+  { "AT_PHENT", AT_PHENT, 0 },
+  { "AT_DCACHEBSIZE", AT_DCACHEBSIZE, 0 },
+  { "AT_FLAGS", AT_FLAGS, 0 },
+  { "AT_EUID", AT_EUID, 0 },
+  { "AT_RSEQ_FEATURE_SIZE", AT_RSEQ_FEATURE_SIZE, 0 },
+  { "AT_ENTRY", AT_ENTRY, 0 },
+  { "AT_SYSINFO", AT_SYSINFO, 0 },
+  { "AT_L1D_CACHESIZE", AT_L1D_CACHESIZE, 0 },
+  { "AT_L1I_CACHEGEOMETRY", AT_L1I_CACHEGEOMETRY, 0 },
+  { "AT_PLATFORM", AT_PLATFORM, 0 },
+  { "AT_L3_CACHESHAPE", AT_L3_CACHESHAPE, 0 },
+  { "AT_CLKTCK", AT_CLKTCK, 0 },
+  { "AT_RSEQ_ALIGN", AT_RSEQ_ALIGN, 0 },
+  { "AT_UCACHEBSIZE", AT_UCACHEBSIZE, 0 },
+  { "AT_HWCAP", AT_HWCAP, 0 },
+  { "AT_L1I_CACHESHAPE", AT_L1I_CACHESHAPE, 0 },
+  { "AT_L3_CACHESIZE", AT_L3_CACHESIZE, 0 },
+  { "AT_PHDR", AT_PHDR, 0 },
+  { "AT_EXECFD", AT_EXECFD, 0 },
+  { "AT_EXECFN", AT_EXECFN, 0 },
+  { "AT_IGNOREPPC", AT_IGNOREPPC, 0 },
+  { "AT_L1D_CACHEGEOMETRY", AT_L1D_CACHEGEOMETRY, 0 },
+  { "AT_PHNUM", AT_PHNUM, 0 },
+  { "AT_PAGESZ", AT_PAGESZ, 0 },
+  { "AT_BASE_PLATFORM", AT_BASE_PLATFORM, 0 },
+  { "AT_BASE", AT_BASE, 0 },
+  { "AT_L2_CACHEGEOMETRY", AT_L2_CACHEGEOMETRY, 0 },
+  { "AT_HWCAP2", AT_HWCAP2, 0 },
+  { "AT_EGID", AT_EGID, 0 },
+};
+static struct name _na_DF_[] = {
+  { "DF_SYMBOLIC", DF_SYMBOLIC, 0 },
+  { "DF_P1_LAZYLOAD", DF_P1_LAZYLOAD, 0 },
+  { "DF_ORIGIN", DF_ORIGIN, 0 },
+  { "DF_STATIC_TLS", DF_STATIC_TLS, 0 },
+  { "DF_BIND_NOW", DF_BIND_NOW, 0 },
+  { "DF_TEXTREL", DF_TEXTREL, 0 },
+  { "DF_P1_GROUPPERM", DF_P1_GROUPPERM, 0 },
+};
+static struct name _na_DF_1_[] = {
+  { "DF_1_SINGLETON", DF_1_SINGLETON, 0 },
+  { "DF_1_ORIGIN", DF_1_ORIGIN, 0 },
+  { "DF_1_EDITED", DF_1_EDITED, 0 },
+  { "DF_1_DISPRELDNE", DF_1_DISPRELDNE, 0 },
+  { "DF_1_GROUP", DF_1_GROUP, 0 },
+  { "DF_1_LOADFLTR", DF_1_LOADFLTR, 0 },
+  { "DF_1_KMOD", DF_1_KMOD, 0 },
+  { "DF_1_NODELETE", DF_1_NODELETE, 0 },
+  { "DF_1_ENDFILTEE", DF_1_ENDFILTEE, 0 },
+  { "DF_1_TRANS", DF_1_TRANS, 0 },
+  { "DF_1_WEAKFILTER", DF_1_WEAKFILTER, 0 },
+  { "DF_1_NORELOC", DF_1_NORELOC, 0 },
+  { "DF_1_INTERPOSE", DF_1_INTERPOSE, 0 },
+  { "DF_1_NOHDR", DF_1_NOHDR, 0 },
+  { "DF_1_DIRECT", DF_1_DIRECT, 0 },
+  { "DF_1_GLOBAUDIT", DF_1_GLOBAUDIT, 0 },
+  { "DF_1_PIE", DF_1_PIE, 0 },
+  { "DF_1_NOKSYMS", DF_1_NOKSYMS, 0 },
+  { "DF_1_DISPRELPND", DF_1_DISPRELPND, 0 },
+  { "DF_1_GLOBAL", DF_1_GLOBAL, 0 },
+  { "DF_1_IGNMULDEF", DF_1_IGNMULDEF, 0 },
+  { "DF_1_CONFALT", DF_1_CONFALT, 0 },
+  { "DF_1_NODUMP", DF_1_NODUMP, 0 },
+  { "DF_1_INITFIRST", DF_1_INITFIRST, 0 },
+  { "DF_1_NOOPEN", DF_1_NOOPEN, 0 },
+  { "DF_1_NOCOMMON", DF_1_NOCOMMON, 0 },
+  { "DF_1_STUB", DF_1_STUB, 0 },
+  { "DF_1_NODEFLIB", DF_1_NODEFLIB, 0 },
+  { "DF_1_SYMINTPOSE", DF_1_SYMINTPOSE, 0 },
+  { "DF_1_NOW", DF_1_NOW, 0 },
+  { "DF_1_NODIRECT", DF_1_NODIRECT, 0 },
+};
+static struct name _na_DTF_[] = {
+  { "DTF_1_CONFEXP", DTF_1_CONFEXP, 0 },
+  { "DTF_1_PARINIT", DTF_1_PARINIT, 0 },
+};
+static struct name _na_DT_[] = {
+  { "DT_FINI", DT_FINI, 0 },
+  { "DT_VERDEF", DT_VERDEF, 0 },
+  { "DT_STRTAB", DT_STRTAB, 0 },
+  { "DT_FINI_ARRAY", DT_FINI_ARRAY, 0 },
+  { "DT_TLSDESC_PLT", DT_TLSDESC_PLT, 0 },
+  { "DT_PREINIT_ARRAY", DT_PREINIT_ARRAY, 0 },
+  { "DT_RELSZ", DT_RELSZ, 0 },
+  { "DT_ADDRRNGHI", DT_ADDRRNGHI, 0 },
+  { "DT_FLAGS", DT_FLAGS, 0 },
+  { "DT_RELRSZ", DT_RELRSZ, 0 },
+  { "DT_SYMINSZ", DT_SYMINSZ, 0 },
+  { "DT_VALRNGHI", DT_VALRNGHI, 0 },
+  { "DT_INIT_ARRAYSZ", DT_INIT_ARRAYSZ, 0 },
+  { "DT_VALRNGLO", DT_VALRNGLO, DT_VALRNGHI - DT_VALRNGLO },
+  { "DT_SYMINFO", DT_SYMINFO, 0 },
+  { "DT_MOVEENT", DT_MOVEENT, 0 },
+  { "DT_MOVETAB", DT_MOVETAB, 0 },
+  { "DT_NULL", DT_NULL, 0 },
+  { "DT_RELA", DT_RELA, 0 },
+  { "DT_NIOS2_GP", DT_NIOS2_GP, 0 },
+  { "DT_VERSYM", DT_VERSYM, 0 },
+  { "DT_MOVESZ", DT_MOVESZ, 0 },
+  { "DT_TEXTREL", DT_TEXTREL, 0 },
+  { "DT_CHECKSUM", DT_CHECKSUM, 0 },
+  { "DT_GNU_LIBLISTSZ", DT_GNU_LIBLISTSZ, 0 },
+  { "DT_PROCNUM", DT_PROCNUM, 0 },
+  { "DT_RELR", DT_RELR, 0 },
+  { "DT_GNU_HASH", DT_GNU_HASH, 0 },
+  { "DT_JMPREL", DT_JMPREL, 0 },
+  { "DT_GNU_CONFLICTSZ", DT_GNU_CONFLICTSZ, 0 },
+  { "DT_AUXILIARY", DT_AUXILIARY, 0 },
+  { "DT_INIT", DT_INIT, 0 },
+  { "DT_AUDIT", DT_AUDIT, 0 },
+  { "DT_PLTPAD", DT_PLTPAD, 0 },
+  { "DT_AARCH64_BTI_PLT", DT_AARCH64_BTI_PLT, 0 },
+  { "DT_BIND_NOW", DT_BIND_NOW, 0 },
+  { "DT_INIT_ARRAY", DT_INIT_ARRAY, 0 },
+  { "DT_LOPROC", DT_LOPROC, DT_HIPROC - DT_LOPROC },
+  { "DT_RPATH", DT_RPATH, 0 },
+  { "DT_STRSZ", DT_STRSZ, 0 },
+  { "DT_PLTGOT", DT_PLTGOT, 0 },
+  { "DT_FLAGS_1", DT_FLAGS_1, 0 },
+  { "DT_HIPROC", DT_HIPROC, 0 },
+  { "DT_HASH", DT_HASH, 0 },
+  { "DT_RUNPATH", DT_RUNPATH, 0 },
+  { "DT_PLTRELSZ", DT_PLTRELSZ, 0 },
+  { "DT_VERDEFNUM", DT_VERDEFNUM, 0 },
+  { "DT_FEATURE_1", DT_FEATURE_1, 0 },
+  { "DT_ADDRRNGLO", DT_ADDRRNGLO, DT_ADDRRNGHI - DT_ADDRRNGLO },
+  { "DT_EXTRANUM", DT_EXTRANUM, 0 },
+  { "DT_CONFIG", DT_CONFIG, 0 },
+  { "DT_ADDRNUM", DT_ADDRNUM, 0 },
+  { "DT_TLSDESC_GOT", DT_TLSDESC_GOT, 0 },
+  { "DT_VALNUM", DT_VALNUM, 0 },
+  { "DT_NEEDED", DT_NEEDED, 0 },
+  { "DT_PLTPADSZ", DT_PLTPADSZ, 0 },
+  { "DT_RELACOUNT", DT_RELACOUNT, 0 },
+  { "DT_PLTREL", DT_PLTREL, 0 },
+  { "DT_PREINIT_ARRAYSZ", DT_PREINIT_ARRAYSZ, 0 },
+  { "DT_NUM", DT_NUM, 0 },
+  { "DT_SYMINENT", DT_SYMINENT, 0 },
+  { "DT_DEPAUDIT", DT_DEPAUDIT, 0 },
+  { "DT_FINI_ARRAYSZ", DT_FINI_ARRAYSZ, 0 },
+  { "DT_HIOS", DT_HIOS, 0 },
+  { "DT_RELASZ", DT_RELASZ, 0 },
+  { "DT_VERNEEDNUM", DT_VERNEEDNUM, 0 },
+  { "DT_RISCV_VARIANT_CC", DT_RISCV_VARIANT_CC, 0 },
+  { "DT_RELCOUNT", DT_RELCOUNT, 0 },
+  { "DT_SONAME", DT_SONAME, 0 },
+  { "DT_POSFLAG_1", DT_POSFLAG_1, 0 },
+  { "DT_VERNEED", DT_VERNEED, 0 },
+  { "DT_SYMENT", DT_SYMENT, 0 },
+  { "DT_LOOS", DT_LOOS, DT_HIOS - DT_LOOS },
+  { "DT_GNU_LIBLIST", DT_GNU_LIBLIST, 0 },
+  { "DT_RELENT", DT_RELENT, 0 },
+  { "DT_AARCH64_VARIANT_PCS", DT_AARCH64_VARIANT_PCS, 0 },
+  { "DT_VERSIONTAGNUM", DT_VERSIONTAGNUM, 0 },
+  { "DT_GNU_PRELINKED", DT_GNU_PRELINKED, 0 },
+  { "DT_SYMTAB", DT_SYMTAB, 0 },
+  { "DT_RELAENT", DT_RELAENT, 0 },
+  { "DT_DEBUG", DT_DEBUG, 0 },
+  { "DT_REL", DT_REL, 0 },
+  { "DT_AARCH64_NUM", DT_AARCH64_NUM, 0 },
+  { "DT_FILTER", DT_FILTER, 0 },
+  { "DT_AARCH64_PAC_PLT", DT_AARCH64_PAC_PLT, 0 },
+  { "DT_ENCODING", DT_ENCODING, 0 },
+  { "DT_GNU_CONFLICT", DT_GNU_CONFLICT, 0 },
+  { "DT_RELRENT", DT_RELRENT, 0 },
+  { "DT_SYMBOLIC", DT_SYMBOLIC, 0 },
+  { "DT_SYMTAB_SHNDX", DT_SYMTAB_SHNDX, 0 },
+};
+static struct name _na_DT_ALPHA_[] = {
+  { "DT_ALPHA_NUM", DT_ALPHA_NUM, 0 },
+  { "DT_ALPHA_PLTRO", DT_ALPHA_PLTRO, 0 },
+};
+static struct name _na_DT_IA_64_[] = {
+  { "DT_IA_64_PLT_RESERVE", DT_IA_64_PLT_RESERVE, 0 },
+  { "DT_IA_64_NUM", DT_IA_64_NUM, 0 },
+};
+static struct name _na_DT_MIPS_[] = {
+  { "DT_MIPS_NUM", DT_MIPS_NUM, 0 },
+  { "DT_MIPS_AUX_DYNAMIC", DT_MIPS_AUX_DYNAMIC, 0 },
+  { "DT_MIPS_DELTA_INSTANCE", DT_MIPS_DELTA_INSTANCE, 0 },
+  { "DT_MIPS_PIXIE_INIT", DT_MIPS_PIXIE_INIT, 0 },
+  { "DT_MIPS_DELTA_CLASS", DT_MIPS_DELTA_CLASS, 0 },
+  { "DT_MIPS_RLD_TEXT_RESOLVE_ADDR", DT_MIPS_RLD_TEXT_RESOLVE_ADDR, 0 },
+  { "DT_MIPS_HIDDEN_GOTIDX", DT_MIPS_HIDDEN_GOTIDX, 0 },
+  { "DT_MIPS_CONFLICTNO", DT_MIPS_CONFLICTNO, 0 },
+  { "DT_MIPS_RLD_MAP", DT_MIPS_RLD_MAP, 0 },
+  { "DT_MIPS_PERF_SUFFIX", DT_MIPS_PERF_SUFFIX, 0 },
+  { "DT_MIPS_LIBLISTNO", DT_MIPS_LIBLISTNO, 0 },
+  { "DT_MIPS_COMPACT_SIZE", DT_MIPS_COMPACT_SIZE, 0 },
+  { "DT_MIPS_LOCAL_GOTIDX", DT_MIPS_LOCAL_GOTIDX, 0 },
+  { "DT_MIPS_UNREFEXTNO", DT_MIPS_UNREFEXTNO, 0 },
+  { "DT_MIPS_HIPAGENO", DT_MIPS_HIPAGENO, 0 },
+  { "DT_MIPS_LIBLIST", DT_MIPS_LIBLIST, 0 },
+  { "DT_MIPS_DELTA_SYM", DT_MIPS_DELTA_SYM, 0 },
+  { "DT_MIPS_INTERFACE_SIZE", DT_MIPS_INTERFACE_SIZE, 0 },
+  { "DT_MIPS_RWPLT", DT_MIPS_RWPLT, 0 },
+  { "DT_MIPS_DELTA_SYM_NO", DT_MIPS_DELTA_SYM_NO, 0 },
+  { "DT_MIPS_DELTA_RELOC", DT_MIPS_DELTA_RELOC, 0 },
+  { "DT_MIPS_DELTA_CLASSSYM", DT_MIPS_DELTA_CLASSSYM, 0 },
+  { "DT_MIPS_DYNSTR_ALIGN", DT_MIPS_DYNSTR_ALIGN, 0 },
+  { "DT_MIPS_FLAGS", DT_MIPS_FLAGS, 0 },
+  { "DT_MIPS_LOCAL_GOTNO", DT_MIPS_LOCAL_GOTNO, 0 },
+  { "DT_MIPS_SYMTABNO", DT_MIPS_SYMTABNO, 0 },
+  { "DT_MIPS_TIME_STAMP", DT_MIPS_TIME_STAMP, 0 },
+  { "DT_MIPS_DELTA_RELOC_NO", DT_MIPS_DELTA_RELOC_NO, 0 },
+  { "DT_MIPS_IVERSION", DT_MIPS_IVERSION, 0 },
+  { "DT_MIPS_MSYM", DT_MIPS_MSYM, 0 },
+  { "DT_MIPS_PROTECTED_GOTIDX", DT_MIPS_PROTECTED_GOTIDX, 0 },
+  { "DT_MIPS_RLD_VERSION", DT_MIPS_RLD_VERSION, 0 },
+  { "DT_MIPS_GP_VALUE", DT_MIPS_GP_VALUE, 0 },
+  { "DT_MIPS_DELTA_CLASS_NO", DT_MIPS_DELTA_CLASS_NO, 0 },
+  { "DT_MIPS_DELTA_CLASSSYM_NO", DT_MIPS_DELTA_CLASSSYM_NO, 0 },
+  { "DT_MIPS_INTERFACE", DT_MIPS_INTERFACE, 0 },
+  { "DT_MIPS_DELTA_INSTANCE_NO", DT_MIPS_DELTA_INSTANCE_NO, 0 },
+  { "DT_MIPS_RLD_MAP_REL", DT_MIPS_RLD_MAP_REL, 0 },
+  { "DT_MIPS_ICHECKSUM", DT_MIPS_ICHECKSUM, 0 },
+  { "DT_MIPS_OPTIONS", DT_MIPS_OPTIONS, 0 },
+  { "DT_MIPS_CONFLICT", DT_MIPS_CONFLICT, 0 },
+  { "DT_MIPS_XHASH", DT_MIPS_XHASH, 0 },
+  { "DT_MIPS_SYMBOL_LIB", DT_MIPS_SYMBOL_LIB, 0 },
+  { "DT_MIPS_PLTGOT", DT_MIPS_PLTGOT, 0 },
+  { "DT_MIPS_CXX_FLAGS", DT_MIPS_CXX_FLAGS, 0 },
+  { "DT_MIPS_LOCALPAGE_GOTIDX", DT_MIPS_LOCALPAGE_GOTIDX, 0 },
+  { "DT_MIPS_GOTSYM", DT_MIPS_GOTSYM, 0 },
+  { "DT_MIPS_BASE_ADDRESS", DT_MIPS_BASE_ADDRESS, 0 },
+};
+static struct name _na_DT_PPC_[] = {
+  { "DT_PPC_NUM", DT_PPC_NUM, 0 },
+  { "DT_PPC_GOT", DT_PPC_GOT, 0 },
+  { "DT_PPC_OPT", DT_PPC_OPT, 0 },
+};
+static struct name _na_DT_PPC64_[] = {
+  { "DT_PPC64_NUM", DT_PPC64_NUM, 0 },
+  { "DT_PPC64_OPT", DT_PPC64_OPT, 0 },
+  { "DT_PPC64_GLINK", DT_PPC64_GLINK, 0 },
+  { "DT_PPC64_OPDSZ", DT_PPC64_OPDSZ, 0 },
+  { "DT_PPC64_OPD", DT_PPC64_OPD, 0 },
+};
+static struct name _na_DT_SPARC_[] = {
+  { "DT_SPARC_NUM", DT_SPARC_NUM, 0 },
+  { "DT_SPARC_REGISTER", DT_SPARC_REGISTER, 0 },
+};
+static struct name _na_EF_[] = {
+  { "EF_SH2A_SH3E", EF_SH2A_SH3E, 0 },
+  { "EF_SH1", EF_SH1, 0 },
+  { "EF_SH4", EF_SH4, 0 },
+  { "EF_CPU32", EF_CPU32, 0 },
+  { "EF_LARCH_OBJABI_V1", EF_LARCH_OBJABI_V1, 0 },
+  { "EF_RISCV_FLOAT_ABI_DOUBLE", EF_RISCV_FLOAT_ABI_DOUBLE, 0 },
+  { "EF_SH3", EF_SH3, 0 },
+  { "EF_SPARCV9_TSO", EF_SPARCV9_TSO, 0 },
+  { "EF_SH4A_NOFPU", EF_SH4A_NOFPU, 0 },
+  { "EF_RISCV_RVC", EF_RISCV_RVC, 0 },
+  { "EF_RISCV_RVE", EF_RISCV_RVE, 0 },
+  { "EF_SH2A_SH3_NOFPU", EF_SH2A_SH3_NOFPU, 0 },
+  { "EF_SH4_NOFPU", EF_SH4_NOFPU, 0 },
+  { "EF_CSKY_OTHER", EF_CSKY_OTHER, 0 },
+  { "EF_SH2", EF_SH2, 0 },
+  { "EF_CSKY_ABIV1", EF_CSKY_ABIV1, 0 },
+  { "EF_CSKY_ABIV2", EF_CSKY_ABIV2, 0 },
+  { "EF_SH3_DSP", EF_SH3_DSP, 0 },
+  { "EF_SH2A", EF_SH2A, 0 },
+  { "EF_SH2E", EF_SH2E, 0 },
+  { "EF_CSKY_ABIMASK", EF_CSKY_ABIMASK, 0 },
+  { "EF_SH3E", EF_SH3E, 0 },
+  { "EF_SH4A", EF_SH4A, 0 },
+  { "EF_RISCV_TSO", EF_RISCV_TSO, 0 },
+  { "EF_S390_HIGH_GPRS", EF_S390_HIGH_GPRS, 0 },
+  { "EF_SPARCV9_PSO", EF_SPARCV9_PSO, 0 },
+  { "EF_CSKY_PROCESSOR", EF_CSKY_PROCESSOR, 0 },
+  { "EF_SPARCV9_RMO", EF_SPARCV9_RMO, 0 },
+  { "EF_SH2A_SH4_NOFPU", EF_SH2A_SH4_NOFPU, 0 },
+  { "EF_SH3_NOMMU", EF_SH3_NOMMU, 0 },
+  { "EF_SH4AL_DSP", EF_SH4AL_DSP, 0 },
+  { "EF_SH4_NOMMU_NOFPU", EF_SH4_NOMMU_NOFPU, 0 },
+  { "EF_RISCV_FLOAT_ABI_SOFT", EF_RISCV_FLOAT_ABI_SOFT, 0 },
+  { "EF_RISCV_FLOAT_ABI_QUAD", EF_RISCV_FLOAT_ABI_QUAD, 0 },
+  { "EF_RISCV_FLOAT_ABI", EF_RISCV_FLOAT_ABI, 0 },
+  { "EF_SH2A_SH4", EF_SH2A_SH4, 0 },
+  { "EF_SPARCV9_MM", EF_SPARCV9_MM, 0 },
+  { "EF_LARCH_ABI_MODIFIER_MASK", EF_LARCH_ABI_MODIFIER_MASK, 0 },
+  { "EF_LARCH_ABI_SOFT_FLOAT", EF_LARCH_ABI_SOFT_FLOAT, 0 },
+  { "EF_SH2A_NOFPU", EF_SH2A_NOFPU, 0 },
+  { "EF_RISCV_FLOAT_ABI_SINGLE", EF_RISCV_FLOAT_ABI_SINGLE, 0 },
+  { "EF_LARCH_ABI_SINGLE_FLOAT", EF_LARCH_ABI_SINGLE_FLOAT, 0 },
+  { "EF_LARCH_ABI_DOUBLE_FLOAT", EF_LARCH_ABI_DOUBLE_FLOAT, 0 },
+};
+static struct name _na_EF_ALPHA_[] = {
+  { "EF_ALPHA_32BIT", EF_ALPHA_32BIT, 0 },
+  { "EF_ALPHA_CANRELAX", EF_ALPHA_CANRELAX, 0 },
+};
+static struct name _na_EF_ARM_[] = {
+  { "EF_ARM_ABI_FLOAT_HARD", EF_ARM_ABI_FLOAT_HARD, 0 },
+  { "EF_ARM_ABI_FLOAT_SOFT", EF_ARM_ABI_FLOAT_SOFT, 0 },
+  { "EF_ARM_EABI_UNKNOWN", EF_ARM_EABI_UNKNOWN, 0 },
+  { "EF_ARM_DYNSYMSUSESEGIDX", EF_ARM_DYNSYMSUSESEGIDX, 0 },
+  { "EF_ARM_EABIMASK", EF_ARM_EABIMASK, 0 },
+  { "EF_ARM_VFP_FLOAT", EF_ARM_VFP_FLOAT, 0 },
+  { "EF_ARM_SYMSARESORTED", EF_ARM_SYMSARESORTED, 0 },
+  { "EF_ARM_OLD_ABI", EF_ARM_OLD_ABI, 0 },
+  { "EF_ARM_MAPSYMSFIRST", EF_ARM_MAPSYMSFIRST, 0 },
+  { "EF_ARM_BE8", EF_ARM_BE8, 0 },
+  { "EF_ARM_EABI_VER1", EF_ARM_EABI_VER1, 0 },
+  { "EF_ARM_EABI_VER2", EF_ARM_EABI_VER2, 0 },
+  { "EF_ARM_EABI_VER3", EF_ARM_EABI_VER3, 0 },
+  { "EF_ARM_EABI_VER5", EF_ARM_EABI_VER5, 0 },
+  { "EF_ARM_RELEXEC", EF_ARM_RELEXEC, 0 },
+  { "EF_ARM_HASENTRY", EF_ARM_HASENTRY, 0 },
+  { "EF_ARM_APCS_FLOAT", EF_ARM_APCS_FLOAT, 0 },
+  { "EF_ARM_INTERWORK", EF_ARM_INTERWORK, 0 },
+  { "EF_ARM_ALIGN8", EF_ARM_ALIGN8, 0 },
+  { "EF_ARM_PIC", EF_ARM_PIC, 0 },
+  { "EF_ARM_SOFT_FLOAT", EF_ARM_SOFT_FLOAT, 0 },
+  { "EF_ARM_LE8", EF_ARM_LE8, 0 },
+  { "EF_ARM_NEW_ABI", EF_ARM_NEW_ABI, 0 },
+  { "EF_ARM_EABI_VER4", EF_ARM_EABI_VER4, 0 },
+  { "EF_ARM_APCS_26", EF_ARM_APCS_26, 0 },
+  { "EF_ARM_MAVERICK_FLOAT", EF_ARM_MAVERICK_FLOAT, 0 },
+};
+static struct name _na_EF_HP_[] = {
+  { "EF_PARISC_ARCH", EF_PARISC_ARCH, 0 },
+  { "EF_PARISC_LAZYSWAP", EF_PARISC_LAZYSWAP, 0 },
+  { "EF_PARISC_TRAPNIL", EF_PARISC_TRAPNIL, 0 },
+  { "EF_PARISC_WIDE", EF_PARISC_WIDE, 0 },
+  { "EF_PARISC_NO_KABP", EF_PARISC_NO_KABP, 0 },
+  { "EF_PARISC_LSB", EF_PARISC_LSB, 0 },
+  { "EF_PARISC_EXT", EF_PARISC_EXT, 0 },
+};
+static struct name _na_EF_IA_64_[] = {
+  { "EF_IA_64_MASKOS", EF_IA_64_MASKOS, 0 },
+  { "EF_IA_64_ABI64", EF_IA_64_ABI64, 0 },
+  { "EF_IA_64_ARCH", EF_IA_64_ARCH, 0 },
+};
+static struct name _na_EF_MIPS_[] = {
+  { "EF_MIPS_ARCH_2", EF_MIPS_ARCH_2, 0 },
+  { "EF_MIPS_ARCH_64R2", EF_MIPS_ARCH_64R2, 0 },
+  { "EF_MIPS_ABI_ON32", EF_MIPS_ABI_ON32, 0 },
+  { "EF_MIPS_64BIT_WHIRL", EF_MIPS_64BIT_WHIRL, 0 },
+  { "EF_MIPS_ARCH", EF_MIPS_ARCH, 0 },
+  { "EF_MIPS_PIC", EF_MIPS_PIC, 0 },
+  { "EF_MIPS_ARCH_64", EF_MIPS_ARCH_64, 0 },
+  { "EF_MIPS_FP64", EF_MIPS_FP64, 0 },
+  { "EF_MIPS_CPIC", EF_MIPS_CPIC, 0 },
+  { "EF_MIPS_ARCH_32R2", EF_MIPS_ARCH_32R2, 0 },
+  { "EF_MIPS_ARCH_1", EF_MIPS_ARCH_1, 0 },
+  { "EF_MIPS_ARCH_3", EF_MIPS_ARCH_3, 0 },
+  { "EF_MIPS_ARCH_4", EF_MIPS_ARCH_4, 0 },
+  { "EF_MIPS_ARCH_32", EF_MIPS_ARCH_32, 0 },
+  { "EF_MIPS_ARCH_5", EF_MIPS_ARCH_5, 0 },
+  { "EF_MIPS_ABI2", EF_MIPS_ABI2, 0 },
+  { "EF_MIPS_NOREORDER", EF_MIPS_NOREORDER, 0 },
+  { "EF_MIPS_XGOT", EF_MIPS_XGOT, 0 },
+  { "EF_MIPS_NAN2008", EF_MIPS_NAN2008, 0 },
+};
+static struct name _na_EF_PPC_[] = {
+  { "EF_PPC_RELOCATABLE_LIB", EF_PPC_RELOCATABLE_LIB, 0 },
+  { "EF_PPC_EMB", EF_PPC_EMB, 0 },
+  { "EF_PPC_RELOCATABLE", EF_PPC_RELOCATABLE, 0 },
+};
+static struct name _na_EF_PPC64_[] = {
+  { "EF_PPC64_ABI", EF_PPC64_ABI, 0 },
+};
+static struct name _na_EF_SH_[] = {
+  { "EF_SH_DSP", EF_SH_DSP, 0 },
+  { "EF_SH_MACH_MASK", EF_SH_MACH_MASK, 0 },
+  { "EF_SH_UNKNOWN", EF_SH_UNKNOWN, 0 },
+};
+static struct name _na_EF_SPARC_[] = {
+  { "EF_SPARC_HAL_R1", EF_SPARC_HAL_R1, 0 },
+  { "EF_SPARC_SUN_US1", EF_SPARC_SUN_US1, 0 },
+  { "EF_SPARC_SUN_US3", EF_SPARC_SUN_US3, 0 },
+  { "EF_SPARC_EXT_MASK", EF_SPARC_EXT_MASK, 0 },
+  { "EF_SPARC_LEDATA", EF_SPARC_LEDATA, 0 },
+  { "EF_SPARC_32PLUS", EF_SPARC_32PLUS, 0 },
+};
+static struct name _na_ELFCLASS[] = {
+  { "ELFCLASS32", ELFCLASS32, 0 },
+  { "ELFCLASSNONE", ELFCLASSNONE, 0 },
+  { "ELFCLASS64", ELFCLASS64, 0 },
+  { "ELFCLASSNUM", ELFCLASSNUM, 0 },
+};
+static struct name _na_ELFDATA[] = {
+  { "ELFDATANUM", ELFDATANUM, 0 },
+  { "ELFDATA2LSB", ELFDATA2LSB, 0 },
+  { "ELFDATA2MSB", ELFDATA2MSB, 0 },
+  { "ELFDATANONE", ELFDATANONE, 0 },
+};
+static struct name _na_ELFMAG[] = {
+  { "ELFMAG0", ELFMAG0, 0 },
+  { "ELFMAG1", ELFMAG1, 0 },
+  { "ELFMAG2", ELFMAG2, 0 },
+  { "ELFMAG3", ELFMAG3, 0 },
+};
+static struct name _na_ELFOSABI_[] = {
+  { "ELFOSABI_TRU64", ELFOSABI_TRU64, 0 },
+  { "ELFOSABI_STANDALONE", ELFOSABI_STANDALONE, 0 },
+  { "ELFOSABI_AIX", ELFOSABI_AIX, 0 },
+  { "ELFOSABI_ARM", ELFOSABI_ARM, 0 },
+  { "ELFOSABI_NETBSD", ELFOSABI_NETBSD, 0 },
+  { "ELFOSABI_FREEBSD", ELFOSABI_FREEBSD, 0 },
+  { "ELFOSABI_SYSV", ELFOSABI_SYSV, 0 },
+  { "ELFOSABI_NONE", ELFOSABI_NONE, 0 },
+  { "ELFOSABI_IRIX", ELFOSABI_IRIX, 0 },
+  { "ELFOSABI_MODESTO", ELFOSABI_MODESTO, 0 },
+  { "ELFOSABI_LINUX", ELFOSABI_LINUX, 0 },
+  { "ELFOSABI_HPUX", ELFOSABI_HPUX, 0 },
+  { "ELFOSABI_OPENBSD", ELFOSABI_OPENBSD, 0 },
+  { "ELFOSABI_SOLARIS", ELFOSABI_SOLARIS, 0 },
+  { "ELFOSABI_GNU", ELFOSABI_GNU, 0 },
+};
+static struct name _na_ELFOSABI_ARM_[] = {
+  { "ELFOSABI_ARM_AEABI", ELFOSABI_ARM_AEABI, 0 },
+};
+static struct name _na_ELF_NOTE_OS_[] = {
+  { "ELF_NOTE_OS_SOLARIS2", ELF_NOTE_OS_SOLARIS2, 0 },
+  { "ELF_NOTE_OS_GNU", ELF_NOTE_OS_GNU, 0 },
+  { "ELF_NOTE_OS_FREEBSD", ELF_NOTE_OS_FREEBSD, 0 },
+  { "ELF_NOTE_OS_LINUX", ELF_NOTE_OS_LINUX, 0 },
+};
+static struct name _na_EM_[] = {
+  { "EM_78KOR", EM_78KOR, 0 },
+  { "EM_FR30", EM_FR30, 0 },
+  { "EM_STXP7X", EM_STXP7X, 0 },
+  { "EM_NCPU", EM_NCPU, 0 },
+  { "EM_SE_C17", EM_SE_C17, 0 },
+  { "EM_SE_C33", EM_SE_C33, 0 },
+  { "EM_TI_C5500", EM_TI_C5500, 0 },
+  { "EM_SNP1K", EM_SNP1K, 0 },
+  { "EM_IA_64", EM_IA_64, 0 },
+  { "EM_C166", EM_C166, 0 },
+  { "EM_CSR_KALIMBA", EM_CSR_KALIMBA, 0 },
+  { "EM_860", EM_860, 0 },
+  { "EM_ARC_A5", EM_ARC_A5, 0 },
+  { "EM_H8_500", EM_H8_500, 0 },
+  { "EM_CR16", EM_CR16, 0 },
+  { "EM_XIMO16", EM_XIMO16, 0 },
+  { "EM_CLOUDSHIELD", EM_CLOUDSHIELD, 0 },
+  { "EM_ME16", EM_ME16, 0 },
+  { "EM_56800EX", EM_56800EX, 0 },
+  { "EM_MOXIE", EM_MOXIE, 0 },
+  { "EM_ST9PLUS", EM_ST9PLUS, 0 },
+  { "EM_M32C", EM_M32C, 0 },
+  { "EM_CDP", EM_CDP, 0 },
+  { "EM_LOONGARCH", EM_LOONGARCH, 0 },
+  { "EM_FR20", EM_FR20, 0 },
+  { "EM_OPEN8", EM_OPEN8, 0 },
+  { "EM_D30V", EM_D30V, 0 },
+  { "EM_M32R", EM_M32R, 0 },
+  { "EM_CRIS", EM_CRIS, 0 },
+  { "EM_DXP", EM_DXP, 0 },
+  { "EM_MSP430", EM_MSP430, 0 },
+  { "EM_CRX", EM_CRX, 0 },
+  { "EM_ECOG16", EM_ECOG16, 0 },
+  { "EM_ECOG1X", EM_ECOG1X, 0 },
+  { "EM_S390", EM_S390, 0 },
+  { "EM_XGATE", EM_XGATE, 0 },
+  { "EM_NUM", EM_NUM, 0 },
+  { "EM_COREA_1ST", EM_COREA_1ST, 0 },
+  { "EM_CE", EM_CE, 0 },
+  { "EM_CR", EM_CR, 0 },
+  { "EM_CYPRESS_M8C", EM_CYPRESS_M8C, 0 },
+  { "EM_AVR32", EM_AVR32, 0 },
+  { "EM_RCE", EM_RCE, 0 },
+  { "EM_L10M", EM_L10M, 0 },
+  { "EM_NS32K", EM_NS32K, 0 },
+  { "EM_FIREPATH", EM_FIREPATH, 0 },
+  { "EM_PJ", EM_PJ, 0 },
+  { "EM_AMDGPU", EM_AMDGPU, 0 },
+  { "EM_XTENSA", EM_XTENSA, 0 },
+  { "EM_CRAYNV2", EM_CRAYNV2, 0 },
+  { "EM_RX", EM_RX, 0 },
+  { "EM_SH", EM_SH, 0 },
+  { "EM_Z80", EM_Z80, 0 },
+  { "EM_TMM_GPP", EM_TMM_GPP, 0 },
+  { "EM_ALTERA_NIOS2", EM_ALTERA_NIOS2, 0 },
+  { "EM_NONE", EM_NONE, 0 },
+  { "EM_NDR1", EM_NDR1, 0 },
+  { "EM_MIPS", EM_MIPS, 0 },
+  { "EM_PARISC", EM_PARISC, 0 },
+  { "EM_NORC", EM_NORC, 0 },
+  { "EM_S370", EM_S370, 0 },
+  { "EM_TILEPRO", EM_TILEPRO, 0 },
+  { "EM_VAX", EM_VAX, 0 },
+  { "EM_ST19", EM_ST19, 0 },
+  { "EM_960", EM_960, 0 },
+  { "EM_NDS32", EM_NDS32, 0 },
+  { "EM_ST7", EM_ST7, 0 },
+  { "EM_COGE", EM_COGE, 0 },
+  { "EM_VIDEOCORE5", EM_VIDEOCORE5, 0 },
+  { "EM_SLE9X", EM_SLE9X, 0 },
+  { "EM_HUANY", EM_HUANY, 0 },
+  { "EM_68HC05", EM_68HC05, 0 },
+  { "EM_MMIX", EM_MMIX, 0 },
+  { "EM_COOL", EM_COOL, 0 },
+  { "EM_MCST_ELBRUS", EM_MCST_ELBRUS, 0 },
+  { "EM_ARCV2", EM_ARCV2, 0 },
+  { "EM_IAMCU", EM_IAMCU, 0 },
+  { "EM_D10V", EM_D10V, 0 },
+  { "EM_MANIK", EM_MANIK, 0 },
+  { "EM_SPARCV9", EM_SPARCV9, 0 },
+  { "EM_MIPS_RS3_LE", EM_MIPS_RS3_LE, 0 },
+  { "EM_FAKE_ALPHA", EM_FAKE_ALPHA, 0 },
+  { "EM_SPARC", EM_SPARC, 0 },
+  { "EM_68HC11", EM_68HC11, 0 },
+  { "EM_DSPIC30F", EM_DSPIC30F, 0 },
+  { "EM_RISCV", EM_RISCV, 0 },
+  { "EM_STM8", EM_STM8, 0 },
+  { "EM_METAG", EM_METAG, 0 },
+  { "EM_ARCA", EM_ARCA, 0 },
+  { "EM_PPC64", EM_PPC64, 0 },
+  { "EM_68HC12", EM_68HC12, 0 },
+  { "EM_68HC16", EM_68HC16, 0 },
+  { "EM_MIPS_X", EM_MIPS_X, 0 },
+  { "EM_CSKY", EM_CSKY, 0 },
+  { "EM_H8S", EM_H8S, 0 },
+  { "EM_ARC_COMPACT", EM_ARC_COMPACT, 0 },
+  { "EM_KMX32", EM_KMX32, 0 },
+  { "EM_COREA_2ND", EM_COREA_2ND, 0 },
+  { "EM_MN10200", EM_MN10200, 0 },
+  { "EM_ZSP", EM_ZSP, 0 },
+  { "EM_TRIMEDIA", EM_TRIMEDIA, 0 },
+  { "EM_X86_64", EM_X86_64, 0 },
+  { "EM_BLACKFIN", EM_BLACKFIN, 0 },
+  { "EM_KVARC", EM_KVARC, 0 },
+  { "EM_H8_300", EM_H8_300, 0 },
+  { "EM_SEP", EM_SEP, 0 },
+  { "EM_68K", EM_68K, 0 },
+  { "EM_TI_PRU", EM_TI_PRU, 0 },
+  { "EM_UNICORE", EM_UNICORE, 0 },
+  { "EM_VISIUM", EM_VISIUM, 0 },
+  { "EM_VIDEOCORE3", EM_VIDEOCORE3, 0 },
+  { "EM_KM32", EM_KM32, 0 },
+  { "EM_QDSP6", EM_QDSP6, 0 },
+  { "EM_SPU", EM_SPU, 0 },
+  { "EM_EMX8", EM_EMX8, 0 },
+  { "EM_TSK3000", EM_TSK3000, 0 },
+  { "EM_SVX", EM_SVX, 0 },
+  { "EM_TI_C2000", EM_TI_C2000, 0 },
+  { "EM_TILE64", EM_TILE64, 0 },
+  { "EM_XCORE", EM_XCORE, 0 },
+  { "EM_H8_300H", EM_H8_300H, 0 },
+  { "EM_M16C", EM_M16C, 0 },
+  { "EM_ARC", EM_ARC, 0 },
+  { "EM_ARM", EM_ARM, 0 },
+  { "EM_SCORE7", EM_SCORE7, 0 },
+  { "EM_MICROBLAZE", EM_MICROBLAZE, 0 },
+  { "EM_AVR", EM_AVR, 0 },
+  { "EM_IP2K", EM_IP2K, 0 },
+  { "EM_SPARC32PLUS", EM_SPARC32PLUS, 0 },
+  { "EM_TILEGX", EM_TILEGX, 0 },
+  { "EM_ST100", EM_ST100, 0 },
+  { "EM_PDP10", EM_PDP10, 0 },
+  { "EM_INTELGT", EM_INTELGT, 0 },
+  { "EM_PCP", EM_PCP, 0 },
+  { "EM_MCHP_PIC", EM_MCHP_PIC, 0 },
+  { "EM_RH32", EM_RH32, 0 },
+  { "EM_RS08", EM_RS08, 0 },
+  { "EM_FT32", EM_FT32, 0 },
+  { "EM_386", EM_386, 0 },
+  { "EM_PDSP", EM_PDSP, 0 },
+  { "EM_F2MC16", EM_F2MC16, 0 },
+  { "EM_MAXQ30", EM_MAXQ30, 0 },
+  { "EM_V800", EM_V800, 0 },
+  { "EM_TI_C6000", EM_TI_C6000, 0 },
+  { "EM_ALPHA", EM_ALPHA, 0 },
+  { "EM_MMA", EM_MMA, 0 },
+  { "EM_PPC", EM_PPC, 0 },
+  { "EM_LATTICEMICO32", EM_LATTICEMICO32, 0 },
+  { "EM_V850", EM_V850, 0 },
+  { "EM_PDP11", EM_PDP11, 0 },
+  { "EM_MN10300", EM_MN10300, 0 },
+  { "EM_88K", EM_88K, 0 },
+  { "EM_TPC", EM_TPC, 0 },
+  { "EM_AARCH64", EM_AARCH64, 0 },
+  { "EM_JAVELIN", EM_JAVELIN, 0 },
+  { "EM_VIDEOCORE", EM_VIDEOCORE, 0 },
+  { "EM_TINYJ", EM_TINYJ, 0 },
+  { "EM_M32", EM_M32, 0 },
+  { "EM_RL78", EM_RL78, 0 },
+  { "EM_COLDFIRE", EM_COLDFIRE, 0 },
+  { "EM_8051", EM_8051, 0 },
+  { "EM_TI_ARP32", EM_TI_ARP32, 0 },
+  { "EM_BA1", EM_BA1, 0 },
+  { "EM_BA2", EM_BA2, 0 },
+  { "EM_MAX", EM_MAX, 0 },
+  { "EM_STARCORE", EM_STARCORE, 0 },
+  { "EM_K10M", EM_K10M, 0 },
+  { "EM_FX66", EM_FX66, 0 },
+  { "EM_EMX16", EM_EMX16, 0 },
+  { "EM_MMDSP_PLUS", EM_MMDSP_PLUS, 0 },
+  { "EM_ETPU", EM_ETPU, 0 },
+  { "EM_BPF", EM_BPF, 0 },
+  { "EM_PRISM", EM_PRISM, 0 },
+  { "EM_VPP500", EM_VPP500, 0 },
+  { "EM_SHARC", EM_SHARC, 0 },
+  { "EM_DSP24", EM_DSP24, 0 },
+  { "EM_R32C", EM_R32C, 0 },
+  { "EM_68HC08", EM_68HC08, 0 },
+  { "EM_ECOG2", EM_ECOG2, 0 },
+  { "EM_TRICORE", EM_TRICORE, 0 },
+  { "EM_ST200", EM_ST200, 0 },
+  { "EM_EXCESS", EM_EXCESS, 0 },
+  { "EM_OPENRISC", EM_OPENRISC, 0 },
+  { "EM_CUDA", EM_CUDA, 0 },
+};
+static struct name _na_ET_[] = {
+  { "ET_DYN", ET_DYN, 0 },
+  { "ET_CORE", ET_CORE, 0 },
+  { "ET_LOPROC", ET_LOPROC, ET_HIPROC - ET_LOPROC },
+  { "ET_EXEC", ET_EXEC, 0 },
+  { "ET_HIOS", ET_HIOS, 0 },
+  { "ET_HIPROC", ET_HIPROC, 0 },
+  { "ET_LOOS", ET_LOOS, ET_HIOS - ET_LOOS },
+  { "ET_REL", ET_REL, 0 },
+  { "ET_NUM", ET_NUM, 0 },
+  { "ET_NONE", ET_NONE, 0 },
+};
+static struct name _na_EV_[] = {
+  { "EV_CURRENT", EV_CURRENT, 0 },
+  { "EV_NONE", EV_NONE, 0 },
+  { "EV_NUM", EV_NUM, 0 },
+};
+static struct name _na_NT_[] = {
+  { "NT_SIGINFO", NT_SIGINFO, 0 },
+  { "NT_PRFPREG", NT_PRFPREG, 0 },
+  { "NT_S390_VXRS_LOW", NT_S390_VXRS_LOW, 0 },
+  { "NT_GWINDOWS", NT_GWINDOWS, 0 },
+  { "NT_S390_LAST_BREAK", NT_S390_LAST_BREAK, 0 },
+  { "NT_PRPSINFO", NT_PRPSINFO, 0 },
+  { "NT_X86_XSTATE", NT_X86_XSTATE, 0 },
+  { "NT_PRSTATUS", NT_PRSTATUS, 0 },
+  { "NT_S390_TDB", NT_S390_TDB, 0 },
+  { "NT_LWPSTATUS", NT_LWPSTATUS, 0 },
+  { "NT_S390_TODCMP", NT_S390_TODCMP, 0 },
+  { "NT_PSTATUS", NT_PSTATUS, 0 },
+  { "NT_S390_CTRS", NT_S390_CTRS, 0 },
+  { "NT_LWPSINFO", NT_LWPSINFO, 0 },
+  { "NT_PRCRED", NT_PRCRED, 0 },
+  { "NT_PSINFO", NT_PSINFO, 0 },
+  { "NT_VMCOREDD", NT_VMCOREDD, 0 },
+  { "NT_UTSNAME", NT_UTSNAME, 0 },
+  { "NT_AUXV", NT_AUXV, 0 },
+  { "NT_PRXFPREG", NT_PRXFPREG, 0 },
+  { "NT_TASKSTRUCT", NT_TASKSTRUCT, 0 },
+  { "NT_S390_VXRS_HIGH", NT_S390_VXRS_HIGH, 0 },
+  { "NT_S390_TIMER", NT_S390_TIMER, 0 },
+  { "NT_VERSION", NT_VERSION, 0 },
+  { "NT_FDO_PACKAGING_METADATA", NT_FDO_PACKAGING_METADATA, 0 },
+  { "NT_S390_RI_CB", NT_S390_RI_CB, 0 },
+  { "NT_FPREGSET", NT_FPREGSET, 0 },
+  { "NT_ASRS", NT_ASRS, 0 },
+  { "NT_PRFPXREG", NT_PRFPXREG, 0 },
+  { "NT_S390_PREFIX", NT_S390_PREFIX, 0 },
+  { "NT_FILE", NT_FILE, 0 },
+  { "NT_S390_SYSTEM_CALL", NT_S390_SYSTEM_CALL, 0 },
+  { "NT_S390_TODPREG", NT_S390_TODPREG, 0 },
+  { "NT_PRXREG", NT_PRXREG, 0 },
+  { "NT_S390_GS_BC", NT_S390_GS_BC, 0 },
+  { "NT_S390_GS_CB", NT_S390_GS_CB, 0 },
+  { "NT_PLATFORM", NT_PLATFORM, 0 },
+  { "NT_S390_HIGH_GPRS", NT_S390_HIGH_GPRS, 0 },
+};
+static struct name _na_NT_386_[] = {
+  { "NT_386_TLS", NT_386_TLS, 0 },
+  { "NT_386_IOPERM", NT_386_IOPERM, 0 },
+};
+static struct name _na_NT_ARM_[] = {
+  { "NT_ARM_SYSTEM_CALL", NT_ARM_SYSTEM_CALL, 0 },
+  { "NT_ARM_TLS", NT_ARM_TLS, 0 },
+  { "NT_ARM_PAC_ENABLED_KEYS", NT_ARM_PAC_ENABLED_KEYS, 0 },
+  { "NT_ARM_PAC_MASK", NT_ARM_PAC_MASK, 0 },
+  { "NT_ARM_TAGGED_ADDR_CTRL", NT_ARM_TAGGED_ADDR_CTRL, 0 },
+  { "NT_ARM_HW_BREAK", NT_ARM_HW_BREAK, 0 },
+  { "NT_ARM_HW_WATCH", NT_ARM_HW_WATCH, 0 },
+  { "NT_ARM_VFP", NT_ARM_VFP, 0 },
+  { "NT_ARM_PACA_KEYS", NT_ARM_PACA_KEYS, 0 },
+  { "NT_ARM_SVE", NT_ARM_SVE, 0 },
+  { "NT_ARM_PACG_KEYS", NT_ARM_PACG_KEYS, 0 },
+};
+static struct name _na_NT_MIPS_[] = {
+  { "NT_MIPS_FP_MODE", NT_MIPS_FP_MODE, 0 },
+  { "NT_MIPS_DSP", NT_MIPS_DSP, 0 },
+  { "NT_MIPS_MSA", NT_MIPS_MSA, 0 },
+};
+static struct name _na_NT_PPC_[] = {
+  { "NT_PPC_TM_CTAR", NT_PPC_TM_CTAR, 0 },
+  { "NT_PPC_TM_CGPR", NT_PPC_TM_CGPR, 0 },
+  { "NT_PPC_TM_CFPR", NT_PPC_TM_CFPR, 0 },
+  { "NT_PPC_TM_CVMX", NT_PPC_TM_CVMX, 0 },
+  { "NT_PPC_VSX", NT_PPC_VSX, 0 },
+  { "NT_PPC_VMX", NT_PPC_VMX, 0 },
+  { "NT_PPC_TM_CDSCR", NT_PPC_TM_CDSCR, 0 },
+  { "NT_PPC_TM_CVSX", NT_PPC_TM_CVSX, 0 },
+  { "NT_PPC_DSCR", NT_PPC_DSCR, 0 },
+  { "NT_PPC_TM_SPR", NT_PPC_TM_SPR, 0 },
+  { "NT_PPC_PKEY", NT_PPC_PKEY, 0 },
+  { "NT_PPC_SPE", NT_PPC_SPE, 0 },
+  { "NT_PPC_TAR", NT_PPC_TAR, 0 },
+  { "NT_PPC_EBB", NT_PPC_EBB, 0 },
+  { "NT_PPC_PMU", NT_PPC_PMU, 0 },
+  { "NT_PPC_PPR", NT_PPC_PPR, 0 },
+  { "NT_PPC_TM_CPPR", NT_PPC_TM_CPPR, 0 },
+};
+static struct name _na_NT_GNU_[] = {
+  { "NT_GNU_BUILD_ID", NT_GNU_BUILD_ID, 0 },
+  { "NT_GNU_ABI_TAG", NT_GNU_ABI_TAG, 0 },
+  { "NT_GNU_HWCAP", NT_GNU_HWCAP, 0 },
+  { "NT_GNU_PROPERTY_TYPE_0", NT_GNU_PROPERTY_TYPE_0, 0 },
+  { "NT_GNU_GOLD_VERSION", NT_GNU_GOLD_VERSION, 0 },
+};
+static struct name _na_PF_[] = {
+  { "PF_MASKOS", PF_MASKOS, 0 },
+  { "PF_MASKPROC", PF_MASKPROC, 0 },
+  { "PF_R", PF_R, 0 },
+  { "PF_W", PF_W, 0 },
+  { "PF_X", PF_X, 0 },
+};
+static struct name _na_PF_ARM_[] = {
+  { "PF_ARM_PI", PF_ARM_PI, 0 },
+  { "PF_ARM_SB", PF_ARM_SB, 0 },
+  { "PF_ARM_ABS", PF_ARM_ABS, 0 },
+};
+static struct name _na_PF_HP_[] = {
+  { "PF_HP_SBP", PF_HP_SBP, 0 },
+  { "PF_HP_MODIFY", PF_HP_MODIFY, 0 },
+  { "PF_HP_PAGE_SIZE", PF_HP_PAGE_SIZE, 0 },
+  { "PF_PARISC_SBP", PF_PARISC_SBP, 0 },
+  { "PF_HP_CODE", PF_HP_CODE, 0 },
+  { "PF_HP_NEAR_SHARED", PF_HP_NEAR_SHARED, 0 },
+  { "PF_HP_LAZYSWAP", PF_HP_LAZYSWAP, 0 },
+  { "PF_HP_FAR_SHARED", PF_HP_FAR_SHARED, 0 },
+};
+static struct name _na_PF_IA_64_[] = {
+  { "PF_IA_64_NORECOV", PF_IA_64_NORECOV, 0 },
+};
+static struct name _na_PF_MIPS_[] = {
+  { "PF_MIPS_LOCAL", PF_MIPS_LOCAL, 0 },
+};
+static struct name _na_PT_[] = {
+  { "PT_NULL", PT_NULL, 0 },
+  { "PT_GNU_PROPERTY", PT_GNU_PROPERTY, 0 },
+  { "PT_GNU_STACK", PT_GNU_STACK, 0 },
+  { "PT_INTERP", PT_INTERP, 0 },
+  { "PT_PHDR", PT_PHDR, 0 },
+  { "PT_LOSUNW", PT_LOSUNW, PT_HISUNW - PT_LOSUNW },
+  { "PT_DYNAMIC", PT_DYNAMIC, 0 },
+  { "PT_NOTE", PT_NOTE, 0 },
+  { "PT_SHLIB", PT_SHLIB, 0 },
+  { "PT_HISUNW", PT_HISUNW, 0 },
+  { "PT_GNU_EH_FRAME", PT_GNU_EH_FRAME, 0 },
+  { "PT_TLS", PT_TLS, 0 },
+  { "PT_LOPROC", PT_LOPROC, PT_HIPROC - PT_LOPROC },
+  { "PT_HIPROC", PT_HIPROC, 0 },
+  { "PT_SUNWSTACK", PT_SUNWSTACK, 0 },
+  { "PT_HIOS", PT_HIOS, 0 },
+  { "PT_LOAD", PT_LOAD, 0 },
+  { "PT_RISCV_ATTRIBUTES", PT_RISCV_ATTRIBUTES, 0 },
+  { "PT_LOOS", PT_LOOS, PT_HIOS - PT_LOOS },
+  { "PT_SUNWBSS", PT_SUNWBSS, 0 },
+  { "PT_AARCH64_MEMTAG_MTE", PT_AARCH64_MEMTAG_MTE, 0 },
+  { "PT_NUM", PT_NUM, 0 },
+  { "PT_GNU_RELRO", PT_GNU_RELRO, 0 },
+};
+static struct name _na_PT_ARM_[] = {
+  { "PT_ARM_EXIDX", PT_ARM_EXIDX, 0 },
+};
+static struct name _na_PT_HP_[] = {
+  { "PT_HP_CORE_VERSION", PT_HP_CORE_VERSION, 0 },
+  { "PT_HP_CORE_NONE", PT_HP_CORE_NONE, 0 },
+  { "PT_PARISC_UNWIND", PT_PARISC_UNWIND, 0 },
+  { "PT_HP_OPT_ANNOT", PT_HP_OPT_ANNOT, 0 },
+  { "PT_PARISC_ARCHEXT", PT_PARISC_ARCHEXT, 0 },
+  { "PT_HP_CORE_LOADABLE", PT_HP_CORE_LOADABLE, 0 },
+  { "PT_HP_CORE_MMF", PT_HP_CORE_MMF, 0 },
+  { "PT_HP_FASTBIND", PT_HP_FASTBIND, 0 },
+  { "PT_HP_HSL_ANNOT", PT_HP_HSL_ANNOT, 0 },
+  { "PT_HP_CORE_STACK", PT_HP_CORE_STACK, 0 },
+  { "PT_HP_CORE_PROC", PT_HP_CORE_PROC, 0 },
+  { "PT_HP_TLS", PT_HP_TLS, 0 },
+  { "PT_HP_CORE_COMM", PT_HP_CORE_COMM, 0 },
+  { "PT_HP_PARALLEL", PT_HP_PARALLEL, 0 },
+  { "PT_HP_STACK", PT_HP_STACK, 0 },
+  { "PT_HP_CORE_KERNEL", PT_HP_CORE_KERNEL, 0 },
+  { "PT_HP_CORE_SHM", PT_HP_CORE_SHM, 0 },
+};
+static struct name _na_PT_IA_64_[] = {
+  { "PT_IA_64_HP_OPT_ANOT", PT_IA_64_HP_OPT_ANOT, 0 },
+  { "PT_IA_64_UNWIND", PT_IA_64_UNWIND, 0 },
+  { "PT_IA_64_ARCHEXT", PT_IA_64_ARCHEXT, 0 },
+  { "PT_IA_64_HP_STACK", PT_IA_64_HP_STACK, 0 },
+  { "PT_IA_64_HP_HSL_ANOT", PT_IA_64_HP_HSL_ANOT, 0 },
+};
+static struct name _na_PT_MIPS_[] = {
+  { "PT_MIPS_ABIFLAGS", PT_MIPS_ABIFLAGS, 0 },
+  { "PT_MIPS_OPTIONS", PT_MIPS_OPTIONS, 0 },
+  { "PT_MIPS_REGINFO", PT_MIPS_REGINFO, 0 },
+  { "PT_MIPS_RTPROC", PT_MIPS_RTPROC, 0 },
+};
+static struct name _na_R_[] = {
+  { "R_ARC_GOTPC", R_ARC_GOTPC, 0 },
+  { "R_TILEGX_IMM8_X1_TLS_ADD", R_TILEGX_IMM8_X1_TLS_ADD, 0 },
+  { "R_NIOS2_LO16", R_NIOS2_LO16, R_NIOS2_HI16 - R_NIOS2_LO16 },
+  { "R_METAG_HI16_GOTOFF", R_METAG_HI16_GOTOFF, 0 },
+  { "R_NIOS2_BFD_RELOC_8", R_NIOS2_BFD_RELOC_8, 0 },
+  { "R_RISCV_TLS_DTPMOD64", R_RISCV_TLS_DTPMOD64, 0 },
+  { "R_CKCORE_PLT32", R_CKCORE_PLT32, 0 },
+  { "R_AARCH64_P32_ABS32", R_AARCH64_P32_ABS32, 0 },
+  { "R_M32R_32_RELA", R_M32R_32_RELA, 0 },
+  { "R_CRIS_COPY", R_CRIS_COPY, 0 },
+  { "R_METAG_TLS_IENONPIC_LO16", R_METAG_TLS_IENONPIC_LO16, R_METAG_TLS_IENONPIC_HI16 - R_METAG_TLS_IENONPIC_LO16 },
+  { "R_TILEGX_IMM16_X0_HW0_TLS_GD", R_TILEGX_IMM16_X0_HW0_TLS_GD, 0 },
+  { "R_TILEGX_IMM16_X0_HW2_LAST", R_TILEGX_IMM16_X0_HW2_LAST, 0 },
+  { "R_TILEPRO_MMSTART_X0", R_TILEPRO_MMSTART_X0, 0 },
+  { "R_TILEPRO_BROFF_X1", R_TILEPRO_BROFF_X1, 0 },
+  { "R_METAG_LO16_GOTPC", R_METAG_LO16_GOTPC, R_METAG_HI16_GOTPC - R_METAG_LO16_GOTPC },
+  { "R_TILEPRO_HI16", R_TILEPRO_HI16, 0 },
+  { "R_CKCORE_GOTOFF", R_CKCORE_GOTOFF, 0 },
+  { "R_MN10300_NONE", R_MN10300_NONE, 0 },
+  { "R_TILEGX_IMM16_X1_HW1_PLT_PCREL", R_TILEGX_IMM16_X1_HW1_PLT_PCREL, 0 },
+  { "R_METAG_JMP_SLOT", R_METAG_JMP_SLOT, 0 },
+  { "R_OR1K_8_PCREL", R_OR1K_8_PCREL, 0 },
+  { "R_AARCH64_ADR_PREL_PG_HI21", R_AARCH64_ADR_PREL_PG_HI21, 0 },
+  { "R_AARCH64_P32_TLS_DTPMOD", R_AARCH64_P32_TLS_DTPMOD, 0 },
+  { "R_METAG_REG32OP1", R_METAG_REG32OP1, 0 },
+  { "R_METAG_REG32OP2", R_METAG_REG32OP2, 0 },
+  { "R_METAG_REG32OP3", R_METAG_REG32OP3, 0 },
+  { "R_METAG_REG32OP4", R_METAG_REG32OP4, 0 },
+  { "R_RISCV_CALL_PLT", R_RISCV_CALL_PLT, 0 },
+  { "R_TILEGX_RELATIVE", R_TILEGX_RELATIVE, 0 },
+  { "R_CKCORE_GLOB_DAT", R_CKCORE_GLOB_DAT, 0 },
+  { "R_METAG_TLS_TPOFF", R_METAG_TLS_TPOFF, 0 },
+  { "R_CKCORE_PCRELIMM11BY2", R_CKCORE_PCRELIMM11BY2, 0 },
+  { "R_TILEGX_IMM16_X0_HW1_LAST_TLS_GD", R_TILEGX_IMM16_X0_HW1_LAST_TLS_GD, 0 },
+  { "R_LARCH_SOP_PUSH_TLS_GD", R_LARCH_SOP_PUSH_TLS_GD, 0 },
+  { "R_M32R_HI16_SLO_RELA", R_M32R_HI16_SLO_RELA, 0 },
+  { "R_AARCH64_GOT_LD_PREL19", R_AARCH64_GOT_LD_PREL19, 0 },
+  { "R_TILEGX_JMP_SLOT", R_TILEGX_JMP_SLOT, 0 },
+  { "R_MN10300_PCREL32", R_MN10300_PCREL32, 0 },
+  { "R_AARCH64_TLSLE_LDST32_TPREL_LO12", R_AARCH64_TLSLE_LDST32_TPREL_LO12, 0 },
+  { "R_AARCH64_ABS64", R_AARCH64_ABS64, 0 },
+  { "R_RISCV_ADD32", R_RISCV_ADD32, 0 },
+  { "R_MN10300_GNU_VTENTRY", R_MN10300_GNU_VTENTRY, 0 },
+  { "R_TILEPRO_IMM16_X1_TLS_LE", R_TILEPRO_IMM16_X1_TLS_LE, 0 },
+  { "R_AARCH64_TLSGD_ADR_PREL21", R_AARCH64_TLSGD_ADR_PREL21, 0 },
+  { "R_AARCH64_GLOB_DAT", R_AARCH64_GLOB_DAT, 0 },
+  { "R_AARCH64_MOVW_PREL_G0", R_AARCH64_MOVW_PREL_G0, 0 },
+  { "R_AARCH64_MOVW_PREL_G2", R_AARCH64_MOVW_PREL_G2, 0 },
+  { "R_AARCH64_MOVW_PREL_G3", R_AARCH64_MOVW_PREL_G3, 0 },
+  { "R_NIOS2_GOT16", R_NIOS2_GOT16, 0 },
+  { "R_AARCH64_MOVW_PREL_G1", R_AARCH64_MOVW_PREL_G1, 0 },
+  { "R_RISCV_COPY", R_RISCV_COPY, 0 },
+  { "R_MN10300_TLS_GD", R_MN10300_TLS_GD, 0 },
+  { "R_AARCH64_TLSLD_LDST32_DTPREL_LO12", R_AARCH64_TLSLD_LDST32_DTPREL_LO12, 0 },
+  { "R_TILEGX_IMM16_X0_HW0_TLS_IE", R_TILEGX_IMM16_X0_HW0_TLS_IE, 0 },
+  { "R_TILEGX_IMM16_X1_HW1_LAST_PCREL", R_TILEGX_IMM16_X1_HW1_LAST_PCREL, 0 },
+  { "R_TILEPRO_IMM16_X0_TLS_GD_HA", R_TILEPRO_IMM16_X0_TLS_GD_HA, 0 },
+  { "R_TILEPRO_IMM16_X0_LO_PCREL", R_TILEPRO_IMM16_X0_LO_PCREL, R_TILEPRO_IMM16_X0_HI_PCREL - R_TILEPRO_IMM16_X0_LO_PCREL },
+  { "R_OR1K_GOTOFF_HI16", R_OR1K_GOTOFF_HI16, 0 },
+  { "R_METAG_TLS_LDM", R_METAG_TLS_LDM, 0 },
+  { "R_MN10300_TLS_DTPOFF", R_MN10300_TLS_DTPOFF, 0 },
+  { "R_AARCH64_TLSIE_MOVW_GOTTPREL_G1", R_AARCH64_TLSIE_MOVW_GOTTPREL_G1, 0 },
+  { "R_MN10300_TLS_IE", R_MN10300_TLS_IE, 0 },
+  { "R_RISCV_NUM", R_RISCV_NUM, 0 },
+  { "R_NIOS2_BFD_RELOC_16", R_NIOS2_BFD_RELOC_16, 0 },
+  { "R_TILEGX_JUMPOFF_X1", R_TILEGX_JUMPOFF_X1, 0 },
+  { "R_TILEPRO_IMM16_X0_TLS_GD_HI", R_TILEPRO_IMM16_X0_TLS_GD_HI, 0 },
+  { "R_AARCH64_P32_TLSDESC", R_AARCH64_P32_TLSDESC, 0 },
+  { "R_TILEGX_IMM16_X0_HW0_TLS_LE", R_TILEGX_IMM16_X0_HW0_TLS_LE, 0 },
+  { "R_TILEGX_IMM8_X0", R_TILEGX_IMM8_X0, 0 },
+  { "R_MICROBLAZE_JUMP_SLOT", R_MICROBLAZE_JUMP_SLOT, 0 },
+  { "R_MN10300_TLS_LE", R_MN10300_TLS_LE, 0 },
+  { "R_TILEPRO_GLOB_DAT", R_TILEPRO_GLOB_DAT, 0 },
+  { "R_TILEGX_IMM8_Y0", R_TILEGX_IMM8_Y0, 0 },
+  { "R_TILEGX_IMM8_Y1", R_TILEGX_IMM8_Y1, 0 },
+  { "R_MICROBLAZE_TLSDTPREL32", R_MICROBLAZE_TLSDTPREL32, 0 },
+  { "R_M32R_RELATIVE", R_M32R_RELATIVE, 0 },
+  { "R_RISCV_JUMP_SLOT", R_RISCV_JUMP_SLOT, 0 },
+  { "R_TILEGX_IMM16_X0_HW0_PLT_PCREL", R_TILEGX_IMM16_X0_HW0_PLT_PCREL, 0 },
+  { "R_NIOS2_CALL_HA", R_NIOS2_CALL_HA, 0 },
+  { "R_CRIS_32_PLT_PCREL", R_CRIS_32_PLT_PCREL, 0 },
+  { "R_CRIS_8", R_CRIS_8, 0 },
+  { "R_TILEGX_HW1", R_TILEGX_HW1, 0 },
+  { "R_AARCH64_TLSLD_LDST64_DTPREL_LO12_NC", R_AARCH64_TLSLD_LDST64_DTPREL_LO12_NC, 0 },
+  { "R_TILEPRO_IMM8_Y1", R_TILEPRO_IMM8_Y1, 0 },
+  { "R_TILEPRO_LO16", R_TILEPRO_LO16, R_TILEPRO_HI16 - R_TILEPRO_LO16 },
+  { "R_NIOS2_U16", R_NIOS2_U16, 0 },
+  { "R_NIOS2_GPREL", R_NIOS2_GPREL, 0 },
+  { "R_AARCH64_TLSLD_MOVW_DTPREL_G0", R_AARCH64_TLSLD_MOVW_DTPREL_G0, 0 },
+  { "R_AARCH64_TLSLD_MOVW_DTPREL_G1", R_AARCH64_TLSLD_MOVW_DTPREL_G1, 0 },
+  { "R_OR1K_GLOB_DAT", R_OR1K_GLOB_DAT, 0 },
+  { "R_AARCH64_TLSLE_LDST16_TPREL_LO12_NC", R_AARCH64_TLSLE_LDST16_TPREL_LO12_NC, 0 },
+  { "R_AARCH64_TLSDESC_OFF_G0_NC", R_AARCH64_TLSDESC_OFF_G0_NC, 0 },
+  { "R_MICROBLAZE_TLSGD", R_MICROBLAZE_TLSGD, 0 },
+  { "R_AARCH64_MOVW_GOTOFF_G1_NC", R_AARCH64_MOVW_GOTOFF_G1_NC, 0 },
+  { "R_M32R_GOTOFF_HI_ULO", R_M32R_GOTOFF_HI_ULO, 0 },
+  { "R_MN10300_TLS_LDO", R_MN10300_TLS_LDO, 0 },
+  { "R_LARCH_TLS_DTPREL32", R_LARCH_TLS_DTPREL32, 0 },
+  { "R_TILEGX_TLS_DTPMOD32", R_TILEGX_TLS_DTPMOD32, 0 },
+  { "R_MN10300_COPY", R_MN10300_COPY, 0 },
+  { "R_RISCV_RELATIVE", R_RISCV_RELATIVE, 0 },
+  { "R_TILEGX_IMM16_X1_HW1_PCREL", R_TILEGX_IMM16_X1_HW1_PCREL, 0 },
+  { "R_LARCH_SOP_PUSH_PLT_PCREL", R_LARCH_SOP_PUSH_PLT_PCREL, 0 },
+  { "R_M32R_GNU_VTINHERIT", R_M32R_GNU_VTINHERIT, 0 },
+  { "R_ARC_TLS_DTPOFF_S9", R_ARC_TLS_DTPOFF_S9, 0 },
+  { "R_LARCH_TLS_DTPREL64", R_LARCH_TLS_DTPREL64, 0 },
+  { "R_TILEGX_TLS_DTPMOD64", R_TILEGX_TLS_DTPMOD64, 0 },
+  { "R_METAG_HIADDR16", R_METAG_HIADDR16, 0 },
+  { "R_TILEGX_IMM8_Y0_TLS_ADD", R_TILEGX_IMM8_Y0_TLS_ADD, 0 },
+  { "R_MICROBLAZE_TLSLD", R_MICROBLAZE_TLSLD, 0 },
+  { "R_ARC_NONE", R_ARC_NONE, 0 },
+  { "R_ARC_S21H_PCREL", R_ARC_S21H_PCREL, 0 },
+  { "R_METAG_GETSET_GOTOFF", R_METAG_GETSET_GOTOFF, 0 },
+  { "R_TILEPRO_TLS_GD_CALL", R_TILEPRO_TLS_GD_CALL, 0 },
+  { "R_M32R_SDA16", R_M32R_SDA16, 0 },
+  { "R_AARCH64_ADR_PREL_PG_HI21_NC", R_AARCH64_ADR_PREL_PG_HI21_NC, 0 },
+  { "R_TILEGX_IMM16_X1_HW2_PLT_PCREL", R_TILEGX_IMM16_X1_HW2_PLT_PCREL, 0 },
+  { "R_CRIS_JUMP_SLOT", R_CRIS_JUMP_SLOT, 0 },
+  { "R_AARCH64_LD64_GOTPAGE_LO15", R_AARCH64_LD64_GOTPAGE_LO15, 0 },
+  { "R_MN10300_24", R_MN10300_24, 0 },
+  { "R_AARCH64_TLSLE_MOVW_TPREL_G0", R_AARCH64_TLSLE_MOVW_TPREL_G0, 0 },
+  { "R_AARCH64_TLSLE_MOVW_TPREL_G1", R_AARCH64_TLSLE_MOVW_TPREL_G1, 0 },
+  { "R_AARCH64_TLSLE_LDST8_TPREL_LO12_NC", R_AARCH64_TLSLE_LDST8_TPREL_LO12_NC, 0 },
+  { "R_CKCORE_GOTOFF_LO16", R_CKCORE_GOTOFF_LO16, R_CKCORE_GOTOFF_HI16 - R_CKCORE_GOTOFF_LO16 },
+  { "R_TILEPRO_SHAMT_X0", R_TILEPRO_SHAMT_X0, 0 },
+  { "R_NIOS2_CALL26_NOAT", R_NIOS2_CALL26_NOAT, 0 },
+  { "R_TILEGX_IMM16_X0_HW3", R_TILEGX_IMM16_X0_HW3, 0 },
+  { "R_M32R_GOT24", R_M32R_GOT24, 0 },
+  { "R_TILEPRO_SHAMT_Y1", R_TILEPRO_SHAMT_Y1, 0 },
+  { "R_MICROBLAZE_COPY", R_MICROBLAZE_COPY, 0 },
+  { "R_CKCORE_PCREL_IMM7BY4", R_CKCORE_PCREL_IMM7BY4, 0 },
+  { "R_METAG_GLOB_DAT", R_METAG_GLOB_DAT, 0 },
+  { "R_AARCH64_ADR_GOT_PAGE", R_AARCH64_ADR_GOT_PAGE, 0 },
+  { "R_RISCV_GPREL_I", R_RISCV_GPREL_I, 0 },
+  { "R_RISCV_PCREL_HI20", R_RISCV_PCREL_HI20, 0 },
+  { "R_NIOS2_TLS_DTPREL", R_NIOS2_TLS_DTPREL, 0 },
+  { "R_LARCH_GNU_VTINHERIT", R_LARCH_GNU_VTINHERIT, 0 },
+  { "R_OR1K_GNU_VTINHERIT", R_OR1K_GNU_VTINHERIT, 0 },
+  { "R_ARC_H30", R_ARC_H30, 0 },
+  { "R_LARCH_SOP_POP_32_S_0_5_10_16_S2", R_LARCH_SOP_POP_32_S_0_5_10_16_S2, 0 },
+  { "R_CKCORE_GOTOFF_HI16", R_CKCORE_GOTOFF_HI16, 0 },
+  { "R_TILEPRO_IMM16_X0_TLS_IE_HA", R_TILEPRO_IMM16_X0_TLS_IE_HA, 0 },
+  { "R_TILEPRO_IMM16_X0_TLS_IE_HI", R_TILEPRO_IMM16_X0_TLS_IE_HI, 0 },
+  { "R_MICROBLAZE_64_PCREL", R_MICROBLAZE_64_PCREL, 0 },
+  { "R_TILEPRO_TLS_TPOFF32", R_TILEPRO_TLS_TPOFF32, 0 },
+  { "R_AARCH64_P32_TLS_DTPREL", R_AARCH64_P32_TLS_DTPREL, 0 },
+  { "R_TILEGX_GLOB_DAT", R_TILEGX_GLOB_DAT, 0 },
+  { "R_MICROBLAZE_GNU_VTINHERIT", R_MICROBLAZE_GNU_VTINHERIT, 0 },
+  { "R_TILEGX_64", R_TILEGX_64, 0 },
+  { "R_AARCH64_JUMP_SLOT", R_AARCH64_JUMP_SLOT, 0 },
+  { "R_TILEPRO_IMM16_X0_TLS_IE_LO", R_TILEPRO_IMM16_X0_TLS_IE_LO, R_TILEPRO_IMM16_X0_TLS_IE_HI - R_TILEPRO_IMM16_X0_TLS_IE_LO },
+  { "R_AARCH64_TLSLD_ADD_DTPREL_HI12", R_AARCH64_TLSLD_ADD_DTPREL_HI12, 0 },
+  { "R_M32R_26_PCREL_RELA", R_M32R_26_PCREL_RELA, 0 },
+  { "R_TILEPRO_16", R_TILEPRO_16, 0 },
+  { "R_NIOS2_GOTOFF_HA", R_NIOS2_GOTOFF_HA, 0 },
+  { "R_TILEGX_BROFF_X1", R_TILEGX_BROFF_X1, 0 },
+  { "R_TILEPRO_32", R_TILEPRO_32, 0 },
+  { "R_ARC_TLS_LE_S9", R_ARC_TLS_LE_S9, 0 },
+  { "R_AARCH64_LDST64_ABS_LO12_NC", R_AARCH64_LDST64_ABS_LO12_NC, 0 },
+  { "R_AARCH64_MOVW_UABS_G0", R_AARCH64_MOVW_UABS_G0, 0 },
+  { "R_TILEPRO_16_PCREL", R_TILEPRO_16_PCREL, 0 },
+  { "R_ARC_B22_PCREL", R_ARC_B22_PCREL, 0 },
+  { "R_LARCH_SOP_NOT", R_LARCH_SOP_NOT, 0 },
+  { "R_TILEPRO_32_PCREL", R_TILEPRO_32_PCREL, 0 },
+  { "R_AARCH64_ADD_ABS_LO12_NC", R_AARCH64_ADD_ABS_LO12_NC, 0 },
+  { "R_LARCH_ADD24", R_LARCH_ADD24, 0 },
+  { "R_RISCV_NONE", R_RISCV_NONE, 0 },
+  { "R_OR1K_HI_16_IN_INSN", R_OR1K_HI_16_IN_INSN, 0 },
+  { "R_LARCH_ADD8", R_LARCH_ADD8, 0 },
+  { "R_METAG_GOTOFF", R_METAG_GOTOFF, 0 },
+  { "R_AARCH64_TLSLE_LDST8_TPREL_LO12", R_AARCH64_TLSLE_LDST8_TPREL_LO12, 0 },
+  { "R_TILEPRO_TLS_IE_LOAD", R_TILEPRO_TLS_IE_LOAD, 0 },
+  { "R_NIOS2_TLS_IE16", R_NIOS2_TLS_IE16, 0 },
+  { "R_OR1K_32_PCREL", R_OR1K_32_PCREL, 0 },
+  { "R_AARCH64_TLSDESC_ADR_PREL21", R_AARCH64_TLSDESC_ADR_PREL21, 0 },
+  { "R_MN10300_GOTPC32", R_MN10300_GOTPC32, 0 },
+  { "R_TILEGX_IMM16_X1_HW0_TLS_LE", R_TILEGX_IMM16_X1_HW0_TLS_LE, 0 },
+  { "R_M32R_GOT16_LO", R_M32R_GOT16_LO, 0 },
+  { "R_M32R_GLOB_DAT", R_M32R_GLOB_DAT, 0 },
+  { "R_NIOS2_CALL16", R_NIOS2_CALL16, 0 },
+  { "R_CKCORE_TLS_LDM32", R_CKCORE_TLS_LDM32, 0 },
+  { "R_TILEPRO_IMM16_X0_HA", R_TILEPRO_IMM16_X0_HA, 0 },
+  { "R_TILEPRO_IMM16_X0_HI", R_TILEPRO_IMM16_X0_HI, 0 },
+  { "R_RISCV_TLS_TPREL32", R_RISCV_TLS_TPREL32, 0 },
+  { "R_TILEGX_NUM", R_TILEGX_NUM, 0 },
+  { "R_AARCH64_TLSGD_MOVW_G0_NC", R_AARCH64_TLSGD_MOVW_G0_NC, 0 },
+  { "R_METAG_TLS_DTPOFF", R_METAG_TLS_DTPOFF, 0 },
+  { "R_M32R_HI16_ULO", R_M32R_HI16_ULO, 0 },
+  { "R_RISCV_TLS_TPREL64", R_RISCV_TLS_TPREL64, 0 },
+  { "R_ARC_SDA", R_ARC_SDA, 0 },
+  { "R_AARCH64_TLSLD_ADD_DTPREL_LO12", R_AARCH64_TLSLD_ADD_DTPREL_LO12, R_AARCH64_TLSLD_ADD_DTPREL_HI12 - R_AARCH64_TLSLD_ADD_DTPREL_LO12 },
+  { "R_METAG_PLT", R_METAG_PLT, 0 },
+  { "R_TILEPRO_IMM16_X0_HI_PCREL", R_TILEPRO_IMM16_X0_HI_PCREL, 0 },
+  { "R_MN10300_TLS_TPOFF", R_MN10300_TLS_TPOFF, 0 },
+  { "R_TILEGX_DEST_IMM8_X1", R_TILEGX_DEST_IMM8_X1, 0 },
+  { "R_MICROBLAZE_32_PCREL_LO", R_MICROBLAZE_32_PCREL_LO, 0 },
+  { "R_M32R_GOTOFF_LO", R_M32R_GOTOFF_LO, 0 },
+  { "R_AC_SECTOFF_U8", R_AC_SECTOFF_U8, 0 },
+  { "R_TILEPRO_SHAMT_X1", R_TILEPRO_SHAMT_X1, 0 },
+  { "R_AARCH64_TLSGD_ADR_PAGE21", R_AARCH64_TLSGD_ADR_PAGE21, 0 },
+  { "R_TILEPRO_TLS_DTPOFF32", R_TILEPRO_TLS_DTPOFF32, 0 },
+  { "R_CKCORE_GOT32", R_CKCORE_GOT32, 0 },
+  { "R_AARCH64_TLSDESC_ADR_PAGE21", R_AARCH64_TLSDESC_ADR_PAGE21, 0 },
+  { "R_ARC_TLS_GD_GOT", R_ARC_TLS_GD_GOT, 0 },
+  { "R_M32R_NONE", R_M32R_NONE, 0 },
+  { "R_LARCH_SOP_POP_32_U_10_12", R_LARCH_SOP_POP_32_U_10_12, 0 },
+  { "R_TILEGX_IMM8_X0_TLS_ADD", R_TILEGX_IMM8_X0_TLS_ADD, 0 },
+  { "R_METAG_TLS_LDO", R_METAG_TLS_LDO, 0 },
+  { "R_RISCV_TLS_DTPREL64", R_RISCV_TLS_DTPREL64, 0 },
+  { "R_TILEGX_IMM8_Y0_TLS_GD_ADD", R_TILEGX_IMM8_Y0_TLS_GD_ADD, 0 },
+  { "R_TILEGX_IMM16_X0_HW1_LAST_TLS_IE", R_TILEGX_IMM16_X0_HW1_LAST_TLS_IE, 0 },
+  { "R_TILEGX_IMM16_X0_HW0_LAST_PLT_PCREL", R_TILEGX_IMM16_X0_HW0_LAST_PLT_PCREL, 0 },
+  { "R_RISCV_SET6", R_RISCV_SET6, 0 },
+  { "R_RISCV_SET8", R_RISCV_SET8, 0 },
+  { "R_TILEGX_IMM16_X0_HW2_LAST_PLT_PCREL", R_TILEGX_IMM16_X0_HW2_LAST_PLT_PCREL, 0 },
+  { "R_TILEGX_JUMPOFF_X1_PLT", R_TILEGX_JUMPOFF_X1_PLT, 0 },
+  { "R_CKCORE_ADDR32", R_CKCORE_ADDR32, 0 },
+  { "R_RISCV_TPREL_HI20", R_RISCV_TPREL_HI20, 0 },
+  { "R_CKCORE_DOFFSET_IMM18", R_CKCORE_DOFFSET_IMM18, 0 },
+  { "R_TILEGX_IMM16_X1_HW1_LAST_PLT_PCREL", R_TILEGX_IMM16_X1_HW1_LAST_PLT_PCREL, 0 },
+  { "R_LARCH_SOP_POP_32_S_10_12", R_LARCH_SOP_POP_32_S_10_12, 0 },
+  { "R_RISCV_PCREL_LO12_S", R_RISCV_PCREL_LO12_S, 0 },
+  { "R_MN10300_16", R_MN10300_16, 0 },
+  { "R_TILEGX_IMM16_X0_HW1_LAST_TLS_LE", R_TILEGX_IMM16_X0_HW1_LAST_TLS_LE, 0 },
+  { "R_CKCORE_TLS_IE32", R_CKCORE_TLS_IE32, 0 },
+  { "R_AARCH64_TLSLE_ADD_TPREL_LO12_NC", R_AARCH64_TLSLE_ADD_TPREL_LO12_NC, 0 },
+  { "R_AARCH64_PREL32", R_AARCH64_PREL32, 0 },
+  { "R_NIOS2_TLS_LDM16", R_NIOS2_TLS_LDM16, 0 },
+  { "R_TILEPRO_IMM8_X0", R_TILEPRO_IMM8_X0, 0 },
+  { "R_TILEPRO_IMM8_X1", R_TILEPRO_IMM8_X1, 0 },
+  { "R_MICROBLAZE_TLSTPREL32", R_MICROBLAZE_TLSTPREL32, 0 },
+  { "R_AARCH64_TLSLE_LDST128_TPREL_LO12", R_AARCH64_TLSLE_LDST128_TPREL_LO12, 0 },
+  { "R_TILEPRO_MMEND_X0", R_TILEPRO_MMEND_X0, 0 },
+  { "R_RISCV_SUB8", R_RISCV_SUB8, 0 },
+  { "R_TILEPRO_IMM8_Y0", R_TILEPRO_IMM8_Y0, 0 },
+  { "R_MICROBLAZE_64", R_MICROBLAZE_64, 0 },
+  { "R_M32R_GOT16_HI_SLO", R_M32R_GOT16_HI_SLO, 0 },
+  { "R_MN10300_GNU_VTINHERIT", R_MN10300_GNU_VTINHERIT, 0 },
+  { "R_TILEGX_TLS_DTPOFF32", R_TILEGX_TLS_DTPOFF32, 0 },
+  { "R_CKCORE_TLS_GD32", R_CKCORE_TLS_GD32, 0 },
+  { "R_LARCH_SOP_ADD", R_LARCH_SOP_ADD, 0 },
+  { "R_METAG_REL8", R_METAG_REL8, 0 },
+  { "R_LARCH_SOP_SUB", R_LARCH_SOP_SUB, 0 },
+  { "R_ARC_TLS_DTPOFF", R_ARC_TLS_DTPOFF, 0 },
+  { "R_CKCORE_TLS_DTPMOD32", R_CKCORE_TLS_DTPMOD32, 0 },
+  { "R_RISCV_HI20", R_RISCV_HI20, 0 },
+  { "R_CKCORE_ADDRPLT", R_CKCORE_ADDRPLT, 0 },
+  { "R_TILEGX_TLS_DTPOFF64", R_TILEGX_TLS_DTPOFF64, 0 },
+  { "R_CKCORE_GOTPC_HI16", R_CKCORE_GOTPC_HI16, 0 },
+  { "R_LARCH_SOP_IF_ELSE", R_LARCH_SOP_IF_ELSE, 0 },
+  { "R_TILEPRO_MF_IMM15_X1", R_TILEPRO_MF_IMM15_X1, 0 },
+  { "R_TILEGX_IMM16_X1_HW1_LAST_TLS_GD", R_TILEGX_IMM16_X1_HW1_LAST_TLS_GD, 0 },
+  { "R_AC_SECTOFF_S9_2", R_AC_SECTOFF_S9_2, 0 },
+  { "R_CRIS_16_PCREL", R_CRIS_16_PCREL, 0 },
+  { "R_TILEPRO_IMM16_X1_LO_PCREL", R_TILEPRO_IMM16_X1_LO_PCREL, R_TILEPRO_IMM16_X1_HI_PCREL - R_TILEPRO_IMM16_X1_LO_PCREL },
+  { "R_AARCH64_P32_COPY", R_AARCH64_P32_COPY, 0 },
+  { "R_AARCH64_TLSLD_MOVW_DTPREL_G0_NC", R_AARCH64_TLSLD_MOVW_DTPREL_G0_NC, 0 },
+  { "R_CRIS_NUM", R_CRIS_NUM, 0 },
+  { "R_NIOS2_UJMP", R_NIOS2_UJMP, 0 },
+  { "R_TILEGX_IMM16_X1_HW1_LAST_TLS_IE", R_TILEGX_IMM16_X1_HW1_LAST_TLS_IE, 0 },
+  { "R_AARCH64_MOVW_UABS_G1_NC", R_AARCH64_MOVW_UABS_G1_NC, 0 },
+  { "R_METAG_HIOG", R_METAG_HIOG, 0 },
+  { "R_TILEPRO_COPY", R_TILEPRO_COPY, 0 },
+  { "R_TILEGX_8", R_TILEGX_8, 0 },
+  { "R_AARCH64_MOVW_UABS_G1", R_AARCH64_MOVW_UABS_G1, 0 },
+  { "R_AARCH64_TLSIE_MOVW_GOTTPREL_G0_NC", R_AARCH64_TLSIE_MOVW_GOTTPREL_G0_NC, 0 },
+  { "R_CKCORE_ADDRGOT_LO16", R_CKCORE_ADDRGOT_LO16, R_CKCORE_ADDRGOT_HI16 - R_CKCORE_ADDRGOT_LO16 },
+  { "R_TILEPRO_IMM16_X0_HA_PCREL", R_TILEPRO_IMM16_X0_HA_PCREL, 0 },
+  { "R_METAG_LOADDR16", R_METAG_LOADDR16, R_METAG_HIADDR16 - R_METAG_LOADDR16 },
+  { "R_AARCH64_TLSDESC", R_AARCH64_TLSDESC, 0 },
+  { "R_LARCH_SOP_PUSH_PCREL", R_LARCH_SOP_PUSH_PCREL, 0 },
+  { "R_TILEGX_IMM16_X1_HW1_LAST_TLS_LE", R_TILEGX_IMM16_X1_HW1_LAST_TLS_LE, 0 },
+  { "R_LARCH_SOP_AND", R_LARCH_SOP_AND, 0 },
+  { "R_LARCH_ADD32", R_LARCH_ADD32, 0 },
+  { "R_MICROBLAZE_NONE", R_MICROBLAZE_NONE, 0 },
+  { "R_RISCV_IRELATIVE", R_RISCV_IRELATIVE, 0 },
+  { "R_AARCH64_LD64_GOT_LO12_NC", R_AARCH64_LD64_GOT_LO12_NC, 0 },
+  { "R_OR1K_TLS_LDM_LO16", R_OR1K_TLS_LDM_LO16, R_OR1K_TLS_LDM_HI16 - R_OR1K_TLS_LDM_LO16 },
+  { "R_NIOS2_GOTOFF", R_NIOS2_GOTOFF, 0 },
+  { "R_M32R_LO16", R_M32R_LO16, 0 },
+  { "R_AARCH64_LDST16_ABS_LO12_NC", R_AARCH64_LDST16_ABS_LO12_NC, 0 },
+  { "R_TILEPRO_IMM16_X0_LO", R_TILEPRO_IMM16_X0_LO, R_TILEPRO_IMM16_X0_HI - R_TILEPRO_IMM16_X0_LO },
+  { "R_TILEPRO_IMM16_X1_PCREL", R_TILEPRO_IMM16_X1_PCREL, 0 },
+  { "R_TILEPRO_IMM16_X1_HA_PCREL", R_TILEPRO_IMM16_X1_HA_PCREL, 0 },
+  { "R_CKCORE_TLS_LE32", R_CKCORE_TLS_LE32, 0 },
+  { "R_M32R_GNU_VTENTRY", R_M32R_GNU_VTENTRY, 0 },
+  { "R_MICROBLAZE_TLSDTPREL64", R_MICROBLAZE_TLSDTPREL64, 0 },
+  { "R_METAG_TLS_LE_HI16", R_METAG_TLS_LE_HI16, 0 },
+  { "R_ARC_24", R_ARC_24, 0 },
+  { "R_OR1K_TLS_LDO_HI16", R_OR1K_TLS_LDO_HI16, 0 },
+  { "R_TILEGX_IMM16_X0_HW3_PCREL", R_TILEGX_IMM16_X0_HW3_PCREL, 0 },
+  { "R_AARCH64_TLSIE_LD_GOTTPREL_PREL19", R_AARCH64_TLSIE_LD_GOTTPREL_PREL19, 0 },
+  { "R_AC_SECTOFF_S9", R_AC_SECTOFF_S9, 0 },
+  { "R_AARCH64_P32_RELATIVE", R_AARCH64_P32_RELATIVE, 0 },
+  { "R_TILEPRO_MT_IMM15_X1", R_TILEPRO_MT_IMM15_X1, 0 },
+  { "R_METAG_TLS_DTPMOD", R_METAG_TLS_DTPMOD, 0 },
+  { "R_TILEPRO_IMM16_X1_TLS_GD_LO", R_TILEPRO_IMM16_X1_TLS_GD_LO, R_TILEPRO_IMM16_X1_TLS_GD_HI - R_TILEPRO_IMM16_X1_TLS_GD_LO },
+  { "R_NIOS2_CACHE_OPX", R_NIOS2_CACHE_OPX, 0 },
+  { "R_METAG_TLS_LDO_HI16", R_METAG_TLS_LDO_HI16, 0 },
+  { "R_CKCORE_GOTPC_LO16", R_CKCORE_GOTPC_LO16, R_CKCORE_GOTPC_HI16 - R_CKCORE_GOTPC_LO16 },
+  { "R_AARCH64_LD_PREL_LO19", R_AARCH64_LD_PREL_LO19, 0 },
+  { "R_TILEGX_IMM16_X1_HW0_TLS_GD", R_TILEGX_IMM16_X1_HW0_TLS_GD, 0 },
+  { "R_METAG_COPY", R_METAG_COPY, 0 },
+  { "R_CKCORE_NONE", R_CKCORE_NONE, 0 },
+  { "R_TILEGX_IMM16_X0_HW1_PCREL", R_TILEGX_IMM16_X0_HW1_PCREL, 0 },
+  { "R_CKCORE_DOFFSET_LO16", R_CKCORE_DOFFSET_LO16, 0 },
+  { "R_LARCH_SOP_PUSH_ABSOLUTE", R_LARCH_SOP_PUSH_ABSOLUTE, 0 },
+  { "R_TILEGX_IMM16_X1_HW0_TLS_IE", R_TILEGX_IMM16_X1_HW0_TLS_IE, 0 },
+  { "R_ARC_S25H_PCREL", R_ARC_S25H_PCREL, 0 },
+  { "R_MICROBLAZE_GOTOFF_32", R_MICROBLAZE_GOTOFF_32, 0 },
+  { "R_CRIS_NONE", R_CRIS_NONE, 0 },
+  { "R_LARCH_SOP_POP_32_U", R_LARCH_SOP_POP_32_U, 0 },
+  { "R_TILEGX_SHAMT_X0", R_TILEGX_SHAMT_X0, 0 },
+  { "R_NIOS2_IMM8", R_NIOS2_IMM8, 0 },
+  { "R_ARC_SECTOFF_ME_2", R_ARC_SECTOFF_ME_2, 0 },
+  { "R_METAG_NONE", R_METAG_NONE, 0 },
+  { "R_CRIS_32_PLT_GOTREL", R_CRIS_32_PLT_GOTREL, 0 },
+  { "R_NIOS2_PCREL16", R_NIOS2_PCREL16, 0 },
+  { "R_NIOS2_HIADJ16", R_NIOS2_HIADJ16, 0 },
+  { "R_TILEGX_SHAMT_X1", R_TILEGX_SHAMT_X1, 0 },
+  { "R_TILEPRO_IMM16_X1_HA", R_TILEPRO_IMM16_X1_HA, 0 },
+  { "R_TILEGX_IMM16_X0_HW0_LAST_GOT", R_TILEGX_IMM16_X0_HW0_LAST_GOT, 0 },
+  { "R_M32R_HI16_SLO", R_M32R_HI16_SLO, 0 },
+  { "R_M32R_16_RELA", R_M32R_16_RELA, 0 },
+  { "R_MICROBLAZE_REL", R_MICROBLAZE_REL, 0 },
+  { "R_TILEGX_SHAMT_Y0", R_TILEGX_SHAMT_Y0, 0 },
+  { "R_METAG_LO16_PLT", R_METAG_LO16_PLT, R_METAG_HI16_PLT - R_METAG_LO16_PLT },
+  { "R_CKCORE_DOFFSET_IMM18BY2", R_CKCORE_DOFFSET_IMM18BY2, 0 },
+  { "R_CKCORE_DOFFSET_IMM18BY4", R_CKCORE_DOFFSET_IMM18BY4, 0 },
+  { "R_TILEGX_IMM16_X1_HW3_PLT_PCREL", R_TILEGX_IMM16_X1_HW3_PLT_PCREL, 0 },
+  { "R_TILEPRO_IMM16_X1_GOT_HI", R_TILEPRO_IMM16_X1_GOT_HI, 0 },
+  { "R_ARC_TLS_IE_GOT", R_ARC_TLS_IE_GOT, 0 },
+  { "R_METAG_HI16_GOTPC", R_METAG_HI16_GOTPC, 0 },
+  { "R_ARC_N8", R_ARC_N8, 0 },
+  { "R_MICROBLAZE_PLT_64", R_MICROBLAZE_PLT_64, 0 },
+  { "R_AARCH64_IRELATIVE", R_AARCH64_IRELATIVE, 0 },
+  { "R_TILEGX_IMM8_X1", R_TILEGX_IMM8_X1, 0 },
+  { "R_AARCH64_TLSDESC_OFF_G1", R_AARCH64_TLSDESC_OFF_G1, 0 },
+  { "R_RISCV_CALL", R_RISCV_CALL, 0 },
+  { "R_AARCH64_CONDBR19", R_AARCH64_CONDBR19, 0 },
+  { "R_AARCH64_TLSLD_LDST8_DTPREL_LO12", R_AARCH64_TLSLD_LDST8_DTPREL_LO12, 0 },
+  { "R_METAG_TLS_LE_LO16", R_METAG_TLS_LE_LO16, R_METAG_TLS_LE_HI16 - R_METAG_TLS_LE_LO16 },
+  { "R_MICROBLAZE_GLOB_DAT", R_MICROBLAZE_GLOB_DAT, 0 },
+  { "R_METAG_GETSET_GOT", R_METAG_GETSET_GOT, 0 },
+  { "R_TILEGX_HW0", R_TILEGX_HW0, 0 },
+  { "R_TILEGX_HW2", R_TILEGX_HW2, 0 },
+  { "R_TILEGX_HW3", R_TILEGX_HW3, 0 },
+  { "R_TILEGX_16", R_TILEGX_16, 0 },
+  { "R_NIOS2_TLS_TPREL", R_NIOS2_TLS_TPREL, 0 },
+  { "R_TILEPRO_8", R_TILEPRO_8, 0 },
+  { "R_OR1K_GNU_VTENTRY", R_OR1K_GNU_VTENTRY, 0 },
+  { "R_AARCH64_TLSLE_MOVW_TPREL_G0_NC", R_AARCH64_TLSLE_MOVW_TPREL_G0_NC, 0 },
+  { "R_RISCV_TPREL_ADD", R_RISCV_TPREL_ADD, 0 },
+  { "R_TILEGX_32", R_TILEGX_32, 0 },
+  { "R_AARCH64_TLSDESC_LD64_LO12", R_AARCH64_TLSDESC_LD64_LO12, 0 },
+  { "R_TILEPRO_IMM16_X1_TLS_GD_HI", R_TILEPRO_IMM16_X1_TLS_GD_HI, 0 },
+  { "R_NIOS2_ALIGN", R_NIOS2_ALIGN, 0 },
+  { "R_M32R_SDA16_RELA", R_M32R_SDA16_RELA, 0 },
+  { "R_METAG_TLS_LDO_LO16", R_METAG_TLS_LDO_LO16, R_METAG_TLS_LDO_HI16 - R_METAG_TLS_LDO_LO16 },
+  { "R_AARCH64_TLSLD_LDST16_DTPREL_LO12_NC", R_AARCH64_TLSLD_LDST16_DTPREL_LO12_NC, 0 },
+  { "R_TILEPRO_IMM16_X1_GOT", R_TILEPRO_IMM16_X1_GOT, 0 },
+  { "R_AARCH64_PREL16", R_AARCH64_PREL16, 0 },
+  { "R_AARCH64_TLSDESC_LD_PREL19", R_AARCH64_TLSDESC_LD_PREL19, 0 },
+  { "R_RISCV_TLS_DTPREL32", R_RISCV_TLS_DTPREL32, 0 },
+  { "R_TILEGX_IMM16_X0_HW0_LAST_PCREL", R_TILEGX_IMM16_X0_HW0_LAST_PCREL, 0 },
+  { "R_TILEGX_IMM16_X1_HW1_LAST", R_TILEGX_IMM16_X1_HW1_LAST, 0 },
+  { "R_METAG_ADDR32", R_METAG_ADDR32, 0 },
+  { "R_RISCV_RVC_LUI", R_RISCV_RVC_LUI, 0 },
+  { "R_CRIS_16_GOT", R_CRIS_16_GOT, 0 },
+  { "R_RISCV_SUB16", R_RISCV_SUB16, 0 },
+  { "R_CKCORE_COPY", R_CKCORE_COPY, 0 },
+  { "R_TILEGX_IMM16_X0_HW2_PLT_PCREL", R_TILEGX_IMM16_X0_HW2_PLT_PCREL, 0 },
+  { "R_TILEGX_32_PCREL", R_TILEGX_32_PCREL, 0 },
+  { "R_ARC_S21W_PCREL", R_ARC_S21W_PCREL, 0 },
+  { "R_AARCH64_MOVW_PREL_G2_NC", R_AARCH64_MOVW_PREL_G2_NC, 0 },
+  { "R_AARCH64_TLS_TPREL", R_AARCH64_TLS_TPREL, 0 },
+  { "R_AARCH64_MOVW_PREL_G0_NC", R_AARCH64_MOVW_PREL_G0_NC, 0 },
+  { "R_TILEGX_IMM16_X1_HW0_PLT_PCREL", R_TILEGX_IMM16_X1_HW0_PLT_PCREL, 0 },
+  { "R_AARCH64_PREL64", R_AARCH64_PREL64, 0 },
+  { "R_AARCH64_TLSLE_LDST32_TPREL_LO12_NC", R_AARCH64_TLSLE_LDST32_TPREL_LO12_NC, 0 },
+  { "R_AARCH64_TLSLD_LDST128_DTPREL_LO12", R_AARCH64_TLSLD_LDST128_DTPREL_LO12, 0 },
+  { "R_TILEGX_SHAMT_Y1", R_TILEGX_SHAMT_Y1, 0 },
+  { "R_ARC_TLS_TPOFF", R_ARC_TLS_TPOFF, 0 },
+  { "R_MN10300_TLS_LD", R_MN10300_TLS_LD, 0 },
+  { "R_MN10300_GOT16", R_MN10300_GOT16, 0 },
+  { "R_OR1K_16", R_OR1K_16, 0 },
+  { "R_CKCORE_TLS_DTPOFF32", R_CKCORE_TLS_DTPOFF32, 0 },
+  { "R_TILEPRO_IMM16_X0_PCREL", R_TILEPRO_IMM16_X0_PCREL, 0 },
+  { "R_MN10300_GOTOFF24", R_MN10300_GOTOFF24, 0 },
+  { "R_MN10300_GOT24", R_MN10300_GOT24, 0 },
+  { "R_MN10300_GOTOFF32", R_MN10300_GOTOFF32, 0 },
+  { "R_MN10300_GOT32", R_MN10300_GOT32, 0 },
+  { "R_TILEGX_IMM16_X1_HW0_LAST_PCREL", R_TILEGX_IMM16_X1_HW0_LAST_PCREL, 0 },
+  { "R_TILEGX_IMM16_X1_HW0_LAST_PLT_PCREL", R_TILEGX_IMM16_X1_HW0_LAST_PLT_PCREL, 0 },
+  { "R_LARCH_SOP_POP_32_S_0_10_10_16_S2", R_LARCH_SOP_POP_32_S_0_10_10_16_S2, 0 },
+  { "R_AARCH64_TLSLD_MOVW_G1", R_AARCH64_TLSLD_MOVW_G1, 0 },
+  { "R_METAG_GETSETOFF", R_METAG_GETSETOFF, 0 },
+  { "R_NIOS2_IMM5", R_NIOS2_IMM5, 0 },
+  { "R_NIOS2_IMM6", R_NIOS2_IMM6, 0 },
+  { "R_AARCH64_ABS16", R_AARCH64_ABS16, 0 },
+  { "R_TILEGX_GNU_VTINHERIT", R_TILEGX_GNU_VTINHERIT, 0 },
+  { "R_AARCH64_P32_GLOB_DAT", R_AARCH64_P32_GLOB_DAT, 0 },
+  { "R_TILEPRO_JOFFLONG_X1_PLT", R_TILEPRO_JOFFLONG_X1_PLT, 0 },
+  { "R_RISCV_ADD8", R_RISCV_ADD8, 0 },
+  { "R_MN10300_NUM", R_MN10300_NUM, 0 },
+  { "R_M32R_18_PCREL_RELA", R_M32R_18_PCREL_RELA, 0 },
+  { "R_CKCORE_PCRELJSR_IMM11BY2", R_CKCORE_PCRELJSR_IMM11BY2, 0 },
+  { "R_AARCH64_TLSLD_LDST128_DTPREL_LO12_NC", R_AARCH64_TLSLD_LDST128_DTPREL_LO12_NC, 0 },
+  { "R_METAG_RELATIVE", R_METAG_RELATIVE, 0 },
+  { "R_ARC_B26", R_ARC_B26, 0 },
+  { "R_AC_SECTOFF_U8_2", R_AC_SECTOFF_U8_2, 0 },
+  { "R_RISCV_TPREL_I", R_RISCV_TPREL_I, 0 },
+  { "R_ARC_S13_PCREL", R_ARC_S13_PCREL, 0 },
+  { "R_CKCORE_PCREL_IMM10BY2", R_CKCORE_PCREL_IMM10BY2, 0 },
+  { "R_CKCORE_PCREL_IMM10BY4", R_CKCORE_PCREL_IMM10BY4, 0 },
+  { "R_NIOS2_TLS_GD16", R_NIOS2_TLS_GD16, 0 },
+  { "R_BPF_NONE", R_BPF_NONE, 0 },
+  { "R_TILEPRO_IMM16_X0_GOT", R_TILEPRO_IMM16_X0_GOT, 0 },
+  { "R_ARC_SDA32", R_ARC_SDA32, 0 },
+  { "R_AARCH64_P32_TLS_TPREL", R_AARCH64_P32_TLS_TPREL, 0 },
+  { "R_MN10300_SYM_DIFF", R_MN10300_SYM_DIFF, 0 },
+  { "R_OR1K_GOTOFF_LO16", R_OR1K_GOTOFF_LO16, R_OR1K_GOTOFF_HI16 - R_OR1K_GOTOFF_LO16 },
+  { "R_M32R_GOTPC_HI_ULO", R_M32R_GOTPC_HI_ULO, 0 },
+  { "R_ARC_JUMP_SLOT", R_ARC_JUMP_SLOT, 0 },
+  { "R_OR1K_16_PCREL", R_OR1K_16_PCREL, 0 },
+  { "R_OR1K_TLS_LDO_LO16", R_OR1K_TLS_LDO_LO16, R_OR1K_TLS_LDO_HI16 - R_OR1K_TLS_LDO_LO16 },
+  { "R_MICROBLAZE_32_LO", R_MICROBLAZE_32_LO, 0 },
+  { "R_CKCORE_GOT_IMM18BY4", R_CKCORE_GOT_IMM18BY4, 0 },
+  { "R_MN10300_8", R_MN10300_8, 0 },
+  { "R_CKCORE_JUMP_SLOT", R_CKCORE_JUMP_SLOT, 0 },
+  { "R_TILEGX_IMM16_X1_HW3_PCREL", R_TILEGX_IMM16_X1_HW3_PCREL, 0 },
+  { "R_TILEPRO_IMM16_X1_TLS_IE", R_TILEPRO_IMM16_X1_TLS_IE, 0 },
+  { "R_NIOS2_GOTOFF_LO", R_NIOS2_GOTOFF_LO, 0 },
+  { "R_CKCORE_PCRELIMM8BY4", R_CKCORE_PCRELIMM8BY4, 0 },
+  { "R_MICROBLAZE_32", R_MICROBLAZE_32, 0 },
+  { "R_M32R_GOTOFF_HI_SLO", R_M32R_GOTOFF_HI_SLO, 0 },
+  { "R_CRIS_GNU_VTINHERIT", R_CRIS_GNU_VTINHERIT, 0 },
+  { "R_ARC_SDA_LDST", R_ARC_SDA_LDST, 0 },
+  { "R_CRIS_RELATIVE", R_CRIS_RELATIVE, 0 },
+  { "R_AARCH64_TLS_DTPMOD", R_AARCH64_TLS_DTPMOD, 0 },
+  { "R_METAG_RELBRANCH_PLT", R_METAG_RELBRANCH_PLT, 0 },
+  { "R_OR1K_TLS_LE_HI16", R_OR1K_TLS_LE_HI16, 0 },
+  { "R_TILEGX_IMM16_X0_HW0_LAST_TLS_GD", R_TILEGX_IMM16_X0_HW0_LAST_TLS_GD, 0 },
+  { "R_OR1K_TLS_GD_LO16", R_OR1K_TLS_GD_LO16, R_OR1K_TLS_GD_HI16 - R_OR1K_TLS_GD_LO16 },
+  { "R_TILEGX_MMEND_X0", R_TILEGX_MMEND_X0, 0 },
+  { "R_ARC_RELATIVE", R_ARC_RELATIVE, 0 },
+  { "R_OR1K_TLS_IE_HI16", R_OR1K_TLS_IE_HI16, 0 },
+  { "R_M32R_GOTOFF", R_M32R_GOTOFF, 0 },
+  { "R_TILEGX_IMM8_X0_TLS_GD_ADD", R_TILEGX_IMM8_X0_TLS_GD_ADD, 0 },
+  { "R_TILEGX_IMM16_X0_HW0_LAST_TLS_IE", R_TILEGX_IMM16_X0_HW0_LAST_TLS_IE, 0 },
+  { "R_METAG_REL16", R_METAG_REL16, 0 },
+  { "R_MICROBLAZE_GOTOFF_64", R_MICROBLAZE_GOTOFF_64, 0 },
+  { "R_TILEGX_8_PCREL", R_TILEGX_8_PCREL, 0 },
+  { "R_CKCORE_TOFFSET_LO16", R_CKCORE_TOFFSET_LO16, 0 },
+  { "R_NDS32_TLS_DESC", R_NDS32_TLS_DESC, 0 },
+  { "R_RISCV_ADD64", R_RISCV_ADD64, 0 },
+  { "R_TILEPRO_DEST_IMM8_X1", R_TILEPRO_DEST_IMM8_X1, 0 },
+  { "R_TILEGX_IMM16_X1_HW0", R_TILEGX_IMM16_X1_HW0, 0 },
+  { "R_AARCH64_MOVW_GOTOFF_G0_NC", R_AARCH64_MOVW_GOTOFF_G0_NC, 0 },
+  { "R_TILEGX_IMM16_X1_HW1", R_TILEGX_IMM16_X1_HW1, 0 },
+  { "R_TILEGX_IMM16_X0_HW0_LAST_TLS_LE", R_TILEGX_IMM16_X0_HW0_LAST_TLS_LE, 0 },
+  { "R_TILEPRO_IMM16_X1_HI", R_TILEPRO_IMM16_X1_HI, 0 },
+  { "R_M32R_REL32", R_M32R_REL32, 0 },
+  { "R_RISCV_SUB6", R_RISCV_SUB6, 0 },
+  { "R_AARCH64_MOVW_UABS_G2", R_AARCH64_MOVW_UABS_G2, 0 },
+  { "R_AARCH64_MOVW_UABS_G3", R_AARCH64_MOVW_UABS_G3, 0 },
+  { "R_TILEGX_IMM16_X1_HW1_LAST_GOT", R_TILEGX_IMM16_X1_HW1_LAST_GOT, 0 },
+  { "R_NIOS2_TLS_LE16", R_NIOS2_TLS_LE16, 0 },
+  { "R_M32R_GOTPC_LO", R_M32R_GOTPC_LO, 0 },
+  { "R_TILEGX_IMM16_X1_HW2", R_TILEGX_IMM16_X1_HW2, 0 },
+  { "R_TILEGX_IMM16_X1_HW3", R_TILEGX_IMM16_X1_HW3, 0 },
+  { "R_AC_SECTOFF_S9_1", R_AC_SECTOFF_S9_1, 0 },
+  { "R_MICROBLAZE_64_NONE", R_MICROBLAZE_64_NONE, 0 },
+  { "R_TILEGX_IMM8_Y1_TLS_GD_ADD", R_TILEGX_IMM8_Y1_TLS_GD_ADD, 0 },
+  { "R_TILEGX_GNU_VTENTRY", R_TILEGX_GNU_VTENTRY, 0 },
+  { "R_M32R_10_PCREL", R_M32R_10_PCREL, 0 },
+  { "R_CKCORE_PCREL_IMM26BY2", R_CKCORE_PCREL_IMM26BY2, 0 },
+  { "R_ARC_SECTOFF_1", R_ARC_SECTOFF_1, 0 },
+  { "R_ARC_SECTOFF_2", R_ARC_SECTOFF_2, 0 },
+  { "R_CKCORE_ADDRPLT_HI16", R_CKCORE_ADDRPLT_HI16, 0 },
+  { "R_RISCV_TPREL_LO12_I", R_RISCV_TPREL_LO12_I, 0 },
+  { "R_TILEPRO_IMM16_X1_LO", R_TILEPRO_IMM16_X1_LO, R_TILEPRO_IMM16_X1_HI - R_TILEPRO_IMM16_X1_LO },
+  { "R_TILEGX_IMM16_X1_HW2_PCREL", R_TILEGX_IMM16_X1_HW2_PCREL, 0 },
+  { "R_NIOS2_GLOB_DAT", R_NIOS2_GLOB_DAT, 0 },
+  { "R_AARCH64_MOVW_SABS_G0", R_AARCH64_MOVW_SABS_G0, 0 },
+  { "R_AARCH64_MOVW_SABS_G1", R_AARCH64_MOVW_SABS_G1, 0 },
+  { "R_AARCH64_MOVW_SABS_G2", R_AARCH64_MOVW_SABS_G2, 0 },
+  { "R_TILEPRO_IMM16_X0_GOT_HA", R_TILEPRO_IMM16_X0_GOT_HA, 0 },
+  { "R_AARCH64_TLSLE_MOVW_TPREL_G2", R_AARCH64_TLSLE_MOVW_TPREL_G2, 0 },
+  { "R_TILEGX_TLS_TPOFF64", R_TILEGX_TLS_TPOFF64, 0 },
+  { "R_RISCV_32", R_RISCV_32, 0 },
+  { "R_METAG_REG16OP1", R_METAG_REG16OP1, 0 },
+  { "R_TILEGX_IMM16_X0_HW2_LAST_PCREL", R_TILEGX_IMM16_X0_HW2_LAST_PCREL, 0 },
+  { "R_TILEGX_IMM16_X1_HW0_LAST_TLS_GD", R_TILEGX_IMM16_X1_HW0_LAST_TLS_GD, 0 },
+  { "R_NIOS2_CALL_LO", R_NIOS2_CALL_LO, 0 },
+  { "R_AARCH64_TLSGD_MOVW_G1", R_AARCH64_TLSGD_MOVW_G1, 0 },
+  { "R_NIOS2_CJMP", R_NIOS2_CJMP, 0 },
+  { "R_LARCH_64", R_LARCH_64, 0 },
+  { "R_AARCH64_TLSLD_LDST64_DTPREL_LO12", R_AARCH64_TLSLD_LDST64_DTPREL_LO12, 0 },
+  { "R_TILEGX_IMM16_X1_HW0_LAST_TLS_IE", R_TILEGX_IMM16_X1_HW0_LAST_TLS_IE, 0 },
+  { "R_TILEGX_IMM16_X1_HW0_PCREL", R_TILEGX_IMM16_X1_HW0_PCREL, 0 },
+  { "R_TILEGX_MF_IMM14_X1", R_TILEGX_MF_IMM14_X1, 0 },
+  { "R_OR1K_TLS_DTPOFF", R_OR1K_TLS_DTPOFF, 0 },
+  { "R_NIOS2_JUMP_SLOT", R_NIOS2_JUMP_SLOT, 0 },
+  { "R_RISCV_GOT_HI20", R_RISCV_GOT_HI20, 0 },
+  { "R_TILEPRO_IMM16_X0_GOT_LO", R_TILEPRO_IMM16_X0_GOT_LO, R_TILEPRO_IMM16_X0_GOT_HI - R_TILEPRO_IMM16_X0_GOT_LO },
+  { "R_LARCH_MARK_PCREL", R_LARCH_MARK_PCREL, 0 },
+  { "R_TILEPRO_NONE", R_TILEPRO_NONE, 0 },
+  { "R_TILEGX_IMM16_X1_HW0_LAST_TLS_LE", R_TILEGX_IMM16_X1_HW0_LAST_TLS_LE, 0 },
+  { "R_LARCH_SOP_PUSH_GPREL", R_LARCH_SOP_PUSH_GPREL, 0 },
+  { "R_RISCV_64", R_RISCV_64, 0 },
+  { "R_OR1K_GOTPC_HI16", R_OR1K_GOTPC_HI16, 0 },
+  { "R_OR1K_TLS_IE_LO16", R_OR1K_TLS_IE_LO16, R_OR1K_TLS_IE_HI16 - R_OR1K_TLS_IE_LO16 },
+  { "R_AARCH64_LDST32_ABS_LO12_NC", R_AARCH64_LDST32_ABS_LO12_NC, 0 },
+  { "R_AARCH64_TSTBR14", R_AARCH64_TSTBR14, 0 },
+  { "R_METAG_GNU_VTINHERIT", R_METAG_GNU_VTINHERIT, 0 },
+  { "R_AARCH64_ABS32", R_AARCH64_ABS32, 0 },
+  { "R_TILEGX_IMM16_X0_HW1_LAST_PLT_PCREL", R_TILEGX_IMM16_X0_HW1_LAST_PLT_PCREL, 0 },
+  { "R_TILEPRO_IMM8_Y0_TLS_GD_ADD", R_TILEPRO_IMM8_Y0_TLS_GD_ADD, 0 },
+  { "R_M32R_26_PLTREL", R_M32R_26_PLTREL, 0 },
+  { "R_METAG_TLS_IENONPIC", R_METAG_TLS_IENONPIC, 0 },
+  { "R_LARCH_RELATIVE", R_LARCH_RELATIVE, 0 },
+  { "R_M32R_NUM", R_M32R_NUM, 0 },
+  { "R_TILEGX_IMM16_X1_HW0_GOT", R_TILEGX_IMM16_X1_HW0_GOT, 0 },
+  { "R_METAG_LOOG", R_METAG_LOOG, R_METAG_HIOG - R_METAG_LOOG },
+  { "R_M32R_26_PCREL", R_M32R_26_PCREL, 0 },
+  { "R_TILEGX_IMM16_X0_HW0", R_TILEGX_IMM16_X0_HW0, 0 },
+  { "R_TILEPRO_IMM16_X1_TLS_LE_HI", R_TILEPRO_IMM16_X1_TLS_LE_HI, 0 },
+  { "R_TILEGX_IMM16_X0_HW2", R_TILEGX_IMM16_X0_HW2, 0 },
+  { "R_TILEPRO_IMM16_X1_HI_PCREL", R_TILEPRO_IMM16_X1_HI_PCREL, 0 },
+  { "R_CKCORE_PCREL_IMM16BY2", R_CKCORE_PCREL_IMM16BY2, 0 },
+  { "R_CKCORE_PCREL_IMM16BY4", R_CKCORE_PCREL_IMM16BY4, 0 },
+  { "R_NIOS2_COPY", R_NIOS2_COPY, 0 },
+  { "R_CKCORE_ADDRPLT_LO16", R_CKCORE_ADDRPLT_LO16, R_CKCORE_ADDRPLT_HI16 - R_CKCORE_ADDRPLT_LO16 },
+  { "R_METAG_RELBRANCH", R_METAG_RELBRANCH, 0 },
+  { "R_TILEPRO_IMM16_X1_TLS_GD_HA", R_TILEPRO_IMM16_X1_TLS_GD_HA, 0 },
+  { "R_CKCORE_PLT_IMM18BY4", R_CKCORE_PLT_IMM18BY4, 0 },
+  { "R_AARCH64_TLSLD_MOVW_DTPREL_G1_NC", R_AARCH64_TLSLD_MOVW_DTPREL_G1_NC, 0 },
+  { "R_M32R_HI16_ULO_RELA", R_M32R_HI16_ULO_RELA, 0 },
+  { "R_AARCH64_ADR_PREL_LO21", R_AARCH64_ADR_PREL_LO21, 0 },
+  { "R_AARCH64_MOVW_UABS_G2_NC", R_AARCH64_MOVW_UABS_G2_NC, 0 },
+  { "R_RISCV_32_PCREL", R_RISCV_32_PCREL, 0 },
+  { "R_AARCH64_MOVW_GOTOFF_G0", R_AARCH64_MOVW_GOTOFF_G0, 0 },
+  { "R_AARCH64_MOVW_GOTOFF_G1", R_AARCH64_MOVW_GOTOFF_G1, 0 },
+  { "R_AARCH64_TLSGD_ADD_LO12_NC", R_AARCH64_TLSGD_ADD_LO12_NC, 0 },
+  { "R_TILEGX_MT_IMM14_X1", R_TILEGX_MT_IMM14_X1, 0 },
+  { "R_CKCORE_PCREL32", R_CKCORE_PCREL32, 0 },
+  { "R_LARCH_JUMP_SLOT", R_LARCH_JUMP_SLOT, 0 },
+  { "R_ARC_COPY", R_ARC_COPY, 0 },
+  { "R_TILEPRO_TLS_DTPMOD32", R_TILEPRO_TLS_DTPMOD32, 0 },
+  { "R_LARCH_SOP_POP_32_S_10_16_S2", R_LARCH_SOP_POP_32_S_10_16_S2, 0 },
+  { "R_CRIS_GLOB_DAT", R_CRIS_GLOB_DAT, 0 },
+  { "R_AARCH64_TLSLD_MOVW_DTPREL_G2", R_AARCH64_TLSLD_MOVW_DTPREL_G2, 0 },
+  { "R_TILEPRO_IMM16_X1_TLS_GD", R_TILEPRO_IMM16_X1_TLS_GD, 0 },
+  { "R_OR1K_GOT16", R_OR1K_GOT16, 0 },
+  { "R_M32R_16", R_M32R_16, 0 },
+  { "R_LARCH_32", R_LARCH_32, 0 },
+  { "R_AARCH64_GOTREL32", R_AARCH64_GOTREL32, 0 },
+  { "R_RISCV_GPREL_S", R_RISCV_GPREL_S, 0 },
+  { "R_ARC_GLOB_DAT", R_ARC_GLOB_DAT, 0 },
+  { "R_LARCH_SOP_POP_32_S_10_5", R_LARCH_SOP_POP_32_S_10_5, 0 },
+  { "R_ARC_SECTOFF_ME", R_ARC_SECTOFF_ME, 0 },
+  { "R_ARC_SECTOFF", R_ARC_SECTOFF, 0 },
+  { "R_ARC_SDA32_ME", R_ARC_SDA32_ME, 0 },
+  { "R_RISCV_TPREL_LO12_S", R_RISCV_TPREL_LO12_S, 0 },
+  { "R_ARC_SDA16_LD1", R_ARC_SDA16_LD1, 0 },
+  { "R_ARC_SDA16_LD2", R_ARC_SDA16_LD2, 0 },
+  { "R_NIOS2_CALL26", R_NIOS2_CALL26, 0 },
+  { "R_AARCH64_GOTREL64", R_AARCH64_GOTREL64, 0 },
+  { "R_LARCH_SOP_POP_32_S_10_16", R_LARCH_SOP_POP_32_S_10_16, 0 },
+  { "R_M32R_JMP_SLOT", R_M32R_JMP_SLOT, 0 },
+  { "R_AARCH64_TLSIE_ADR_GOTTPREL_PAGE21", R_AARCH64_TLSIE_ADR_GOTTPREL_PAGE21, 0 },
+  { "R_OR1K_GOTPC_LO16", R_OR1K_GOTPC_LO16, R_OR1K_GOTPC_HI16 - R_OR1K_GOTPC_LO16 },
+  { "R_CRIS_16", R_CRIS_16, 0 },
+  { "R_TILEPRO_MMEND_X1", R_TILEPRO_MMEND_X1, 0 },
+  { "R_CKCORE_ADDRGOT_HI16", R_CKCORE_ADDRGOT_HI16, 0 },
+  { "R_NDS32_NONE", R_NDS32_NONE, 0 },
+  { "R_M32R_24_RELA", R_M32R_24_RELA, 0 },
+  { "R_MICROBLAZE_GOTPC_64", R_MICROBLAZE_GOTPC_64, 0 },
+  { "R_TILEGX_HW0_LAST", R_TILEGX_HW0_LAST, 0 },
+  { "R_CRIS_32", R_CRIS_32, 0 },
+  { "R_M32R_COPY", R_M32R_COPY, 0 },
+  { "R_TILEPRO_IMM16_X1_GOT_HA", R_TILEPRO_IMM16_X1_GOT_HA, 0 },
+  { "R_MN10300_TLS_DTPMOD", R_MN10300_TLS_DTPMOD, 0 },
+  { "R_METAG_TLS_GD", R_METAG_TLS_GD, 0 },
+  { "R_ARC_SECTOFF_S9", R_ARC_SECTOFF_S9, 0 },
+  { "R_ARC_N32_ME", R_ARC_N32_ME, 0 },
+  { "R_TILEPRO_IMM16_X0_TLS_GD", R_TILEPRO_IMM16_X0_TLS_GD, 0 },
+  { "R_M32R_RELA_GNU_VTINHERIT", R_M32R_RELA_GNU_VTINHERIT, 0 },
+  { "R_ARC_GOTOFF", R_ARC_GOTOFF, 0 },
+  { "R_AARCH64_TLSLD_ADR_PREL21", R_AARCH64_TLSLD_ADR_PREL21, 0 },
+  { "R_TILEPRO_MMSTART_X1", R_TILEPRO_MMSTART_X1, 0 },
+  { "R_METAG_TLS_IE", R_METAG_TLS_IE, 0 },
+  { "R_ARC_SECTOFF_U8", R_ARC_SECTOFF_U8, 0 },
+  { "R_TILEPRO_NUM", R_TILEPRO_NUM, 0 },
+  { "R_CKCORE_GOT12", R_CKCORE_GOT12, 0 },
+  { "R_OR1K_TLS_GD_HI16", R_OR1K_TLS_GD_HI16, 0 },
+  { "R_NIOS2_HI16", R_NIOS2_HI16, 0 },
+  { "R_LARCH_ADD16", R_LARCH_ADD16, 0 },
+  { "R_TILEPRO_IMM16_X0_TLS_IE", R_TILEPRO_IMM16_X0_TLS_IE, 0 },
+  { "R_TILEGX_IMM16_X1_HW2_LAST_PCREL", R_TILEGX_IMM16_X1_HW2_LAST_PCREL, 0 },
+  { "R_TILEGX_IMM16_X0_HW3_PLT_PCREL", R_TILEGX_IMM16_X0_HW3_PLT_PCREL, 0 },
+  { "R_AARCH64_TLSLE_LDST128_TPREL_LO12_NC", R_AARCH64_TLSLE_LDST128_TPREL_LO12_NC, 0 },
+  { "R_MICROBLAZE_32_PCREL", R_MICROBLAZE_32_PCREL, 0 },
+  { "R_BPF_64_32", R_BPF_64_32, 0 },
+  { "R_M32R_LO16_RELA", R_M32R_LO16_RELA, 0 },
+  { "R_LARCH_COPY", R_LARCH_COPY, 0 },
+  { "R_RISCV_BRANCH", R_RISCV_BRANCH, 0 },
+  { "R_METAG_TLS_LE", R_METAG_TLS_LE, 0 },
+  { "R_NIOS2_GOT_HA", R_NIOS2_GOT_HA, 0 },
+  { "R_RISCV_LO12_S", R_RISCV_LO12_S, 0 },
+  { "R_ARC_S25W_PCREL", R_ARC_S25W_PCREL, 0 },
+  { "R_AARCH64_LDST128_ABS_LO12_NC", R_AARCH64_LDST128_ABS_LO12_NC, 0 },
+  { "R_METAG_GNU_VTENTRY", R_METAG_GNU_VTENTRY, 0 },
+  { "R_TILEPRO_IMM16_X0_TLS_LE", R_TILEPRO_IMM16_X0_TLS_LE, 0 },
+  { "R_OR1K_8", R_OR1K_8, 0 },
+  { "R_TILEPRO_GNU_VTINHERIT", R_TILEPRO_GNU_VTINHERIT, 0 },
+  { "R_BPF_64_64", R_BPF_64_64, 0 },
+  { "R_ARC_GOTPC32", R_ARC_GOTPC32, 0 },
+  { "R_CKCORE_TLS_TPOFF32", R_CKCORE_TLS_TPOFF32, 0 },
+  { "R_TILEGX_IMM16_X1_HW2_LAST_PLT_PCREL", R_TILEGX_IMM16_X1_HW2_LAST_PLT_PCREL, 0 },
+  { "R_AARCH64_TLSDESC_ADD_LO12", R_AARCH64_TLSDESC_ADD_LO12, 0 },
+  { "R_AARCH64_TLSLD_LDST32_DTPREL_LO12_NC", R_AARCH64_TLSLD_LDST32_DTPREL_LO12_NC, 0 },
+  { "R_LARCH_ADD64", R_LARCH_ADD64, 0 },
+  { "R_AARCH64_TLSLD_ADD_DTPREL_LO12_NC", R_AARCH64_TLSLD_ADD_DTPREL_LO12_NC, 0 },
+  { "R_RISCV_RVC_BRANCH", R_RISCV_RVC_BRANCH, 0 },
+  { "R_AC_SECTOFF_U8_1", R_AC_SECTOFF_U8_1, 0 },
+  { "R_LARCH_SOP_SL", R_LARCH_SOP_SL, 0 },
+  { "R_CRIS_16_GOTPLT", R_CRIS_16_GOTPLT, 0 },
+  { "R_LARCH_SOP_SR", R_LARCH_SOP_SR, 0 },
+  { "R_MN10300_PLT16", R_MN10300_PLT16, 0 },
+  { "R_NIOS2_GOT_LO", R_NIOS2_GOT_LO, 0 },
+  { "R_M32R_24", R_M32R_24, 0 },
+  { "R_AARCH64_MOVW_GOTOFF_G2", R_AARCH64_MOVW_GOTOFF_G2, 0 },
+  { "R_AARCH64_MOVW_GOTOFF_G3", R_AARCH64_MOVW_GOTOFF_G3, 0 },
+  { "R_MN10300_PLT32", R_MN10300_PLT32, 0 },
+  { "R_AARCH64_TLSLE_ADD_TPREL_HI12", R_AARCH64_TLSLE_ADD_TPREL_HI12, 0 },
+  { "R_TILEPRO_RELATIVE", R_TILEPRO_RELATIVE, 0 },
+  { "R_RISCV_SUB32", R_RISCV_SUB32, 0 },
+  { "R_CKCORE_TLS_LDO32", R_CKCORE_TLS_LDO32, 0 },
+  { "R_TILEPRO_IMM8_X1_TLS_GD_ADD", R_TILEPRO_IMM8_X1_TLS_GD_ADD, 0 },
+  { "R_ARC_32_ME", R_ARC_32_ME, 0 },
+  { "R_TILEPRO_IMM16_X1_TLS_LE_LO", R_TILEPRO_IMM16_X1_TLS_LE_LO, R_TILEPRO_IMM16_X1_TLS_LE_HI - R_TILEPRO_IMM16_X1_TLS_LE_LO },
+  { "R_CRIS_8_PCREL", R_CRIS_8_PCREL, 0 },
+  { "R_ARC_SDA16_LD", R_ARC_SDA16_LD, 0 },
+  { "R_AARCH64_TLSLD_LD_PREL19", R_AARCH64_TLSLD_LD_PREL19, 0 },
+  { "R_TILEPRO_JMP_SLOT", R_TILEPRO_JMP_SLOT, 0 },
+  { "R_RISCV_SUB64", R_RISCV_SUB64, 0 },
+  { "R_RISCV_LO12_I", R_RISCV_LO12_I, 0 },
+  { "R_TILEGX_IMM16_X0_HW1_LAST_PCREL", R_TILEGX_IMM16_X0_HW1_LAST_PCREL, 0 },
+  { "R_ARC_TLS_DTPMOD", R_ARC_TLS_DTPMOD, 0 },
+  { "R_AARCH64_P32_JUMP_SLOT", R_AARCH64_P32_JUMP_SLOT, 0 },
+  { "R_OR1K_JMP_SLOT", R_OR1K_JMP_SLOT, 0 },
+  { "R_NDS32_COPY", R_NDS32_COPY, 0 },
+  { "R_TILEGX_16_PCREL", R_TILEGX_16_PCREL, 0 },
+  { "R_ARC_N16", R_ARC_N16, 0 },
+  { "R_LARCH_SOP_PUSH_DUP", R_LARCH_SOP_PUSH_DUP, 0 },
+  { "R_MN10300_RELATIVE", R_MN10300_RELATIVE, 0 },
+  { "R_TILEGX_TLS_GD_CALL", R_TILEGX_TLS_GD_CALL, 0 },
+  { "R_AARCH64_TLSLE_LDST64_TPREL_LO12_NC", R_AARCH64_TLSLE_LDST64_TPREL_LO12_NC, 0 },
+  { "R_ARC_N24", R_ARC_N24, 0 },
+  { "R_AARCH64_TLSLD_MOVW_G0_NC", R_AARCH64_TLSLD_MOVW_G0_NC, 0 },
+  { "R_AARCH64_TLSLE_MOVW_TPREL_G1_NC", R_AARCH64_TLSLE_MOVW_TPREL_G1_NC, 0 },
+  { "R_METAG_HI16_PLT", R_METAG_HI16_PLT, 0 },
+  { "R_ARC_N32", R_ARC_N32, 0 },
+  { "R_AARCH64_TLSLE_LDST64_TPREL_LO12", R_AARCH64_TLSLE_LDST64_TPREL_LO12, 0 },
+  { "R_LARCH_SOP_ASSERT", R_LARCH_SOP_ASSERT, 0 },
+  { "R_MN10300_JMP_SLOT", R_MN10300_JMP_SLOT, 0 },
+  { "R_TILEGX_IMM16_X0_HW1_PLT_PCREL", R_TILEGX_IMM16_X0_HW1_PLT_PCREL, 0 },
+  { "R_RISCV_RVC_JUMP", R_RISCV_RVC_JUMP, 0 },
+  { "R_ARC_PLT32", R_ARC_PLT32, 0 },
+  { "R_CKCORE_PCREL_IMM18BY2", R_CKCORE_PCREL_IMM18BY2, 0 },
+  { "R_TILEGX_HW1_LAST", R_TILEGX_HW1_LAST, 0 },
+  { "R_AARCH64_NONE", R_AARCH64_NONE, 0 },
+  { "R_ARC_GOT32", R_ARC_GOT32, 0 },
+  { "R_LARCH_SOP_POP_32_S_5_20", R_LARCH_SOP_POP_32_S_5_20, 0 },
+  { "R_NIOS2_TLS_DTPMOD", R_NIOS2_TLS_DTPMOD, 0 },
+  { "R_TILEGX_IMM16_X0_HW0_LAST", R_TILEGX_IMM16_X0_HW0_LAST, 0 },
+  { "R_ARC_TLS_LE_32", R_ARC_TLS_LE_32, 0 },
+  { "R_M32R_18_PCREL", R_M32R_18_PCREL, 0 },
+  { "R_NDS32_TLS_TPOFF", R_NDS32_TLS_TPOFF, 0 },
+  { "R_MN10300_GOTOFF16", R_MN10300_GOTOFF16, 0 },
+  { "R_CRIS_32_GOTREL", R_CRIS_32_GOTREL, 0 },
+  { "R_ARC_H30_ME", R_ARC_H30_ME, 0 },
+  { "R_LARCH_SUB16", R_LARCH_SUB16, 0 },
+  { "R_OR1K_NONE", R_OR1K_NONE, 0 },
+  { "R_NIOS2_TLS_LDO16", R_NIOS2_TLS_LDO16, 0 },
+  { "R_NDS32_32_RELA", R_NDS32_32_RELA, 0 },
+  { "R_OR1K_32", R_OR1K_32, 0 },
+  { "R_MICROBLAZE_GNU_VTENTRY", R_MICROBLAZE_GNU_VTENTRY, 0 },
+  { "R_TILEGX_TLS_TPOFF32", R_TILEGX_TLS_TPOFF32, 0 },
+  { "R_AARCH64_TLSLE_ADD_TPREL_LO12", R_AARCH64_TLSLE_ADD_TPREL_LO12, R_AARCH64_TLSLE_ADD_TPREL_HI12 - R_AARCH64_TLSLE_ADD_TPREL_LO12 },
+  { "R_ARC_8", R_ARC_8, 0 },
+  { "R_NIOS2_NONE", R_NIOS2_NONE, 0 },
+  { "R_ARC_W", R_ARC_W, 0 },
+  { "R_M32R_GOT16_HI_ULO", R_M32R_GOT16_HI_ULO, 0 },
+  { "R_CKCORE_PLT_HI16", R_CKCORE_PLT_HI16, 0 },
+  { "R_ARC_TLS_GD_LD", R_ARC_TLS_GD_LD, 0 },
+  { "R_AARCH64_TLSLE_LDST16_TPREL_LO12", R_AARCH64_TLSLE_LDST16_TPREL_LO12, 0 },
+  { "R_TILEGX_IMM16_X1_HW0_LAST", R_TILEGX_IMM16_X1_HW0_LAST, 0 },
+  { "R_RISCV_TLS_GD_HI20", R_RISCV_TLS_GD_HI20, 0 },
+  { "R_CKCORE_ADDRGOT", R_CKCORE_ADDRGOT, 0 },
+  { "R_LARCH_TLS_DTPMOD32", R_LARCH_TLS_DTPMOD32, 0 },
+  { "R_NDS32_RELATIVE", R_NDS32_RELATIVE, 0 },
+  { "R_LARCH_IRELATIVE", R_LARCH_IRELATIVE, 0 },
+  { "R_ARC_16", R_ARC_16, 0 },
+  { "R_TILEPRO_JOFFLONG_X1", R_TILEPRO_JOFFLONG_X1, 0 },
+  { "R_M32R_RELA_GNU_VTENTRY", R_M32R_RELA_GNU_VTENTRY, 0 },
+  { "R_LARCH_TLS_TPREL32", R_LARCH_TLS_TPREL32, 0 },
+  { "R_CKCORE_GOTPC", R_CKCORE_GOTPC, 0 },
+  { "R_ARC_32", R_ARC_32, 0 },
+  { "R_OR1K_TLS_LE_LO16", R_OR1K_TLS_LE_LO16, R_OR1K_TLS_LE_HI16 - R_OR1K_TLS_LE_LO16 },
+  { "R_NDS32_JMP_SLOT", R_NDS32_JMP_SLOT, 0 },
+  { "R_OR1K_INSN_REL_26", R_OR1K_INSN_REL_26, 0 },
+  { "R_LARCH_TLS_DTPMOD64", R_LARCH_TLS_DTPMOD64, 0 },
+  { "R_ARC_PC32", R_ARC_PC32, 0 },
+  { "R_TILEGX_IMM8_Y1_TLS_ADD", R_TILEGX_IMM8_Y1_TLS_ADD, 0 },
+  { "R_LARCH_TLS_TPREL64", R_LARCH_TLS_TPREL64, 0 },
+  { "R_M32R_GOTPC24", R_M32R_GOTPC24, 0 },
+  { "R_CKCORE_ADDR_HI16", R_CKCORE_ADDR_HI16, 0 },
+  { "R_RISCV_ALIGN", R_RISCV_ALIGN, 0 },
+  { "R_TILEPRO_IMM16_X0_GOT_HI", R_TILEPRO_IMM16_X0_GOT_HI, 0 },
+  { "R_NIOS2_CALLR", R_NIOS2_CALLR, 0 },
+  { "R_MN10300_PCREL8", R_MN10300_PCREL8, 0 },
+  { "R_OR1K_TLS_LDM_HI16", R_OR1K_TLS_LDM_HI16, 0 },
+  { "R_TILEGX_IMM16_X0_HW2_PCREL", R_TILEGX_IMM16_X0_HW2_PCREL, 0 },
+  { "R_TILEGX_IMM16_X1_HW2_LAST", R_TILEGX_IMM16_X1_HW2_LAST, 0 },
+  { "R_TILEGX_TLS_IE_LOAD", R_TILEGX_TLS_IE_LOAD, 0 },
+  { "R_OR1K_TLS_TPOFF", R_OR1K_TLS_TPOFF, 0 },
+  { "R_TILEPRO_IMM16_X1_GOT_LO", R_TILEPRO_IMM16_X1_GOT_LO, R_TILEPRO_IMM16_X1_GOT_HI - R_TILEPRO_IMM16_X1_GOT_LO },
+  { "R_TILEGX_MMSTART_X0", R_TILEGX_MMSTART_X0, 0 },
+  { "R_TILEPRO_IMM16_X1_TLS_IE_HA", R_TILEPRO_IMM16_X1_TLS_IE_HA, 0 },
+  { "R_TILEPRO_IMM16_X1_TLS_IE_HI", R_TILEPRO_IMM16_X1_TLS_IE_HI, 0 },
+  { "R_TILEGX_IMM16_X1_HW0_LAST_GOT", R_TILEGX_IMM16_X1_HW0_LAST_GOT, 0 },
+  { "R_RISCV_TPREL_S", R_RISCV_TPREL_S, 0 },
+  { "R_ARC_SDA_LDST1", R_ARC_SDA_LDST1, 0 },
+  { "R_AARCH64_LD64_GOTOFF_LO15", R_AARCH64_LD64_GOTOFF_LO15, 0 },
+  { "R_AARCH64_LDST8_ABS_LO12_NC", R_AARCH64_LDST8_ABS_LO12_NC, 0 },
+  { "R_ARC_SDA_LDST2", R_ARC_SDA_LDST2, 0 },
+  { "R_TILEPRO_IMM16_X1_TLS_LE_HA", R_TILEPRO_IMM16_X1_TLS_LE_HA, 0 },
+  { "R_TILEPRO_HA16", R_TILEPRO_HA16, 0 },
+  { "R_TILEPRO_8_PCREL", R_TILEPRO_8_PCREL, 0 },
+  { "R_MICROBLAZE_SRW32", R_MICROBLAZE_SRW32, 0 },
+  { "R_AARCH64_COPY", R_AARCH64_COPY, 0 },
+  { "R_RISCV_JAL", R_RISCV_JAL, 0 },
+  { "R_TILEGX_IMM16_X0_HW0_PCREL", R_TILEGX_IMM16_X0_HW0_PCREL, 0 },
+  { "R_AARCH64_TLSDESC_CALL", R_AARCH64_TLSDESC_CALL, 0 },
+  { "R_TILEPRO_SHAMT_Y0", R_TILEPRO_SHAMT_Y0, 0 },
+  { "R_TILEPRO_IMM16_X1_TLS_IE_LO", R_TILEPRO_IMM16_X1_TLS_IE_LO, R_TILEPRO_IMM16_X1_TLS_IE_HI - R_TILEPRO_IMM16_X1_TLS_IE_LO },
+  { "R_TILEGX_64_PCREL", R_TILEGX_64_PCREL, 0 },
+  { "R_TILEGX_IMM16_X0_HW1", R_TILEGX_IMM16_X0_HW1, 0 },
+  { "R_TILEGX_IMM16_X0_HW1_LAST_GOT", R_TILEGX_IMM16_X0_HW1_LAST_GOT, 0 },
+  { "R_AARCH64_TLSIE_LD64_GOTTPREL_LO12_NC", R_AARCH64_TLSIE_LD64_GOTTPREL_LO12_NC, 0 },
+  { "R_OR1K_LO_16_IN_INSN", R_OR1K_LO_16_IN_INSN, R_OR1K_HI_16_IN_INSN - R_OR1K_LO_16_IN_INSN },
+  { "R_RISCV_GNU_VTINHERIT", R_RISCV_GNU_VTINHERIT, 0 },
+  { "R_TILEGX_NONE", R_TILEGX_NONE, 0 },
+  { "R_CKCORE_RELATIVE", R_CKCORE_RELATIVE, 0 },
+  { "R_AARCH64_TLS_DTPREL", R_AARCH64_TLS_DTPREL, 0 },
+  { "R_MN10300_PCREL16", R_MN10300_PCREL16, 0 },
+  { "R_LARCH_NONE", R_LARCH_NONE, 0 },
+  { "R_METAG_REG16OP2", R_METAG_REG16OP2, 0 },
+  { "R_TILEGX_HW2_LAST", R_TILEGX_HW2_LAST, 0 },
+  { "R_METAG_REG16OP3", R_METAG_REG16OP3, 0 },
+  { "R_TILEGX_IMM16_X0_HW0_GOT", R_TILEGX_IMM16_X0_HW0_GOT, 0 },
+  { "R_NIOS2_GNU_VTENTRY", R_NIOS2_GNU_VTENTRY, 0 },
+  { "R_AARCH64_TLSDESC_ADD", R_AARCH64_TLSDESC_ADD, 0 },
+  { "R_CKCORE_PLT_LO16", R_CKCORE_PLT_LO16, R_CKCORE_PLT_HI16 - R_CKCORE_PLT_LO16 },
+  { "R_OR1K_COPY", R_OR1K_COPY, 0 },
+  { "R_MICROBLAZE_TLSDTPMOD32", R_MICROBLAZE_TLSDTPMOD32, 0 },
+  { "R_TILEPRO_IMM16_X0", R_TILEPRO_IMM16_X0, 0 },
+  { "R_TILEPRO_IMM16_X1", R_TILEPRO_IMM16_X1, 0 },
+  { "R_RISCV_GNU_VTENTRY", R_RISCV_GNU_VTENTRY, 0 },
+  { "R_MICROBLAZE_32_SYM_OP_SYM", R_MICROBLAZE_32_SYM_OP_SYM, 0 },
+  { "R_TILEGX_IMM16_X0_HW1_LAST", R_TILEGX_IMM16_X0_HW1_LAST, 0 },
+  { "R_TILEPRO_IMM16_X0_TLS_LE_HI", R_TILEPRO_IMM16_X0_TLS_LE_HI, 0 },
+  { "R_AARCH64_TLSLD_ADD_LO12_NC", R_AARCH64_TLSLD_ADD_LO12_NC, 0 },
+  { "R_CKCORE_ADDR_LO16", R_CKCORE_ADDR_LO16, R_CKCORE_ADDR_HI16 - R_CKCORE_ADDR_LO16 },
+  { "R_TILEPRO_GNU_VTENTRY", R_TILEPRO_GNU_VTENTRY, 0 },
+  { "R_MICROBLAZE_GOT_64", R_MICROBLAZE_GOT_64, 0 },
+  { "R_NIOS2_BFD_RELOC_32", R_NIOS2_BFD_RELOC_32, 0 },
+  { "R_CKCORE_PCREL_JSR_IMM26BY2", R_CKCORE_PCREL_JSR_IMM26BY2, 0 },
+  { "R_RISCV_PCREL_LO12_I", R_RISCV_PCREL_LO12_I, 0 },
+  { "R_CRIS_GNU_VTENTRY", R_CRIS_GNU_VTENTRY, 0 },
+  { "R_RISCV_RELAX", R_RISCV_RELAX, 0 },
+  { "R_TILEPRO_IMM8_X0_TLS_GD_ADD", R_TILEPRO_IMM8_X0_TLS_GD_ADD, 0 },
+  { "R_LARCH_GNU_VTENTRY", R_LARCH_GNU_VTENTRY, 0 },
+  { "R_MN10300_GLOB_DAT", R_MN10300_GLOB_DAT, 0 },
+  { "R_AARCH64_TLSDESC_LDR", R_AARCH64_TLSDESC_LDR, 0 },
+  { "R_AARCH64_RELATIVE", R_AARCH64_RELATIVE, 0 },
+  { "R_MN10300_ALIGN", R_MN10300_ALIGN, 0 },
+  { "R_NIOS2_PCREL_HA", R_NIOS2_PCREL_HA, 0 },
+  { "R_RISCV_TLS_GOT_HI20", R_RISCV_TLS_GOT_HI20, 0 },
+  { "R_LARCH_SUB8", R_LARCH_SUB8, 0 },
+  { "R_MN10300_GOTPC16", R_MN10300_GOTPC16, 0 },
+  { "R_M32R_32", R_M32R_32, 0 },
+  { "R_METAG_TLS_IENONPIC_HI16", R_METAG_TLS_IENONPIC_HI16, 0 },
+  { "R_LARCH_SUB24", R_LARCH_SUB24, 0 },
+  { "R_TILEPRO_IMM16_X0_TLS_LE_HA", R_TILEPRO_IMM16_X0_TLS_LE_HA, 0 },
+  { "R_AARCH64_CALL26", R_AARCH64_CALL26, 0 },
+  { "R_LARCH_SUB32", R_LARCH_SUB32, 0 },
+  { "R_OR1K_TLS_DTPMOD", R_OR1K_TLS_DTPMOD, 0 },
+  { "R_ARC_TLS_GD_CALL", R_ARC_TLS_GD_CALL, 0 },
+  { "R_LARCH_SOP_PUSH_TLS_TPREL", R_LARCH_SOP_PUSH_TLS_TPREL, 0 },
+  { "R_AARCH64_TLSLD_LDST8_DTPREL_LO12_NC", R_AARCH64_TLSLD_LDST8_DTPREL_LO12_NC, 0 },
+  { "R_NIOS2_PCREL_LO", R_NIOS2_PCREL_LO, 0 },
+  { "R_CRIS_32_GOT", R_CRIS_32_GOT, 0 },
+  { "R_AARCH64_TLSLD_LDST16_DTPREL_LO12", R_AARCH64_TLSLD_LDST16_DTPREL_LO12, 0 },
+  { "R_AARCH64_JUMP26", R_AARCH64_JUMP26, 0 },
+  { "R_CKCORE_GOT_LO16", R_CKCORE_GOT_LO16, R_CKCORE_GOT_HI16 - R_CKCORE_GOT_LO16 },
+  { "R_CKCORE_GOT_HI16", R_CKCORE_GOT_HI16, 0 },
+  { "R_LARCH_SUB64", R_LARCH_SUB64, 0 },
+  { "R_NIOS2_GNU_VTINHERIT", R_NIOS2_GNU_VTINHERIT, 0 },
+  { "R_TILEPRO_IMM16_X0_TLS_LE_LO", R_TILEPRO_IMM16_X0_TLS_LE_LO, R_TILEPRO_IMM16_X0_TLS_LE_HI - R_TILEPRO_IMM16_X0_TLS_LE_LO },
+  { "R_LARCH_MARK_LA", R_LARCH_MARK_LA, 0 },
+  { "R_MN10300_TLS_GOTIE", R_MN10300_TLS_GOTIE, 0 },
+  { "R_AARCH64_MOVW_UABS_G0_NC", R_AARCH64_MOVW_UABS_G0_NC, 0 },
+  { "R_AARCH64_MOVW_GOTOFF_G2_NC", R_AARCH64_MOVW_GOTOFF_G2_NC, 0 },
+  { "R_MICROBLAZE_SRO32", R_MICROBLAZE_SRO32, 0 },
+  { "R_TILEGX_IMM8_X1_TLS_GD_ADD", R_TILEGX_IMM8_X1_TLS_GD_ADD, 0 },
+  { "R_TILEPRO_IMM16_X0_TLS_GD_LO", R_TILEPRO_IMM16_X0_TLS_GD_LO, R_TILEPRO_IMM16_X0_TLS_GD_HI - R_TILEPRO_IMM16_X0_TLS_GD_LO },
+  { "R_OR1K_PLT26", R_OR1K_PLT26, 0 },
+  { "R_MICROBLAZE_TLSGOTTPREL32", R_MICROBLAZE_TLSGOTTPREL32, 0 },
+  { "R_TILEPRO_IMM8_Y1_TLS_GD_ADD", R_TILEPRO_IMM8_Y1_TLS_GD_ADD, 0 },
+  { "R_AARCH64_P32_IRELATIVE", R_AARCH64_P32_IRELATIVE, 0 },
+  { "R_AARCH64_MOVW_PREL_G1_NC", R_AARCH64_MOVW_PREL_G1_NC, 0 },
+  { "R_CRIS_32_GOTPLT", R_CRIS_32_GOTPLT, 0 },
+  { "R_RISCV_SET16", R_RISCV_SET16, 0 },
+  { "R_RISCV_ADD16", R_RISCV_ADD16, 0 },
+  { "R_METAG_LO16_GOTOFF", R_METAG_LO16_GOTOFF, R_METAG_HI16_GOTOFF - R_METAG_LO16_GOTOFF },
+  { "R_NDS32_GLOB_DAT", R_NDS32_GLOB_DAT, 0 },
+  { "R_LARCH_SOP_PUSH_TLS_GOT", R_LARCH_SOP_PUSH_TLS_GOT, 0 },
+  { "R_M32R_GOTPC_HI_SLO", R_M32R_GOTPC_HI_SLO, 0 },
+  { "R_RISCV_SET32", R_RISCV_SET32, 0 },
+  { "R_TILEGX_COPY", R_TILEGX_COPY, 0 },
+  { "R_AARCH64_TLSLD_ADR_PAGE21", R_AARCH64_TLSLD_ADR_PAGE21, 0 },
+  { "R_CRIS_32_PCREL", R_CRIS_32_PCREL, 0 },
+  { "R_NIOS2_S16", R_NIOS2_S16, 0 },
+  { "R_ARC_W_ME", R_ARC_W_ME, 0 },
+  { "R_MICROBLAZE_TLS", R_MICROBLAZE_TLS, 0 },
+  { "R_M32R_10_PCREL_RELA", R_M32R_10_PCREL_RELA, 0 },
+  { "R_NIOS2_RELATIVE", R_NIOS2_RELATIVE, 0 },
+  { "R_RISCV_TLS_DTPMOD32", R_RISCV_TLS_DTPMOD32, 0 },
+  { "R_MN10300_32", R_MN10300_32, 0 },
+  { "R_OR1K_RELATIVE", R_OR1K_RELATIVE, 0 },
+  { "R_CKCORE_PLT12", R_CKCORE_PLT12, 0 },
+  { "R_ARC_SECTOFF_ME_1", R_ARC_SECTOFF_ME_1, 0 },
+};
+static struct name _na_R_386_[] = {
+  { "R_386_8", R_386_8, 0 },
+  { "R_386_COPY", R_386_COPY, 0 },
+  { "R_386_TLS_LDO_32", R_386_TLS_LDO_32, 0 },
+  { "R_386_TLS_DTPMOD32", R_386_TLS_DTPMOD32, 0 },
+  { "R_386_RELATIVE", R_386_RELATIVE, 0 },
+  { "R_386_TLS_IE_32", R_386_TLS_IE_32, 0 },
+  { "R_386_JMP_SLOT", R_386_JMP_SLOT, 0 },
+  { "R_386_TLS_LDM_CALL", R_386_TLS_LDM_CALL, 0 },
+  { "R_386_TLS_GD", R_386_TLS_GD, 0 },
+  { "R_386_PLT32", R_386_PLT32, 0 },
+  { "R_386_GLOB_DAT", R_386_GLOB_DAT, 0 },
+  { "R_386_TLS_IE", R_386_TLS_IE, 0 },
+  { "R_386_TLS_LE", R_386_TLS_LE, 0 },
+  { "R_386_TLS_DTPOFF32", R_386_TLS_DTPOFF32, 0 },
+  { "R_386_PC16", R_386_PC16, 0 },
+  { "R_386_IRELATIVE", R_386_IRELATIVE, 0 },
+  { "R_386_PC32", R_386_PC32, 0 },
+  { "R_386_TLS_GD_POP", R_386_TLS_GD_POP, 0 },
+  { "R_386_TLS_LDM_32", R_386_TLS_LDM_32, 0 },
+  { "R_386_TLS_DESC_CALL", R_386_TLS_DESC_CALL, 0 },
+  { "R_386_TLS_GD_CALL", R_386_TLS_GD_CALL, 0 },
+  { "R_386_TLS_GD_32", R_386_TLS_GD_32, 0 },
+  { "R_386_TLS_TPOFF32", R_386_TLS_TPOFF32, 0 },
+  { "R_386_NUM", R_386_NUM, 0 },
+  { "R_386_TLS_GD_PUSH", R_386_TLS_GD_PUSH, 0 },
+  { "R_386_TLS_LDM_PUSH", R_386_TLS_LDM_PUSH, 0 },
+  { "R_386_SIZE32", R_386_SIZE32, 0 },
+  { "R_386_TLS_LDM", R_386_TLS_LDM, 0 },
+  { "R_386_32PLT", R_386_32PLT, 0 },
+  { "R_386_GOTPC", R_386_GOTPC, 0 },
+  { "R_386_GOTOFF", R_386_GOTOFF, 0 },
+  { "R_386_GOT32", R_386_GOT32, 0 },
+  { "R_386_16", R_386_16, 0 },
+  { "R_386_32", R_386_32, 0 },
+  { "R_386_TLS_DESC", R_386_TLS_DESC, 0 },
+  { "R_386_PC8", R_386_PC8, 0 },
+  { "R_386_TLS_LDM_POP", R_386_TLS_LDM_POP, 0 },
+  { "R_386_TLS_LE_32", R_386_TLS_LE_32, 0 },
+  { "R_386_TLS_GOTIE", R_386_TLS_GOTIE, 0 },
+  { "R_386_TLS_TPOFF", R_386_TLS_TPOFF, 0 },
+  { "R_386_TLS_GOTDESC", R_386_TLS_GOTDESC, 0 },
+  { "R_386_GOT32X", R_386_GOT32X, 0 },
+  { "R_386_NONE", R_386_NONE, 0 },
+};
+static struct name _na_R_390_[] = {
+  { "R_390_TLS_GD32", R_390_TLS_GD32, 0 },
+  { "R_390_TLS_IE64", R_390_TLS_IE64, 0 },
+  { "R_390_TLS_IE32", R_390_TLS_IE32, 0 },
+  { "R_390_TLS_GD64", R_390_TLS_GD64, 0 },
+  { "R_390_IRELATIVE", R_390_IRELATIVE, 0 },
+  { "R_390_TLS_LE32", R_390_TLS_LE32, 0 },
+  { "R_390_TLS_LDO32", R_390_TLS_LDO32, 0 },
+  { "R_390_TLS_LDO64", R_390_TLS_LDO64, 0 },
+  { "R_390_TLS_LDCALL", R_390_TLS_LDCALL, 0 },
+  { "R_390_PC16", R_390_PC16, 0 },
+  { "R_390_PC32", R_390_PC32, 0 },
+  { "R_390_PLTOFF16", R_390_PLTOFF16, 0 },
+  { "R_390_PC64", R_390_PC64, 0 },
+  { "R_390_PLT16DBL", R_390_PLT16DBL, 0 },
+  { "R_390_PLTOFF32", R_390_PLTOFF32, 0 },
+  { "R_390_GOT12", R_390_GOT12, 0 },
+  { "R_390_PLTOFF64", R_390_PLTOFF64, 0 },
+  { "R_390_GOTPLT12", R_390_GOTPLT12, 0 },
+  { "R_390_GOTPLT16", R_390_GOTPLT16, 0 },
+  { "R_390_GOTPLT32", R_390_GOTPLT32, 0 },
+  { "R_390_GOTPLT64", R_390_GOTPLT64, 0 },
+  { "R_390_PC32DBL", R_390_PC32DBL, 0 },
+  { "R_390_TLS_GOTIE20", R_390_TLS_GOTIE20, 0 },
+  { "R_390_TLS_GOTIE64", R_390_TLS_GOTIE64, 0 },
+  { "R_390_GOTPLTENT", R_390_GOTPLTENT, 0 },
+  { "R_390_TLS_IEENT", R_390_TLS_IEENT, 0 },
+  { "R_390_GOTOFF16", R_390_GOTOFF16, 0 },
+  { "R_390_GOTOFF64", R_390_GOTOFF64, 0 },
+  { "R_390_GOT16", R_390_GOT16, 0 },
+  { "R_390_GOT20", R_390_GOT20, 0 },
+  { "R_390_GOT32", R_390_GOT32, 0 },
+  { "R_390_GOT64", R_390_GOT64, 0 },
+  { "R_390_TLS_DTPMOD", R_390_TLS_DTPMOD, 0 },
+  { "R_390_TLS_LE64", R_390_TLS_LE64, 0 },
+  { "R_390_JMP_SLOT", R_390_JMP_SLOT, 0 },
+  { "R_390_GOTPLT20", R_390_GOTPLT20, 0 },
+  { "R_390_RELATIVE", R_390_RELATIVE, 0 },
+  { "R_390_GOTPC", R_390_GOTPC, 0 },
+  { "R_390_12", R_390_12, 0 },
+  { "R_390_16", R_390_16, 0 },
+  { "R_390_20", R_390_20, 0 },
+  { "R_390_32", R_390_32, 0 },
+  { "R_390_64", R_390_64, 0 },
+  { "R_390_TLS_GOTIE12", R_390_TLS_GOTIE12, 0 },
+  { "R_390_TLS_GDCALL", R_390_TLS_GDCALL, 0 },
+  { "R_390_TLS_LDM32", R_390_TLS_LDM32, 0 },
+  { "R_390_TLS_LDM64", R_390_TLS_LDM64, 0 },
+  { "R_390_GOTOFF32", R_390_GOTOFF32, 0 },
+  { "R_390_GLOB_DAT", R_390_GLOB_DAT, 0 },
+  { "R_390_PLT32DBL", R_390_PLT32DBL, 0 },
+  { "R_390_NUM", R_390_NUM, 0 },
+  { "R_390_PLT64", R_390_PLT64, 0 },
+  { "R_390_GOTPCDBL", R_390_GOTPCDBL, 0 },
+  { "R_390_TLS_GOTIE32", R_390_TLS_GOTIE32, 0 },
+  { "R_390_8", R_390_8, 0 },
+  { "R_390_PLT32", R_390_PLT32, 0 },
+  { "R_390_PC16DBL", R_390_PC16DBL, 0 },
+  { "R_390_GOTENT", R_390_GOTENT, 0 },
+  { "R_390_TLS_LOAD", R_390_TLS_LOAD, 0 },
+  { "R_390_NONE", R_390_NONE, 0 },
+  { "R_390_TLS_TPOFF", R_390_TLS_TPOFF, 0 },
+  { "R_390_TLS_DTPOFF", R_390_TLS_DTPOFF, 0 },
+  { "R_390_COPY", R_390_COPY, 0 },
+};
+static struct name _na_R_68K_[] = {
+  { "R_68K_GOT16", R_68K_GOT16, 0 },
+  { "R_68K_TLS_GD8", R_68K_TLS_GD8, 0 },
+  { "R_68K_8", R_68K_8, 0 },
+  { "R_68K_TLS_DTPREL32", R_68K_TLS_DTPREL32, 0 },
+  { "R_68K_TLS_IE32", R_68K_TLS_IE32, 0 },
+  { "R_68K_PLT16O", R_68K_PLT16O, 0 },
+  { "R_68K_GLOB_DAT", R_68K_GLOB_DAT, 0 },
+  { "R_68K_PLT16", R_68K_PLT16, 0 },
+  { "R_68K_TLS_GD16", R_68K_TLS_GD16, 0 },
+  { "R_68K_PLT8O", R_68K_PLT8O, 0 },
+  { "R_68K_PLT32", R_68K_PLT32, 0 },
+  { "R_68K_PLT8", R_68K_PLT8, 0 },
+  { "R_68K_TLS_LDO32", R_68K_TLS_LDO32, 0 },
+  { "R_68K_TLS_LE8", R_68K_TLS_LE8, 0 },
+  { "R_68K_TLS_LDM8", R_68K_TLS_LDM8, 0 },
+  { "R_68K_RELATIVE", R_68K_RELATIVE, 0 },
+  { "R_68K_NONE", R_68K_NONE, 0 },
+  { "R_68K_NUM", R_68K_NUM, 0 },
+  { "R_68K_COPY", R_68K_COPY, 0 },
+  { "R_68K_TLS_IE16", R_68K_TLS_IE16, 0 },
+  { "R_68K_TLS_LE32", R_68K_TLS_LE32, 0 },
+  { "R_68K_TLS_GD32", R_68K_TLS_GD32, 0 },
+  { "R_68K_16", R_68K_16, 0 },
+  { "R_68K_32", R_68K_32, 0 },
+  { "R_68K_TLS_LE16", R_68K_TLS_LE16, 0 },
+  { "R_68K_TLS_IE8", R_68K_TLS_IE8, 0 },
+  { "R_68K_JMP_SLOT", R_68K_JMP_SLOT, 0 },
+  { "R_68K_TLS_LDO8", R_68K_TLS_LDO8, 0 },
+  { "R_68K_GOT16O", R_68K_GOT16O, 0 },
+  { "R_68K_GOT8O", R_68K_GOT8O, 0 },
+  { "R_68K_GOT32O", R_68K_GOT32O, 0 },
+  { "R_68K_TLS_TPREL32", R_68K_TLS_TPREL32, 0 },
+  { "R_68K_PC16", R_68K_PC16, 0 },
+  { "R_68K_PC32", R_68K_PC32, 0 },
+  { "R_68K_PLT32O", R_68K_PLT32O, 0 },
+  { "R_68K_TLS_LDM16", R_68K_TLS_LDM16, 0 },
+  { "R_68K_TLS_LDM32", R_68K_TLS_LDM32, 0 },
+  { "R_68K_GOT32", R_68K_GOT32, 0 },
+  { "R_68K_PC8", R_68K_PC8, 0 },
+  { "R_68K_TLS_DTPMOD32", R_68K_TLS_DTPMOD32, 0 },
+  { "R_68K_GOT8", R_68K_GOT8, 0 },
+  { "R_68K_TLS_LDO16", R_68K_TLS_LDO16, 0 },
+};
+static struct name _na_R_ALPHA_[] = {
+  { "R_ALPHA_TLS_LDM", R_ALPHA_TLS_LDM, 0 },
+  { "R_ALPHA_DTPMOD64", R_ALPHA_DTPMOD64, 0 },
+  { "R_ALPHA_GPREL32", R_ALPHA_GPREL32, 0 },
+  { "R_ALPHA_TLSGD", R_ALPHA_TLSGD, 0 },
+  { "R_ALPHA_REFLONG", R_ALPHA_REFLONG, 0 },
+  { "R_ALPHA_GPREL16", R_ALPHA_GPREL16, 0 },
+  { "R_ALPHA_GOTTPREL", R_ALPHA_GOTTPREL, 0 },
+  { "R_ALPHA_DTPREL16", R_ALPHA_DTPREL16, 0 },
+  { "R_ALPHA_DTPREL64", R_ALPHA_DTPREL64, 0 },
+  { "R_ALPHA_GOTDTPREL", R_ALPHA_GOTDTPREL, 0 },
+  { "R_ALPHA_HINT", R_ALPHA_HINT, 0 },
+  { "R_ALPHA_DTPRELHI", R_ALPHA_DTPRELHI, 0 },
+  { "R_ALPHA_DTPRELLO", R_ALPHA_DTPRELLO, R_ALPHA_DTPRELHI - R_ALPHA_DTPRELLO },
+  { "R_ALPHA_GLOB_DAT", R_ALPHA_GLOB_DAT, 0 },
+  { "R_ALPHA_NUM", R_ALPHA_NUM, 0 },
+  { "R_ALPHA_REFQUAD", R_ALPHA_REFQUAD, 0 },
+  { "R_ALPHA_GPRELHIGH", R_ALPHA_GPRELHIGH, 0 },
+  { "R_ALPHA_GPRELLOW", R_ALPHA_GPRELLOW, 0 },
+  { "R_ALPHA_TPREL16", R_ALPHA_TPREL16, 0 },
+  { "R_ALPHA_BRADDR", R_ALPHA_BRADDR, 0 },
+  { "R_ALPHA_NONE", R_ALPHA_NONE, 0 },
+  { "R_ALPHA_GPDISP", R_ALPHA_GPDISP, 0 },
+  { "R_ALPHA_LITERAL", R_ALPHA_LITERAL, 0 },
+  { "R_ALPHA_LITUSE", R_ALPHA_LITUSE, 0 },
+  { "R_ALPHA_TPREL64", R_ALPHA_TPREL64, 0 },
+  { "R_ALPHA_SREL16", R_ALPHA_SREL16, 0 },
+  { "R_ALPHA_SREL32", R_ALPHA_SREL32, 0 },
+  { "R_ALPHA_SREL64", R_ALPHA_SREL64, 0 },
+  { "R_ALPHA_RELATIVE", R_ALPHA_RELATIVE, 0 },
+  { "R_ALPHA_TLS_GD_HI", R_ALPHA_TLS_GD_HI, 0 },
+  { "R_ALPHA_JMP_SLOT", R_ALPHA_JMP_SLOT, 0 },
+  { "R_ALPHA_COPY", R_ALPHA_COPY, 0 },
+  { "R_ALPHA_TPRELHI", R_ALPHA_TPRELHI, 0 },
+  { "R_ALPHA_TPRELLO", R_ALPHA_TPRELLO, R_ALPHA_TPRELHI - R_ALPHA_TPRELLO },
+};
+static struct name _na_R_ARM_[] = {
+  { "R_ARM_COPY", R_ARM_COPY, 0 },
+  { "R_ARM_ALU_PC_G0_NC", R_ARM_ALU_PC_G0_NC, 0 },
+  { "R_ARM_THM_MOVT_PREL", R_ARM_THM_MOVT_PREL, 0 },
+  { "R_ARM_THM_MOVT_BREL", R_ARM_THM_MOVT_BREL, 0 },
+  { "R_ARM_ALU_SB_G0", R_ARM_ALU_SB_G0, 0 },
+  { "R_ARM_ALU_SB_G1", R_ARM_ALU_SB_G1, 0 },
+  { "R_ARM_ALU_SB_G2", R_ARM_ALU_SB_G2, 0 },
+  { "R_ARM_ALU_SBREL_19_12", R_ARM_ALU_SBREL_19_12, 0 },
+  { "R_ARM_GOT_ABS", R_ARM_GOT_ABS, 0 },
+  { "R_ARM_LDRS_SB_G0", R_ARM_LDRS_SB_G0, 0 },
+  { "R_ARM_THM_MOVW_PREL_NC", R_ARM_THM_MOVW_PREL_NC, 0 },
+  { "R_ARM_ABS12", R_ARM_ABS12, 0 },
+  { "R_ARM_TLS_IE12GP", R_ARM_TLS_IE12GP, 0 },
+  { "R_ARM_LDC_PC_G2", R_ARM_LDC_PC_G2, 0 },
+  { "R_ARM_ALU_PC_G1", R_ARM_ALU_PC_G1, 0 },
+  { "R_ARM_TLS_GD32", R_ARM_TLS_GD32, 0 },
+  { "R_ARM_RSBREL32", R_ARM_RSBREL32, 0 },
+  { "R_ARM_PC24", R_ARM_PC24, 0 },
+  { "R_ARM_THM_TLS_DESCSEQ", R_ARM_THM_TLS_DESCSEQ, 0 },
+  { "R_ARM_MOVW_BREL", R_ARM_MOVW_BREL, 0 },
+  { "R_ARM_RELATIVE", R_ARM_RELATIVE, 0 },
+  { "R_ARM_THM_PC12", R_ARM_THM_PC12, 0 },
+  { "R_ARM_BASE_ABS", R_ARM_BASE_ABS, 0 },
+  { "R_ARM_THM_GOT_BREL12", R_ARM_THM_GOT_BREL12, 0 },
+  { "R_ARM_NUM", R_ARM_NUM, 0 },
+  { "R_ARM_THM_MOVW_BREL_NC", R_ARM_THM_MOVW_BREL_NC, 0 },
+  { "R_ARM_LDR_SB_G1", R_ARM_LDR_SB_G1, 0 },
+  { "R_ARM_GNU_VTINHERIT", R_ARM_GNU_VTINHERIT, 0 },
+  { "R_ARM_TLS_GOTDESC", R_ARM_TLS_GOTDESC, 0 },
+  { "R_ARM_ABS8", R_ARM_ABS8, 0 },
+  { "R_ARM_ALU_PCREL_7_0", R_ARM_ALU_PCREL_7_0, 0 },
+  { "R_ARM_LDRS_SB_G1", R_ARM_LDRS_SB_G1, 0 },
+  { "R_ARM_LDRS_SB_G2", R_ARM_LDRS_SB_G2, 0 },
+  { "R_ARM_ABS32", R_ARM_ABS32, 0 },
+  { "R_ARM_THM_TLS_DESCSEQ16", R_ARM_THM_TLS_DESCSEQ16, 0 },
+  { "R_ARM_ALU_SBREL_27_20", R_ARM_ALU_SBREL_27_20, 0 },
+  { "R_ARM_THM_JUMP19", R_ARM_THM_JUMP19, 0 },
+  { "R_ARM_THM_JUMP24", R_ARM_THM_JUMP24, 0 },
+  { "R_ARM_TLS_DESCSEQ", R_ARM_TLS_DESCSEQ, 0 },
+  { "R_ARM_PREL31", R_ARM_PREL31, 0 },
+  { "R_ARM_AMP_VCALL9", R_ARM_AMP_VCALL9, 0 },
+  { "R_ARM_GLOB_DAT", R_ARM_GLOB_DAT, 0 },
+  { "R_ARM_THM_RPC22", R_ARM_THM_RPC22, 0 },
+  { "R_ARM_ALU_SB_G1_NC", R_ARM_ALU_SB_G1_NC, 0 },
+  { "R_ARM_LDR_PC_G1", R_ARM_LDR_PC_G1, 0 },
+  { "R_ARM_TLS_LE32", R_ARM_TLS_LE32, 0 },
+  { "R_ARM_THM_PC8", R_ARM_THM_PC8, 0 },
+  { "R_ARM_THM_PC9", R_ARM_THM_PC9, 0 },
+  { "R_ARM_SWI24", R_ARM_SWI24, 0 },
+  { "R_ARM_MOVT_PREL", R_ARM_MOVT_PREL, 0 },
+  { "R_ARM_MOVT_BREL", R_ARM_MOVT_BREL, 0 },
+  { "R_ARM_RPC24", R_ARM_RPC24, 0 },
+  { "R_ARM_THM_TLS_DESCSEQ32", R_ARM_THM_TLS_DESCSEQ32, 0 },
+  { "R_ARM_LDC_SB_G2", R_ARM_LDC_SB_G2, 0 },
+  { "R_ARM_GOT_BREL12", R_ARM_GOT_BREL12, 0 },
+  { "R_ARM_JUMP24", R_ARM_JUMP24, 0 },
+  { "R_ARM_GOT32", R_ARM_GOT32, 0 },
+  { "R_ARM_TLS_LDM32", R_ARM_TLS_LDM32, 0 },
+  { "R_ARM_REL32_NOI", R_ARM_REL32_NOI, 0 },
+  { "R_ARM_LDC_PC_G0", R_ARM_LDC_PC_G0, 0 },
+  { "R_ARM_LDC_PC_G1", R_ARM_LDC_PC_G1, 0 },
+  { "R_ARM_THM_MOVT_ABS", R_ARM_THM_MOVT_ABS, 0 },
+  { "R_ARM_THM_ABS5", R_ARM_THM_ABS5, 0 },
+  { "R_ARM_THM_ALU_PREL_11_0", R_ARM_THM_ALU_PREL_11_0, 0 },
+  { "R_ARM_THM_MOVW_BREL", R_ARM_THM_MOVW_BREL, 0 },
+  { "R_ARM_PLT32_ABS", R_ARM_PLT32_ABS, 0 },
+  { "R_ARM_RREL32", R_ARM_RREL32, 0 },
+  { "R_ARM_SBREL31", R_ARM_SBREL31, 0 },
+  { "R_ARM_SBREL32", R_ARM_SBREL32, 0 },
+  { "R_ARM_GOTOFF12", R_ARM_GOTOFF12, 0 },
+  { "R_ARM_RXPC25", R_ARM_RXPC25, 0 },
+  { "R_ARM_THM_MOVW_ABS_NC", R_ARM_THM_MOVW_ABS_NC, 0 },
+  { "R_ARM_ALU_PCREL_23_15", R_ARM_ALU_PCREL_23_15, 0 },
+  { "R_ARM_ME_TOO", R_ARM_ME_TOO, 0 },
+  { "R_ARM_THM_JUMP6", R_ARM_THM_JUMP6, 0 },
+  { "R_ARM_TLS_IE32", R_ARM_TLS_IE32, 0 },
+  { "R_ARM_NONE", R_ARM_NONE, 0 },
+  { "R_ARM_GOTPC", R_ARM_GOTPC, 0 },
+  { "R_ARM_RABS22", R_ARM_RABS22, 0 },
+  { "R_ARM_TLS_CALL", R_ARM_TLS_CALL, 0 },
+  { "R_ARM_LDR_SBREL_11_0", R_ARM_LDR_SBREL_11_0, 0 },
+  { "R_ARM_LDRS_PC_G0", R_ARM_LDRS_PC_G0, 0 },
+  { "R_ARM_THM_SWI8", R_ARM_THM_SWI8, 0 },
+  { "R_ARM_TLS_LE12", R_ARM_TLS_LE12, 0 },
+  { "R_ARM_ALU_PC_G0", R_ARM_ALU_PC_G0, 0 },
+  { "R_ARM_ALU_PC_G2", R_ARM_ALU_PC_G2, 0 },
+  { "R_ARM_MOVW_BREL_NC", R_ARM_MOVW_BREL_NC, 0 },
+  { "R_ARM_GOT_PREL", R_ARM_GOT_PREL, 0 },
+  { "R_ARM_MOVW_ABS_NC", R_ARM_MOVW_ABS_NC, 0 },
+  { "R_ARM_TLS_DTPMOD32", R_ARM_TLS_DTPMOD32, 0 },
+  { "R_ARM_LDRS_PC_G1", R_ARM_LDRS_PC_G1, 0 },
+  { "R_ARM_LDRS_PC_G2", R_ARM_LDRS_PC_G2, 0 },
+  { "R_ARM_CALL", R_ARM_CALL, 0 },
+  { "R_ARM_PC13", R_ARM_PC13, 0 },
+  { "R_ARM_GNU_VTENTRY", R_ARM_GNU_VTENTRY, 0 },
+  { "R_ARM_PLT32", R_ARM_PLT32, 0 },
+  { "R_ARM_THM_TLS_CALL", R_ARM_THM_TLS_CALL, 0 },
+  { "R_ARM_MOVT_ABS", R_ARM_MOVT_ABS, 0 },
+  { "R_ARM_ALU_PC_G1_NC", R_ARM_ALU_PC_G1_NC, 0 },
+  { "R_ARM_MOVW_PREL_NC", R_ARM_MOVW_PREL_NC, 0 },
+  { "R_ARM_JUMP_SLOT", R_ARM_JUMP_SLOT, 0 },
+  { "R_ARM_V4BX", R_ARM_V4BX, 0 },
+  { "R_ARM_ABS32_NOI", R_ARM_ABS32_NOI, 0 },
+  { "R_ARM_LDR_PC_G2", R_ARM_LDR_PC_G2, 0 },
+  { "R_ARM_TARGET1", R_ARM_TARGET1, 0 },
+  { "R_ARM_TARGET2", R_ARM_TARGET2, 0 },
+  { "R_ARM_TLS_DTPOFF32", R_ARM_TLS_DTPOFF32, 0 },
+  { "R_ARM_REL32", R_ARM_REL32, 0 },
+  { "R_ARM_THM_XPC22", R_ARM_THM_XPC22, 0 },
+  { "R_ARM_LDC_SB_G0", R_ARM_LDC_SB_G0, 0 },
+  { "R_ARM_LDC_SB_G1", R_ARM_LDC_SB_G1, 0 },
+  { "R_ARM_XPC25", R_ARM_XPC25, 0 },
+  { "R_ARM_ALU_PCREL_15_8", R_ARM_ALU_PCREL_15_8, 0 },
+  { "R_ARM_GOTOFF", R_ARM_GOTOFF, 0 },
+  { "R_ARM_TLS_DESC", R_ARM_TLS_DESC, 0 },
+  { "R_ARM_RBASE", R_ARM_RBASE, 0 },
+  { "R_ARM_TLS_TPOFF32", R_ARM_TLS_TPOFF32, 0 },
+  { "R_ARM_ABS16", R_ARM_ABS16, 0 },
+  { "R_ARM_TLS_LDO12", R_ARM_TLS_LDO12, 0 },
+  { "R_ARM_THM_PC11", R_ARM_THM_PC11, 0 },
+  { "R_ARM_THM_PC22", R_ARM_THM_PC22, 0 },
+  { "R_ARM_TLS_LDO32", R_ARM_TLS_LDO32, 0 },
+  { "R_ARM_LDR_SB_G0", R_ARM_LDR_SB_G0, 0 },
+  { "R_ARM_LDR_SB_G2", R_ARM_LDR_SB_G2, 0 },
+  { "R_ARM_ALU_SB_G0_NC", R_ARM_ALU_SB_G0_NC, 0 },
+  { "R_ARM_IRELATIVE", R_ARM_IRELATIVE, 0 },
+  { "R_ARM_GOTRELAX", R_ARM_GOTRELAX, 0 },
+};
+static struct name _na_R_HP_[] = {
+  { "R_PARISC_TLS_LDO14R", R_PARISC_TLS_LDO14R, 0 },
+  { "R_PARISC_GNU_VTENTRY", R_PARISC_GNU_VTENTRY, 0 },
+  { "R_PARISC_PLTOFF14R", R_PARISC_PLTOFF14R, 0 },
+  { "R_PARISC_PLTOFF16F", R_PARISC_PLTOFF16F, 0 },
+  { "R_PARISC_LTOFF_TP14F", R_PARISC_LTOFF_TP14F, 0 },
+  { "R_PARISC_LTOFF_TP14R", R_PARISC_LTOFF_TP14R, 0 },
+  { "R_PARISC_LTOFF_TP16F", R_PARISC_LTOFF_TP16F, 0 },
+  { "R_PARISC_GPREL64", R_PARISC_GPREL64, 0 },
+  { "R_PARISC_TLS_TPREL32", R_PARISC_TLS_TPREL32, 0 },
+  { "R_PARISC_DIR21L", R_PARISC_DIR21L, 0 },
+  { "R_PARISC_LTOFF_FPTR14R", R_PARISC_LTOFF_FPTR14R, 0 },
+  { "R_PARISC_LTOFF_FPTR16F", R_PARISC_LTOFF_FPTR16F, 0 },
+  { "R_PARISC_LTOFF_FPTR14DR", R_PARISC_LTOFF_FPTR14DR, 0 },
+  { "R_PARISC_PCREL14R", R_PARISC_PCREL14R, 0 },
+  { "R_PARISC_GPREL16DF", R_PARISC_GPREL16DF, 0 },
+  { "R_PARISC_IPLT", R_PARISC_IPLT, 0 },
+  { "R_PARISC_PCREL32", R_PARISC_PCREL32, 0 },
+  { "R_PARISC_LTOFF_TP16DF", R_PARISC_LTOFF_TP16DF, 0 },
+  { "R_PARISC_PCREL64", R_PARISC_PCREL64, 0 },
+  { "R_PARISC_LTOFF_FPTR14WR", R_PARISC_LTOFF_FPTR14WR, 0 },
+  { "R_PARISC_LTOFF16DF", R_PARISC_LTOFF16DF, 0 },
+  { "R_PARISC_LTOFF16F", R_PARISC_LTOFF16F, 0 },
+  { "R_PARISC_PCREL21L", R_PARISC_PCREL21L, 0 },
+  { "R_PARISC_PCREL22F", R_PARISC_PCREL22F, 0 },
+  { "R_PARISC_LTOFF14R", R_PARISC_LTOFF14R, 0 },
+  { "R_PARISC_PCREL16DF", R_PARISC_PCREL16DF, 0 },
+  { "R_PARISC_GPREL16WF", R_PARISC_GPREL16WF, 0 },
+  { "R_PARISC_TLS_TPREL64", R_PARISC_TLS_TPREL64, 0 },
+  { "R_PARISC_TPREL16WF", R_PARISC_TPREL16WF, 0 },
+  { "R_PARISC_DIR14DR", R_PARISC_DIR14DR, 0 },
+  { "R_PARISC_FPTR64", R_PARISC_FPTR64, 0 },
+  { "R_PARISC_SEGREL32", R_PARISC_SEGREL32, 0 },
+  { "R_PARISC_SEGREL64", R_PARISC_SEGREL64, 0 },
+  { "R_PARISC_TLS_LE14R", R_PARISC_TLS_LE14R, 0 },
+  { "R_PARISC_DIR64", R_PARISC_DIR64, 0 },
+  { "R_PARISC_PLTOFF21L", R_PARISC_PLTOFF21L, 0 },
+  { "R_PARISC_PLABEL14R", R_PARISC_PLABEL14R, 0 },
+  { "R_PARISC_TLS_GD14R", R_PARISC_TLS_GD14R, 0 },
+  { "R_PARISC_LTOFF16WF", R_PARISC_LTOFF16WF, 0 },
+  { "R_PARISC_TPREL21L", R_PARISC_TPREL21L, 0 },
+  { "R_PARISC_LTOFF_TP64", R_PARISC_LTOFF_TP64, 0 },
+  { "R_PARISC_TLS_LDM14R", R_PARISC_TLS_LDM14R, 0 },
+  { "R_PARISC_PCREL16WF", R_PARISC_PCREL16WF, 0 },
+  { "R_PARISC_PLTOFF14WR", R_PARISC_PLTOFF14WR, 0 },
+  { "R_PARISC_DIR14WR", R_PARISC_DIR14WR, 0 },
+  { "R_PARISC_TLS_DTPMOD32", R_PARISC_TLS_DTPMOD32, 0 },
+  { "R_PARISC_TPREL14WR", R_PARISC_TPREL14WR, 0 },
+  { "R_PARISC_TLS_DTPMOD64", R_PARISC_TLS_DTPMOD64, 0 },
+  { "R_PARISC_LTOFF_FPTR21L", R_PARISC_LTOFF_FPTR21L, 0 },
+  { "R_PARISC_TPREL32", R_PARISC_TPREL32, 0 },
+  { "R_PARISC_LORESERVE", R_PARISC_LORESERVE, R_PARISC_HIRESERVE - R_PARISC_LORESERVE },
+  { "R_PARISC_LTOFF_TP21L", R_PARISC_LTOFF_TP21L, 0 },
+  { "R_PARISC_DPREL14R", R_PARISC_DPREL14R, 0 },
+  { "R_PARISC_TPREL64", R_PARISC_TPREL64, 0 },
+  { "R_PARISC_LTOFF_FPTR16WF", R_PARISC_LTOFF_FPTR16WF, 0 },
+  { "R_PARISC_PLTOFF16DF", R_PARISC_PLTOFF16DF, 0 },
+  { "R_PARISC_TLS_GD21L", R_PARISC_TLS_GD21L, 0 },
+  { "R_PARISC_HIRESERVE", R_PARISC_HIRESERVE, 0 },
+  { "R_PARISC_TLS_DTPOFF64", R_PARISC_TLS_DTPOFF64, 0 },
+  { "R_PARISC_DIR32", R_PARISC_DIR32, 0 },
+  { "R_PARISC_TLS_LDM21L", R_PARISC_TLS_LDM21L, 0 },
+  { "R_PARISC_EPLT", R_PARISC_EPLT, 0 },
+  { "R_PARISC_TPREL14R", R_PARISC_TPREL14R, 0 },
+  { "R_PARISC_TPREL16F", R_PARISC_TPREL16F, 0 },
+  { "R_PARISC_GPREL14DR", R_PARISC_GPREL14DR, 0 },
+  { "R_PARISC_TLS_LE21L", R_PARISC_TLS_LE21L, 0 },
+  { "R_PARISC_LTOFF_TP14DR", R_PARISC_LTOFF_TP14DR, 0 },
+  { "R_PARISC_PLTOFF16WF", R_PARISC_PLTOFF16WF, 0 },
+  { "R_PARISC_NONE", R_PARISC_NONE, 0 },
+  { "R_PARISC_LTOFF14DR", R_PARISC_LTOFF14DR, 0 },
+  { "R_PARISC_LTOFF_FPTR16DF", R_PARISC_LTOFF_FPTR16DF, 0 },
+  { "R_PARISC_PCREL14DR", R_PARISC_PCREL14DR, 0 },
+  { "R_PARISC_GPREL14WR", R_PARISC_GPREL14WR, 0 },
+  { "R_PARISC_SEGBASE", R_PARISC_SEGBASE, 0 },
+  { "R_PARISC_GNU_VTINHERIT", R_PARISC_GNU_VTINHERIT, 0 },
+  { "R_PARISC_LTOFF_TP14WR", R_PARISC_LTOFF_TP14WR, 0 },
+  { "R_PARISC_TLS_GDCALL", R_PARISC_TLS_GDCALL, 0 },
+  { "R_PARISC_LTOFF14WR", R_PARISC_LTOFF14WR, 0 },
+  { "R_PARISC_TLS_IE21L", R_PARISC_TLS_IE21L, 0 },
+  { "R_PARISC_PCREL14WR", R_PARISC_PCREL14WR, 0 },
+  { "R_PARISC_LTOFF64", R_PARISC_LTOFF64, 0 },
+  { "R_PARISC_LTOFF21L", R_PARISC_LTOFF21L, 0 },
+  { "R_PARISC_DPREL21L", R_PARISC_DPREL21L, 0 },
+  { "R_PARISC_COPY", R_PARISC_COPY, 0 },
+  { "R_PARISC_DIR16DF", R_PARISC_DIR16DF, 0 },
+  { "R_PARISC_DIR14R", R_PARISC_DIR14R, 0 },
+  { "R_PARISC_GPREL14R", R_PARISC_GPREL14R, 0 },
+  { "R_PARISC_DIR16F", R_PARISC_DIR16F, 0 },
+  { "R_PARISC_DIR17F", R_PARISC_DIR17F, 0 },
+  { "R_PARISC_DIR17R", R_PARISC_DIR17R, 0 },
+  { "R_PARISC_TPREL16DF", R_PARISC_TPREL16DF, 0 },
+  { "R_PARISC_PLABEL32", R_PARISC_PLABEL32, 0 },
+  { "R_PARISC_GPREL21L", R_PARISC_GPREL21L, 0 },
+  { "R_PARISC_TLS_IE14R", R_PARISC_TLS_IE14R, 0 },
+  { "R_PARISC_LTOFF_TP16WF", R_PARISC_LTOFF_TP16WF, 0 },
+  { "R_PARISC_DIR16WF", R_PARISC_DIR16WF, 0 },
+  { "R_PARISC_SECREL32", R_PARISC_SECREL32, 0 },
+  { "R_PARISC_SECREL64", R_PARISC_SECREL64, 0 },
+  { "R_PARISC_PLTOFF14DR", R_PARISC_PLTOFF14DR, 0 },
+  { "R_PARISC_TLS_DTPOFF32", R_PARISC_TLS_DTPOFF32, 0 },
+  { "R_PARISC_LTOFF_FPTR32", R_PARISC_LTOFF_FPTR32, 0 },
+  { "R_PARISC_PLABEL21L", R_PARISC_PLABEL21L, 0 },
+  { "R_PARISC_LTOFF_FPTR64", R_PARISC_LTOFF_FPTR64, 0 },
+  { "R_PARISC_PCREL16F", R_PARISC_PCREL16F, 0 },
+  { "R_PARISC_TLS_LDO21L", R_PARISC_TLS_LDO21L, 0 },
+  { "R_PARISC_PCREL17F", R_PARISC_PCREL17F, 0 },
+  { "R_PARISC_PCREL17R", R_PARISC_PCREL17R, 0 },
+  { "R_PARISC_GPREL16F", R_PARISC_GPREL16F, 0 },
+  { "R_PARISC_TPREL14DR", R_PARISC_TPREL14DR, 0 },
+  { "R_PARISC_TLS_LDMCALL", R_PARISC_TLS_LDMCALL, 0 },
+};
+static struct name _na_R_IA_64_[] = {
+  { "R_IA64_REL64LSB", R_IA64_REL64LSB, 0 },
+  { "R_IA64_GPREL64I", R_IA64_GPREL64I, 0 },
+  { "R_IA64_PCREL64LSB", R_IA64_PCREL64LSB, 0 },
+  { "R_IA64_LTV64LSB", R_IA64_LTV64LSB, 0 },
+  { "R_IA64_SECREL32MSB", R_IA64_SECREL32MSB, 0 },
+  { "R_IA64_TPREL14", R_IA64_TPREL14, 0 },
+  { "R_IA64_TPREL22", R_IA64_TPREL22, 0 },
+  { "R_IA64_PCREL21F", R_IA64_PCREL21F, 0 },
+  { "R_IA64_DIR64LSB", R_IA64_DIR64LSB, 0 },
+  { "R_IA64_PLTOFF64LSB", R_IA64_PLTOFF64LSB, 0 },
+  { "R_IA64_LTOFF_DTPREL22", R_IA64_LTOFF_DTPREL22, 0 },
+  { "R_IA64_PCREL32LSB", R_IA64_PCREL32LSB, 0 },
+  { "R_IA64_SEGREL32MSB", R_IA64_SEGREL32MSB, 0 },
+  { "R_IA64_LTOFF_FPTR32LSB", R_IA64_LTOFF_FPTR32LSB, 0 },
+  { "R_IA64_LTOFF_TPREL22", R_IA64_LTOFF_TPREL22, 0 },
+  { "R_IA64_DTPREL14", R_IA64_DTPREL14, 0 },
+  { "R_IA64_PCREL21M", R_IA64_PCREL21M, 0 },
+  { "R_IA64_LTV32MSB", R_IA64_LTV32MSB, 0 },
+  { "R_IA64_DTPMOD64LSB", R_IA64_DTPMOD64LSB, 0 },
+  { "R_IA64_FPTR32MSB", R_IA64_FPTR32MSB, 0 },
+  { "R_IA64_TPREL64LSB", R_IA64_TPREL64LSB, 0 },
+  { "R_IA64_PLTOFF64MSB", R_IA64_PLTOFF64MSB, 0 },
+  { "R_IA64_PCREL21BI", R_IA64_PCREL21BI, 0 },
+  { "R_IA64_FPTR64I", R_IA64_FPTR64I, 0 },
+  { "R_IA64_PCREL60B", R_IA64_PCREL60B, 0 },
+  { "R_IA64_LTOFF_DTPMOD22", R_IA64_LTOFF_DTPMOD22, 0 },
+  { "R_IA64_REL64MSB", R_IA64_REL64MSB, 0 },
+  { "R_IA64_LTV64MSB", R_IA64_LTV64MSB, 0 },
+  { "R_IA64_PCREL64I", R_IA64_PCREL64I, 0 },
+  { "R_IA64_PCREL64MSB", R_IA64_PCREL64MSB, 0 },
+  { "R_IA64_DTPREL64LSB", R_IA64_DTPREL64LSB, 0 },
+  { "R_IA64_PCREL32MSB", R_IA64_PCREL32MSB, 0 },
+  { "R_IA64_SEGREL64LSB", R_IA64_SEGREL64LSB, 0 },
+  { "R_IA64_LDXMOV", R_IA64_LDXMOV, 0 },
+  { "R_IA64_LTV32LSB", R_IA64_LTV32LSB, 0 },
+  { "R_IA64_DIR64MSB", R_IA64_DIR64MSB, 0 },
+  { "R_IA64_PLTOFF22", R_IA64_PLTOFF22, 0 },
+  { "R_IA64_FPTR64MSB", R_IA64_FPTR64MSB, 0 },
+  { "R_IA64_SECREL64LSB", R_IA64_SECREL64LSB, 0 },
+  { "R_IA64_TPREL64MSB", R_IA64_TPREL64MSB, 0 },
+  { "R_IA64_PLTOFF64I", R_IA64_PLTOFF64I, 0 },
+  { "R_IA64_FPTR64LSB", R_IA64_FPTR64LSB, 0 },
+  { "R_IA64_GPREL22", R_IA64_GPREL22, 0 },
+  { "R_IA64_LTOFF22", R_IA64_LTOFF22, 0 },
+  { "R_IA64_DTPMOD64MSB", R_IA64_DTPMOD64MSB, 0 },
+  { "R_IA64_REL32LSB", R_IA64_REL32LSB, 0 },
+  { "R_IA64_GPREL64MSB", R_IA64_GPREL64MSB, 0 },
+  { "R_IA64_DTPREL64I", R_IA64_DTPREL64I, 0 },
+  { "R_IA64_LTOFF_FPTR32MSB", R_IA64_LTOFF_FPTR32MSB, 0 },
+  { "R_IA64_DIR32LSB", R_IA64_DIR32LSB, 0 },
+  { "R_IA64_IPLTLSB", R_IA64_IPLTLSB, 0 },
+  { "R_IA64_REL32MSB", R_IA64_REL32MSB, 0 },
+  { "R_IA64_SEGREL64MSB", R_IA64_SEGREL64MSB, 0 },
+  { "R_IA64_GPREL32MSB", R_IA64_GPREL32MSB, 0 },
+  { "R_IA64_SUB", R_IA64_SUB, 0 },
+  { "R_IA64_NONE", R_IA64_NONE, 0 },
+  { "R_IA64_LTOFF_FPTR64LSB", R_IA64_LTOFF_FPTR64LSB, 0 },
+  { "R_IA64_DTPREL64MSB", R_IA64_DTPREL64MSB, 0 },
+  { "R_IA64_SECREL64MSB", R_IA64_SECREL64MSB, 0 },
+  { "R_IA64_DTPREL32LSB", R_IA64_DTPREL32LSB, 0 },
+  { "R_IA64_LTOFF64I", R_IA64_LTOFF64I, 0 },
+  { "R_IA64_GPREL32LSB", R_IA64_GPREL32LSB, 0 },
+  { "R_IA64_LTOFF22X", R_IA64_LTOFF22X, 0 },
+  { "R_IA64_COPY", R_IA64_COPY, 0 },
+  { "R_IA64_DTPREL32MSB", R_IA64_DTPREL32MSB, 0 },
+  { "R_IA64_LTOFF_FPTR64I", R_IA64_LTOFF_FPTR64I, 0 },
+  { "R_IA64_PCREL21B", R_IA64_PCREL21B, 0 },
+  { "R_IA64_PCREL22", R_IA64_PCREL22, 0 },
+  { "R_IA64_IMM14", R_IA64_IMM14, 0 },
+  { "R_IA64_LTOFF_FPTR22", R_IA64_LTOFF_FPTR22, 0 },
+  { "R_IA64_IMM22", R_IA64_IMM22, 0 },
+  { "R_IA64_SEGREL32LSB", R_IA64_SEGREL32LSB, 0 },
+  { "R_IA64_DTPREL22", R_IA64_DTPREL22, 0 },
+  { "R_IA64_DIR32MSB", R_IA64_DIR32MSB, 0 },
+  { "R_IA64_IMM64", R_IA64_IMM64, 0 },
+  { "R_IA64_IPLTMSB", R_IA64_IPLTMSB, 0 },
+  { "R_IA64_SECREL32LSB", R_IA64_SECREL32LSB, 0 },
+  { "R_IA64_TPREL64I", R_IA64_TPREL64I, 0 },
+  { "R_IA64_LTOFF_FPTR64MSB", R_IA64_LTOFF_FPTR64MSB, 0 },
+  { "R_IA64_FPTR32LSB", R_IA64_FPTR32LSB, 0 },
+  { "R_IA64_GPREL64LSB", R_IA64_GPREL64LSB, 0 },
+};
+static struct name _na_R_MIPS_[] = {
+  { "R_MIPS_TLS_GD", R_MIPS_TLS_GD, 0 },
+  { "R_MIPS_COPY", R_MIPS_COPY, 0 },
+  { "R_MIPS_NONE", R_MIPS_NONE, 0 },
+  { "R_MIPS_PJUMP", R_MIPS_PJUMP, 0 },
+  { "R_MIPS_LO16", R_MIPS_LO16, R_MIPS_HI16 - R_MIPS_LO16 },
+  { "R_MIPS_SUB", R_MIPS_SUB, 0 },
+  { "R_MIPS_REL32", R_MIPS_REL32, 0 },
+  { "R_MIPS_JALR", R_MIPS_JALR, 0 },
+  { "R_MIPS_REL16", R_MIPS_REL16, 0 },
+  { "R_MIPS_HIGHEST", R_MIPS_HIGHEST, 0 },
+  { "R_MIPS_16", R_MIPS_16, 0 },
+  { "R_MIPS_26", R_MIPS_26, 0 },
+  { "R_MIPS_32", R_MIPS_32, 0 },
+  { "R_MIPS_64", R_MIPS_64, 0 },
+  { "R_MIPS_CALL_HI16", R_MIPS_CALL_HI16, 0 },
+  { "R_MIPS_PC16", R_MIPS_PC16, 0 },
+  { "R_MIPS_GPREL16", R_MIPS_GPREL16, 0 },
+  { "R_MIPS_TLS_DTPREL_HI16", R_MIPS_TLS_DTPREL_HI16, 0 },
+  { "R_MIPS_GPREL32", R_MIPS_GPREL32, 0 },
+  { "R_MIPS_CALL_LO16", R_MIPS_CALL_LO16, R_MIPS_CALL_HI16 - R_MIPS_CALL_LO16 },
+  { "R_MIPS_TLS_DTPREL_LO16", R_MIPS_TLS_DTPREL_LO16, R_MIPS_TLS_DTPREL_HI16 - R_MIPS_TLS_DTPREL_LO16 },
+  { "R_MIPS_GOT_OFST", R_MIPS_GOT_OFST, 0 },
+  { "R_MIPS_RELGOT", R_MIPS_RELGOT, 0 },
+  { "R_MIPS_GOT_DISP", R_MIPS_GOT_DISP, 0 },
+  { "R_MIPS_INSERT_B", R_MIPS_INSERT_B, 0 },
+  { "R_MIPS_JUMP_SLOT", R_MIPS_JUMP_SLOT, 0 },
+  { "R_MIPS_TLS_TPREL_HI16", R_MIPS_TLS_TPREL_HI16, 0 },
+  { "R_MIPS_ADD_IMMEDIATE", R_MIPS_ADD_IMMEDIATE, 0 },
+  { "R_MIPS_GOT16", R_MIPS_GOT16, 0 },
+  { "R_MIPS_GOT_PAGE", R_MIPS_GOT_PAGE, 0 },
+  { "R_MIPS_CALL16", R_MIPS_CALL16, 0 },
+  { "R_MIPS_DELETE", R_MIPS_DELETE, 0 },
+  { "R_MIPS_TLS_TPREL_LO16", R_MIPS_TLS_TPREL_LO16, R_MIPS_TLS_TPREL_HI16 - R_MIPS_TLS_TPREL_LO16 },
+  { "R_MIPS_NUM", R_MIPS_NUM, 0 },
+  { "R_MIPS_TLS_TPREL32", R_MIPS_TLS_TPREL32, 0 },
+  { "R_MIPS_LITERAL", R_MIPS_LITERAL, 0 },
+  { "R_MIPS_TLS_TPREL64", R_MIPS_TLS_TPREL64, 0 },
+  { "R_MIPS_GOT_HI16", R_MIPS_GOT_HI16, 0 },
+  { "R_MIPS_HIGHER", R_MIPS_HIGHER, 0 },
+  { "R_MIPS_TLS_DTPMOD32", R_MIPS_TLS_DTPMOD32, 0 },
+  { "R_MIPS_INSERT_A", R_MIPS_INSERT_A, 0 },
+  { "R_MIPS_TLS_DTPMOD64", R_MIPS_TLS_DTPMOD64, 0 },
+  { "R_MIPS_HI16", R_MIPS_HI16, 0 },
+  { "R_MIPS_TLS_LDM", R_MIPS_TLS_LDM, 0 },
+  { "R_MIPS_SCN_DISP", R_MIPS_SCN_DISP, 0 },
+  { "R_MIPS_GOT_LO16", R_MIPS_GOT_LO16, R_MIPS_GOT_HI16 - R_MIPS_GOT_LO16 },
+  { "R_MIPS_GLOB_DAT", R_MIPS_GLOB_DAT, 0 },
+  { "R_MIPS_TLS_GOTTPREL", R_MIPS_TLS_GOTTPREL, 0 },
+  { "R_MIPS_TLS_DTPREL32", R_MIPS_TLS_DTPREL32, 0 },
+  { "R_MIPS_TLS_DTPREL64", R_MIPS_TLS_DTPREL64, 0 },
+  { "R_MIPS_SHIFT5", R_MIPS_SHIFT5, 0 },
+  { "R_MIPS_SHIFT6", R_MIPS_SHIFT6, 0 },
+};
+static struct name _na_R_PPC_[] = {
+  { "R_PPC_EMB_SDA2REL", R_PPC_EMB_SDA2REL, 0 },
+  { "R_PPC_GOT16", R_PPC_GOT16, 0 },
+  { "R_PPC_REL14_BRNTAKEN", R_PPC_REL14_BRNTAKEN, 0 },
+  { "R_PPC_EMB_SDAI16", R_PPC_EMB_SDAI16, 0 },
+  { "R_PPC_GOT16_HI", R_PPC_GOT16_HI, 0 },
+  { "R_PPC_DTPMOD32", R_PPC_DTPMOD32, 0 },
+  { "R_PPC_GLOB_DAT", R_PPC_GLOB_DAT, 0 },
+  { "R_PPC_PLTREL24", R_PPC_PLTREL24, 0 },
+  { "R_PPC_REL16_HI", R_PPC_REL16_HI, 0 },
+  { "R_PPC_GOT_TLSGD16", R_PPC_GOT_TLSGD16, 0 },
+  { "R_PPC_GOT_DTPREL16", R_PPC_GOT_DTPREL16, 0 },
+  { "R_PPC_EMB_RELST_HA", R_PPC_EMB_RELST_HA, 0 },
+  { "R_PPC_SECTOFF_LO", R_PPC_SECTOFF_LO, R_PPC_SECTOFF_HI - R_PPC_SECTOFF_LO },
+  { "R_PPC_REL16_HA", R_PPC_REL16_HA, 0 },
+  { "R_PPC_DTPREL16_HA", R_PPC_DTPREL16_HA, 0 },
+  { "R_PPC_DTPREL16_HI", R_PPC_DTPREL16_HI, 0 },
+  { "R_PPC_DTPREL16_LO", R_PPC_DTPREL16_LO, R_PPC_DTPREL16_HI - R_PPC_DTPREL16_LO },
+  { "R_PPC_ADDR24", R_PPC_ADDR24, 0 },
+  { "R_PPC_GOT_TLSGD16_HI", R_PPC_GOT_TLSGD16_HI, 0 },
+  { "R_PPC_SDAREL16", R_PPC_SDAREL16, 0 },
+  { "R_PPC_EMB_RELST_LO", R_PPC_EMB_RELST_LO, R_PPC_EMB_RELST_HI - R_PPC_EMB_RELST_LO },
+  { "R_PPC_PLT32", R_PPC_PLT32, 0 },
+  { "R_PPC_UADDR32", R_PPC_UADDR32, 0 },
+  { "R_PPC_DTPREL16", R_PPC_DTPREL16, 0 },
+  { "R_PPC_EMB_NADDR16_HA", R_PPC_EMB_NADDR16_HA, 0 },
+  { "R_PPC_DTPREL32", R_PPC_DTPREL32, 0 },
+  { "R_PPC_EMB_NADDR16_HI", R_PPC_EMB_NADDR16_HI, 0 },
+  { "R_PPC_GOT_TPREL16_HA", R_PPC_GOT_TPREL16_HA, 0 },
+  { "R_PPC_GOT_TPREL16_LO", R_PPC_GOT_TPREL16_LO, R_PPC_GOT_TPREL16_HI - R_PPC_GOT_TPREL16_LO },
+  { "R_PPC_ADDR14", R_PPC_ADDR14, 0 },
+  { "R_PPC_ADDR16", R_PPC_ADDR16, 0 },
+  { "R_PPC_GOT_TLSGD16_HA", R_PPC_GOT_TLSGD16_HA, 0 },
+  { "R_PPC_ADDR32", R_PPC_ADDR32, 0 },
+  { "R_PPC_ADDR14_BRTAKEN", R_PPC_ADDR14_BRTAKEN, 0 },
+  { "R_PPC_REL16_LO", R_PPC_REL16_LO, R_PPC_REL16_HI - R_PPC_REL16_LO },
+  { "R_PPC_GOT_TLSGD16_LO", R_PPC_GOT_TLSGD16_LO, R_PPC_GOT_TLSGD16_HI - R_PPC_GOT_TLSGD16_LO },
+  { "R_PPC_GOT_TLSLD16_HI", R_PPC_GOT_TLSLD16_HI, 0 },
+  { "R_PPC_EMB_NADDR16", R_PPC_EMB_NADDR16, 0 },
+  { "R_PPC_TOC16", R_PPC_TOC16, 0 },
+  { "R_PPC_EMB_NADDR32", R_PPC_EMB_NADDR32, 0 },
+  { "R_PPC_TPREL16_HA", R_PPC_TPREL16_HA, 0 },
+  { "R_PPC_TPREL16_HI", R_PPC_TPREL16_HI, 0 },
+  { "R_PPC_REL14", R_PPC_REL14, 0 },
+  { "R_PPC_REL16", R_PPC_REL16, 0 },
+  { "R_PPC_REL24", R_PPC_REL24, 0 },
+  { "R_PPC_TPREL16_LO", R_PPC_TPREL16_LO, R_PPC_TPREL16_HI - R_PPC_TPREL16_LO },
+  { "R_PPC_REL32", R_PPC_REL32, 0 },
+  { "R_PPC_EMB_SDA2I16", R_PPC_EMB_SDA2I16, 0 },
+  { "R_PPC_TLS", R_PPC_TLS, 0 },
+  { "R_PPC_GOT_TPREL16", R_PPC_GOT_TPREL16, 0 },
+  { "R_PPC_GOT_DTPREL16_HA", R_PPC_GOT_DTPREL16_HA, 0 },
+  { "R_PPC_GOT_DTPREL16_HI", R_PPC_GOT_DTPREL16_HI, 0 },
+  { "R_PPC_GOT_TPREL16_HI", R_PPC_GOT_TPREL16_HI, 0 },
+  { "R_PPC_REL14_BRTAKEN", R_PPC_REL14_BRTAKEN, 0 },
+  { "R_PPC_GOT16_HA", R_PPC_GOT16_HA, 0 },
+  { "R_PPC_EMB_SDA21", R_PPC_EMB_SDA21, 0 },
+  { "R_PPC_DIAB_SDA21_HA", R_PPC_DIAB_SDA21_HA, 0 },
+  { "R_PPC_DIAB_SDA21_HI", R_PPC_DIAB_SDA21_HI, 0 },
+  { "R_PPC_PLTREL32", R_PPC_PLTREL32, 0 },
+  { "R_PPC_DIAB_SDA21_LO", R_PPC_DIAB_SDA21_LO, R_PPC_DIAB_SDA21_HI - R_PPC_DIAB_SDA21_LO },
+  { "R_PPC_PLT16_LO", R_PPC_PLT16_LO, R_PPC_PLT16_HI - R_PPC_PLT16_LO },
+  { "R_PPC_EMB_BIT_FLD", R_PPC_EMB_BIT_FLD, 0 },
+  { "R_PPC_EMB_NADDR16_LO", R_PPC_EMB_NADDR16_LO, R_PPC_EMB_NADDR16_HI - R_PPC_EMB_NADDR16_LO },
+  { "R_PPC_EMB_RELSDA", R_PPC_EMB_RELSDA, 0 },
+  { "R_PPC_EMB_MRKREF", R_PPC_EMB_MRKREF, 0 },
+  { "R_PPC_NONE", R_PPC_NONE, 0 },
+  { "R_PPC_IRELATIVE", R_PPC_IRELATIVE, 0 },
+  { "R_PPC_GOT16_LO", R_PPC_GOT16_LO, R_PPC_GOT16_HI - R_PPC_GOT16_LO },
+  { "R_PPC_LOCAL24PC", R_PPC_LOCAL24PC, 0 },
+  { "R_PPC_COPY", R_PPC_COPY, 0 },
+  { "R_PPC_EMB_RELSEC16", R_PPC_EMB_RELSEC16, 0 },
+  { "R_PPC_SECTOFF", R_PPC_SECTOFF, 0 },
+  { "R_PPC_ADDR16_HA", R_PPC_ADDR16_HA, 0 },
+  { "R_PPC_ADDR16_HI", R_PPC_ADDR16_HI, 0 },
+  { "R_PPC_ADDR16_LO", R_PPC_ADDR16_LO, R_PPC_ADDR16_HI - R_PPC_ADDR16_LO },
+  { "R_PPC_GOT_DTPREL16_LO", R_PPC_GOT_DTPREL16_LO, R_PPC_GOT_DTPREL16_HI - R_PPC_GOT_DTPREL16_LO },
+  { "R_PPC_TLSGD", R_PPC_TLSGD, 0 },
+  { "R_PPC_GOT_TLSLD16_HA", R_PPC_GOT_TLSLD16_HA, 0 },
+  { "R_PPC_TLSLD", R_PPC_TLSLD, 0 },
+  { "R_PPC_GOT_TLSLD16_LO", R_PPC_GOT_TLSLD16_LO, R_PPC_GOT_TLSLD16_HI - R_PPC_GOT_TLSLD16_LO },
+  { "R_PPC_EMB_RELST_HI", R_PPC_EMB_RELST_HI, 0 },
+  { "R_PPC_DIAB_RELSDA_HA", R_PPC_DIAB_RELSDA_HA, 0 },
+  { "R_PPC_DIAB_RELSDA_HI", R_PPC_DIAB_RELSDA_HI, 0 },
+  { "R_PPC_GOT_TLSLD16", R_PPC_GOT_TLSLD16, 0 },
+  { "R_PPC_UADDR16", R_PPC_UADDR16, 0 },
+  { "R_PPC_DIAB_RELSDA_LO", R_PPC_DIAB_RELSDA_LO, R_PPC_DIAB_RELSDA_HI - R_PPC_DIAB_RELSDA_LO },
+  { "R_PPC_PLT16_HA", R_PPC_PLT16_HA, 0 },
+  { "R_PPC_PLT16_HI", R_PPC_PLT16_HI, 0 },
+  { "R_PPC_RELATIVE", R_PPC_RELATIVE, 0 },
+  { "R_PPC_ADDR14_BRNTAKEN", R_PPC_ADDR14_BRNTAKEN, 0 },
+  { "R_PPC_TPREL16", R_PPC_TPREL16, 0 },
+  { "R_PPC_JMP_SLOT", R_PPC_JMP_SLOT, 0 },
+  { "R_PPC_SECTOFF_HA", R_PPC_SECTOFF_HA, 0 },
+  { "R_PPC_SECTOFF_HI", R_PPC_SECTOFF_HI, 0 },
+  { "R_PPC_TPREL32", R_PPC_TPREL32, 0 },
+};
+static struct name _na_R_PPC64_[] = {
+  { "R_PPC64_ADDR14", R_PPC64_ADDR14, 0 },
+  { "R_PPC64_ADDR24", R_PPC64_ADDR24, 0 },
+  { "R_PPC64_ADDR16", R_PPC64_ADDR16, 0 },
+  { "R_PPC64_ADDR30", R_PPC64_ADDR30, 0 },
+  { "R_PPC64_ADDR32", R_PPC64_ADDR32, 0 },
+  { "R_PPC64_COPY", R_PPC64_COPY, 0 },
+  { "R_PPC64_PLTGOT16", R_PPC64_PLTGOT16, 0 },
+  { "R_PPC64_PLTGOT16_DS", R_PPC64_PLTGOT16_DS, 0 },
+  { "R_PPC64_PLTGOT16_HA", R_PPC64_PLTGOT16_HA, 0 },
+  { "R_PPC64_PLTGOT16_HI", R_PPC64_PLTGOT16_HI, 0 },
+  { "R_PPC64_PLT16_HA", R_PPC64_PLT16_HA, 0 },
+  { "R_PPC64_RELATIVE", R_PPC64_RELATIVE, 0 },
+  { "R_PPC64_PLTGOT16_LO", R_PPC64_PLTGOT16_LO, R_PPC64_PLTGOT16_HI - R_PPC64_PLTGOT16_LO },
+  { "R_PPC64_DTPREL16_HIGHER", R_PPC64_DTPREL16_HIGHER, 0 },
+  { "R_PPC64_PLT16_LO", R_PPC64_PLT16_LO, R_PPC64_PLT16_HI - R_PPC64_PLT16_LO },
+  { "R_PPC64_JMP_IREL", R_PPC64_JMP_IREL, 0 },
+  { "R_PPC64_DTPREL16_HIGHESTA", R_PPC64_DTPREL16_HIGHESTA, 0 },
+  { "R_PPC64_PLTGOT16_LO_DS", R_PPC64_PLTGOT16_LO_DS, 0 },
+  { "R_PPC64_PLT64", R_PPC64_PLT64, 0 },
+  { "R_PPC64_TPREL16_HIGHERA", R_PPC64_TPREL16_HIGHERA, 0 },
+  { "R_PPC64_TPREL16_HIGHEST", R_PPC64_TPREL16_HIGHEST, 0 },
+  { "R_PPC64_TOC16_HA", R_PPC64_TOC16_HA, 0 },
+  { "R_PPC64_TPREL64", R_PPC64_TPREL64, 0 },
+  { "R_PPC64_GOT16_DS", R_PPC64_GOT16_DS, 0 },
+  { "R_PPC64_DTPREL16_LO_DS", R_PPC64_DTPREL16_LO_DS, 0 },
+  { "R_PPC64_TOC16_LO", R_PPC64_TOC16_LO, R_PPC64_TOC16_HI - R_PPC64_TOC16_LO },
+  { "R_PPC64_GOT16_HA", R_PPC64_GOT16_HA, 0 },
+  { "R_PPC64_GOT16_HI", R_PPC64_GOT16_HI, 0 },
+  { "R_PPC64_DTPMOD64", R_PPC64_DTPMOD64, 0 },
+  { "R_PPC64_GOT16_LO", R_PPC64_GOT16_LO, R_PPC64_GOT16_HI - R_PPC64_GOT16_LO },
+  { "R_PPC64_SECTOFF_HI", R_PPC64_SECTOFF_HI, 0 },
+  { "R_PPC64_PLTREL32", R_PPC64_PLTREL32, 0 },
+  { "R_PPC64_GLOB_DAT", R_PPC64_GLOB_DAT, 0 },
+  { "R_PPC64_TPREL16_HIGH", R_PPC64_TPREL16_HIGH, 0 },
+  { "R_PPC64_SECTOFF_LO_DS", R_PPC64_SECTOFF_LO_DS, 0 },
+  { "R_PPC64_TOC16", R_PPC64_TOC16, 0 },
+  { "R_PPC64_SECTOFF_LO", R_PPC64_SECTOFF_LO, R_PPC64_SECTOFF_HI - R_PPC64_SECTOFF_LO },
+  { "R_PPC64_TPREL16_LO_DS", R_PPC64_TPREL16_LO_DS, 0 },
+  { "R_PPC64_PLT16_LO_DS", R_PPC64_PLT16_LO_DS, 0 },
+  { "R_PPC64_TOCSAVE", R_PPC64_TOCSAVE, 0 },
+  { "R_PPC64_ADDR16_HIGHER", R_PPC64_ADDR16_HIGHER, 0 },
+  { "R_PPC64_TPREL16_DS", R_PPC64_TPREL16_DS, 0 },
+  { "R_PPC64_TOC16_LO_DS", R_PPC64_TOC16_LO_DS, 0 },
+  { "R_PPC64_REL14", R_PPC64_REL14, 0 },
+  { "R_PPC64_REL16", R_PPC64_REL16, 0 },
+  { "R_PPC64_REL24", R_PPC64_REL24, 0 },
+  { "R_PPC64_IRELATIVE", R_PPC64_IRELATIVE, 0 },
+  { "R_PPC64_GOT_DTPREL16_DS", R_PPC64_GOT_DTPREL16_DS, 0 },
+  { "R_PPC64_DTPREL16_HA", R_PPC64_DTPREL16_HA, 0 },
+  { "R_PPC64_REL64", R_PPC64_REL64, 0 },
+  { "R_PPC64_GOT_DTPREL16_HA", R_PPC64_GOT_DTPREL16_HA, 0 },
+  { "R_PPC64_GOT_DTPREL16_HI", R_PPC64_GOT_DTPREL16_HI, 0 },
+  { "R_PPC64_TOC", R_PPC64_TOC, 0 },
+  { "R_PPC64_GOT_TLSLD16_HI", R_PPC64_GOT_TLSLD16_HI, 0 },
+  { "R_PPC64_GOT_TLSLD16", R_PPC64_GOT_TLSLD16, 0 },
+  { "R_PPC64_NONE", R_PPC64_NONE, 0 },
+  { "R_PPC64_DTPREL16", R_PPC64_DTPREL16, 0 },
+  { "R_PPC64_TPREL16_HIGHER", R_PPC64_TPREL16_HIGHER, 0 },
+  { "R_PPC64_ADDR16_HIGHESTA", R_PPC64_ADDR16_HIGHESTA, 0 },
+  { "R_PPC64_ADDR64", R_PPC64_ADDR64, 0 },
+  { "R_PPC64_ADDR16_DS", R_PPC64_ADDR16_DS, 0 },
+  { "R_PPC64_SECTOFF_DS", R_PPC64_SECTOFF_DS, 0 },
+  { "R_PPC64_ADDR16_HA", R_PPC64_ADDR16_HA, 0 },
+  { "R_PPC64_ADDR16_HI", R_PPC64_ADDR16_HI, 0 },
+  { "R_PPC64_REL32", R_PPC64_REL32, 0 },
+  { "R_PPC64_GOT_TLSLD16_HA", R_PPC64_GOT_TLSLD16_HA, 0 },
+  { "R_PPC64_ADDR16_LO", R_PPC64_ADDR16_LO, R_PPC64_ADDR16_HI - R_PPC64_ADDR16_LO },
+  { "R_PPC64_GOT_TPREL16_HI", R_PPC64_GOT_TPREL16_HI, 0 },
+  { "R_PPC64_DTPREL64", R_PPC64_DTPREL64, 0 },
+  { "R_PPC64_UADDR16", R_PPC64_UADDR16, 0 },
+  { "R_PPC64_PLT16_HI", R_PPC64_PLT16_HI, 0 },
+  { "R_PPC64_REL16_HA", R_PPC64_REL16_HA, 0 },
+  { "R_PPC64_UADDR32", R_PPC64_UADDR32, 0 },
+  { "R_PPC64_UADDR64", R_PPC64_UADDR64, 0 },
+  { "R_PPC64_JMP_SLOT", R_PPC64_JMP_SLOT, 0 },
+  { "R_PPC64_DTPREL16_HIGH", R_PPC64_DTPREL16_HIGH, 0 },
+  { "R_PPC64_ADDR16_HIGH", R_PPC64_ADDR16_HIGH, 0 },
+  { "R_PPC64_REL16_HI", R_PPC64_REL16_HI, 0 },
+  { "R_PPC64_TLSLD", R_PPC64_TLSLD, 0 },
+  { "R_PPC64_ADDR14_BRTAKEN", R_PPC64_ADDR14_BRTAKEN, 0 },
+  { "R_PPC64_REL14_BRNTAKEN", R_PPC64_REL14_BRNTAKEN, 0 },
+  { "R_PPC64_GOT_TLSLD16_LO", R_PPC64_GOT_TLSLD16_LO, R_PPC64_GOT_TLSLD16_HI - R_PPC64_GOT_TLSLD16_LO },
+  { "R_PPC64_TPREL16_HIGHA", R_PPC64_TPREL16_HIGHA, 0 },
+  { "R_PPC64_TLSGD", R_PPC64_TLSGD, 0 },
+  { "R_PPC64_DTPREL16_DS", R_PPC64_DTPREL16_DS, 0 },
+  { "R_PPC64_TOC16_DS", R_PPC64_TOC16_DS, 0 },
+  { "R_PPC64_GOT_TLSGD16", R_PPC64_GOT_TLSGD16, 0 },
+  { "R_PPC64_PLTREL64", R_PPC64_PLTREL64, 0 },
+  { "R_PPC64_DTPREL16_HI", R_PPC64_DTPREL16_HI, 0 },
+  { "R_PPC64_TPREL16", R_PPC64_TPREL16, 0 },
+  { "R_PPC64_SECTOFF_HA", R_PPC64_SECTOFF_HA, 0 },
+  { "R_PPC64_TPREL16_HA", R_PPC64_TPREL16_HA, 0 },
+  { "R_PPC64_TPREL16_HI", R_PPC64_TPREL16_HI, 0 },
+  { "R_PPC64_ADDR14_BRNTAKEN", R_PPC64_ADDR14_BRNTAKEN, 0 },
+  { "R_PPC64_TPREL16_HIGHESTA", R_PPC64_TPREL16_HIGHESTA, 0 },
+  { "R_PPC64_ADDR16_HIGHERA", R_PPC64_ADDR16_HIGHERA, 0 },
+  { "R_PPC64_DTPREL16_HIGHA", R_PPC64_DTPREL16_HIGHA, 0 },
+  { "R_PPC64_GOT_TPREL16_LO_DS", R_PPC64_GOT_TPREL16_LO_DS, 0 },
+  { "R_PPC64_TPREL16_LO", R_PPC64_TPREL16_LO, R_PPC64_TPREL16_HI - R_PPC64_TPREL16_LO },
+  { "R_PPC64_TLS", R_PPC64_TLS, 0 },
+  { "R_PPC64_DTPREL16_HIGHERA", R_PPC64_DTPREL16_HIGHERA, 0 },
+  { "R_PPC64_DTPREL16_HIGHEST", R_PPC64_DTPREL16_HIGHEST, 0 },
+  { "R_PPC64_GOT16", R_PPC64_GOT16, 0 },
+  { "R_PPC64_DTPREL16_LO", R_PPC64_DTPREL16_LO, R_PPC64_DTPREL16_HI - R_PPC64_DTPREL16_LO },
+  { "R_PPC64_ADDR16_HIGHEST", R_PPC64_ADDR16_HIGHEST, 0 },
+  { "R_PPC64_ADDR16_HIGHA", R_PPC64_ADDR16_HIGHA, 0 },
+  { "R_PPC64_GOT_TPREL16_DS", R_PPC64_GOT_TPREL16_DS, 0 },
+  { "R_PPC64_GOT_TPREL16_HA", R_PPC64_GOT_TPREL16_HA, 0 },
+  { "R_PPC64_PLT32", R_PPC64_PLT32, 0 },
+  { "R_PPC64_TOC16_HI", R_PPC64_TOC16_HI, 0 },
+  { "R_PPC64_GOT16_LO_DS", R_PPC64_GOT16_LO_DS, 0 },
+  { "R_PPC64_SECTOFF", R_PPC64_SECTOFF, 0 },
+  { "R_PPC64_GOT_TLSGD16_HA", R_PPC64_GOT_TLSGD16_HA, 0 },
+  { "R_PPC64_GOT_TLSGD16_HI", R_PPC64_GOT_TLSGD16_HI, 0 },
+  { "R_PPC64_GOT_DTPREL16_LO_DS", R_PPC64_GOT_DTPREL16_LO_DS, 0 },
+  { "R_PPC64_GOT_TLSGD16_LO", R_PPC64_GOT_TLSGD16_LO, R_PPC64_GOT_TLSGD16_HI - R_PPC64_GOT_TLSGD16_LO },
+  { "R_PPC64_REL16_LO", R_PPC64_REL16_LO, R_PPC64_REL16_HI - R_PPC64_REL16_LO },
+  { "R_PPC64_REL14_BRTAKEN", R_PPC64_REL14_BRTAKEN, 0 },
+  { "R_PPC64_ADDR16_LO_DS", R_PPC64_ADDR16_LO_DS, 0 },
+};
+static struct name _na_R_SH_[] = {
+  { "R_SH_GNU_VTINHERIT", R_SH_GNU_VTINHERIT, 0 },
+  { "R_SH_GOTOFF", R_SH_GOTOFF, 0 },
+  { "R_SH_LABEL", R_SH_LABEL, 0 },
+  { "R_SH_GOT32", R_SH_GOT32, 0 },
+  { "R_SH_SWITCH16", R_SH_SWITCH16, 0 },
+  { "R_SH_DIR8W", R_SH_DIR8W, 0 },
+  { "R_SH_SWITCH32", R_SH_SWITCH32, 0 },
+  { "R_SH_GNU_VTENTRY", R_SH_GNU_VTENTRY, 0 },
+  { "R_SH_DIR8BP", R_SH_DIR8BP, 0 },
+  { "R_SH_TLS_LD_32", R_SH_TLS_LD_32, 0 },
+  { "R_SH_IND12W", R_SH_IND12W, 0 },
+  { "R_SH_TLS_DTPMOD32", R_SH_TLS_DTPMOD32, 0 },
+  { "R_SH_GOTPC", R_SH_GOTPC, 0 },
+  { "R_SH_TLS_TPOFF32", R_SH_TLS_TPOFF32, 0 },
+  { "R_SH_USES", R_SH_USES, 0 },
+  { "R_SH_SWITCH8", R_SH_SWITCH8, 0 },
+  { "R_SH_DATA", R_SH_DATA, 0 },
+  { "R_SH_PLT32", R_SH_PLT32, 0 },
+  { "R_SH_TLS_LDO_32", R_SH_TLS_LDO_32, 0 },
+  { "R_SH_TLS_DTPOFF32", R_SH_TLS_DTPOFF32, 0 },
+  { "R_SH_DIR32", R_SH_DIR32, 0 },
+  { "R_SH_TLS_LE_32", R_SH_TLS_LE_32, 0 },
+  { "R_SH_TLS_GD_32", R_SH_TLS_GD_32, 0 },
+  { "R_SH_DIR8WPL", R_SH_DIR8WPL, 0 },
+  { "R_SH_DIR8WPZ", R_SH_DIR8WPZ, 0 },
+  { "R_SH_RELATIVE", R_SH_RELATIVE, 0 },
+  { "R_SH_JMP_SLOT", R_SH_JMP_SLOT, 0 },
+  { "R_SH_DIR8WPN", R_SH_DIR8WPN, 0 },
+  { "R_SH_REL32", R_SH_REL32, 0 },
+  { "R_SH_ALIGN", R_SH_ALIGN, 0 },
+  { "R_SH_GLOB_DAT", R_SH_GLOB_DAT, 0 },
+  { "R_SH_NUM", R_SH_NUM, 0 },
+  { "R_SH_DIR8L", R_SH_DIR8L, 0 },
+  { "R_SH_TLS_IE_32", R_SH_TLS_IE_32, 0 },
+  { "R_SH_CODE", R_SH_CODE, 0 },
+  { "R_SH_COUNT", R_SH_COUNT, 0 },
+  { "R_SH_NONE", R_SH_NONE, 0 },
+  { "R_SH_COPY", R_SH_COPY, 0 },
+};
+static struct name _na_R_SPARC_[] = {
+  { "R_SPARC_TLS_LE_LOX10", R_SPARC_TLS_LE_LOX10, 0 },
+  { "R_SPARC_PLT32", R_SPARC_PLT32, 0 },
+  { "R_SPARC_TLS_DTPOFF32", R_SPARC_TLS_DTPOFF32, 0 },
+  { "R_SPARC_WPLT30", R_SPARC_WPLT30, 0 },
+  { "R_SPARC_TLS_GD_CALL", R_SPARC_TLS_GD_CALL, 0 },
+  { "R_SPARC_H34", R_SPARC_H34, 0 },
+  { "R_SPARC_PLT64", R_SPARC_PLT64, 0 },
+  { "R_SPARC_TLS_IE_LO10", R_SPARC_TLS_IE_LO10, 0 },
+  { "R_SPARC_DISP64", R_SPARC_DISP64, 0 },
+  { "R_SPARC_SIZE64", R_SPARC_SIZE64, 0 },
+  { "R_SPARC_PCPLT32", R_SPARC_PCPLT32, 0 },
+  { "R_SPARC_TLS_TPOFF32", R_SPARC_TLS_TPOFF32, 0 },
+  { "R_SPARC_TLS_TPOFF64", R_SPARC_TLS_TPOFF64, 0 },
+  { "R_SPARC_UA16", R_SPARC_UA16, 0 },
+  { "R_SPARC_PCPLT10", R_SPARC_PCPLT10, 0 },
+  { "R_SPARC_NONE", R_SPARC_NONE, 0 },
+  { "R_SPARC_DISP16", R_SPARC_DISP16, 0 },
+  { "R_SPARC_DISP32", R_SPARC_DISP32, 0 },
+  { "R_SPARC_5", R_SPARC_5, 0 },
+  { "R_SPARC_8", R_SPARC_8, 0 },
+  { "R_SPARC_TLS_GD_ADD", R_SPARC_TLS_GD_ADD, 0 },
+  { "R_SPARC_COPY", R_SPARC_COPY, 0 },
+  { "R_SPARC_M44", R_SPARC_M44, 0 },
+  { "R_SPARC_WDISP16", R_SPARC_WDISP16, 0 },
+  { "R_SPARC_WDISP19", R_SPARC_WDISP19, 0 },
+  { "R_SPARC_TLS_LE_HIX22", R_SPARC_TLS_LE_HIX22, 0 },
+  { "R_SPARC_WDISP22", R_SPARC_WDISP22, 0 },
+  { "R_SPARC_WDISP30", R_SPARC_WDISP30, 0 },
+  { "R_SPARC_HI22", R_SPARC_HI22, 0 },
+  { "R_SPARC_10", R_SPARC_10, 0 },
+  { "R_SPARC_11", R_SPARC_11, 0 },
+  { "R_SPARC_13", R_SPARC_13, 0 },
+  { "R_SPARC_16", R_SPARC_16, 0 },
+  { "R_SPARC_22", R_SPARC_22, 0 },
+  { "R_SPARC_32", R_SPARC_32, 0 },
+  { "R_SPARC_LO10", R_SPARC_LO10, 0 },
+  { "R_SPARC_64", R_SPARC_64, 0 },
+  { "R_SPARC_HM10", R_SPARC_HM10, 0 },
+  { "R_SPARC_PC_HM10", R_SPARC_PC_HM10, 0 },
+  { "R_SPARC_GNU_VTINHERIT", R_SPARC_GNU_VTINHERIT, 0 },
+  { "R_SPARC_GLOB_JMP", R_SPARC_GLOB_JMP, 0 },
+  { "R_SPARC_TLS_IE_LDX", R_SPARC_TLS_IE_LDX, 0 },
+  { "R_SPARC_PC10", R_SPARC_PC10, 0 },
+  { "R_SPARC_PC22", R_SPARC_PC22, 0 },
+  { "R_SPARC_HIPLT22", R_SPARC_HIPLT22, 0 },
+  { "R_SPARC_IRELATIVE", R_SPARC_IRELATIVE, 0 },
+  { "R_SPARC_TLS_LDO_HIX22", R_SPARC_TLS_LDO_HIX22, 0 },
+  { "R_SPARC_SIZE32", R_SPARC_SIZE32, 0 },
+  { "R_SPARC_UA64", R_SPARC_UA64, 0 },
+  { "R_SPARC_GOTDATA_HIX22", R_SPARC_GOTDATA_HIX22, 0 },
+  { "R_SPARC_TLS_IE_LD", R_SPARC_TLS_IE_LD, 0 },
+  { "R_SPARC_LOX10", R_SPARC_LOX10, 0 },
+  { "R_SPARC_LM22", R_SPARC_LM22, 0 },
+  { "R_SPARC_GOTDATA_OP", R_SPARC_GOTDATA_OP, 0 },
+  { "R_SPARC_GOTDATA_OP_LOX10", R_SPARC_GOTDATA_OP_LOX10, 0 },
+  { "R_SPARC_NUM", R_SPARC_NUM, 0 },
+  { "R_SPARC_OLO10", R_SPARC_OLO10, 0 },
+  { "R_SPARC_JMP_SLOT", R_SPARC_JMP_SLOT, 0 },
+  { "R_SPARC_GOTDATA_LOX10", R_SPARC_GOTDATA_LOX10, 0 },
+  { "R_SPARC_TLS_LDO_ADD", R_SPARC_TLS_LDO_ADD, 0 },
+  { "R_SPARC_UA32", R_SPARC_UA32, 0 },
+  { "R_SPARC_TLS_IE_HI22", R_SPARC_TLS_IE_HI22, 0 },
+  { "R_SPARC_DISP8", R_SPARC_DISP8, 0 },
+  { "R_SPARC_TLS_LDO_LOX10", R_SPARC_TLS_LDO_LOX10, 0 },
+  { "R_SPARC_RELATIVE", R_SPARC_RELATIVE, 0 },
+  { "R_SPARC_TLS_DTPOFF64", R_SPARC_TLS_DTPOFF64, 0 },
+  { "R_SPARC_PC_LM22", R_SPARC_PC_LM22, 0 },
+  { "R_SPARC_REGISTER", R_SPARC_REGISTER, 0 },
+  { "R_SPARC_GOTDATA_OP_HIX22", R_SPARC_GOTDATA_OP_HIX22, 0 },
+  { "R_SPARC_PCPLT22", R_SPARC_PCPLT22, 0 },
+  { "R_SPARC_GOT10", R_SPARC_GOT10, 0 },
+  { "R_SPARC_GOT13", R_SPARC_GOT13, 0 },
+  { "R_SPARC_JMP_IREL", R_SPARC_JMP_IREL, 0 },
+  { "R_SPARC_GOT22", R_SPARC_GOT22, 0 },
+  { "R_SPARC_TLS_LDM_ADD", R_SPARC_TLS_LDM_ADD, 0 },
+  { "R_SPARC_H44", R_SPARC_H44, 0 },
+  { "R_SPARC_GNU_VTENTRY", R_SPARC_GNU_VTENTRY, 0 },
+  { "R_SPARC_REV32", R_SPARC_REV32, 0 },
+  { "R_SPARC_GLOB_DAT", R_SPARC_GLOB_DAT, 0 },
+  { "R_SPARC_TLS_DTPMOD32", R_SPARC_TLS_DTPMOD32, 0 },
+  { "R_SPARC_TLS_DTPMOD64", R_SPARC_TLS_DTPMOD64, 0 },
+  { "R_SPARC_TLS_LDM_LO10", R_SPARC_TLS_LDM_LO10, 0 },
+  { "R_SPARC_6", R_SPARC_6, 0 },
+  { "R_SPARC_7", R_SPARC_7, 0 },
+  { "R_SPARC_L44", R_SPARC_L44, 0 },
+  { "R_SPARC_TLS_GD_HI22", R_SPARC_TLS_GD_HI22, 0 },
+  { "R_SPARC_HIX22", R_SPARC_HIX22, 0 },
+  { "R_SPARC_HH22", R_SPARC_HH22, 0 },
+  { "R_SPARC_WDISP10", R_SPARC_WDISP10, 0 },
+  { "R_SPARC_PC_HH22", R_SPARC_PC_HH22, 0 },
+  { "R_SPARC_TLS_LDM_CALL", R_SPARC_TLS_LDM_CALL, 0 },
+  { "R_SPARC_LOPLT10", R_SPARC_LOPLT10, 0 },
+  { "R_SPARC_TLS_GD_LO10", R_SPARC_TLS_GD_LO10, 0 },
+  { "R_SPARC_TLS_IE_ADD", R_SPARC_TLS_IE_ADD, 0 },
+  { "R_SPARC_TLS_LDM_HI22", R_SPARC_TLS_LDM_HI22, 0 },
+};
+static struct name _na_R_X86_64_[] = {
+  { "R_X86_64_TPOFF64", R_X86_64_TPOFF64, 0 },
+  { "R_X86_64_32S", R_X86_64_32S, 0 },
+  { "R_X86_64_GOT64", R_X86_64_GOT64, 0 },
+  { "R_X86_64_64", R_X86_64_64, 0 },
+  { "R_X86_64_PC8", R_X86_64_PC8, 0 },
+  { "R_X86_64_DTPOFF32", R_X86_64_DTPOFF32, 0 },
+  { "R_X86_64_DTPOFF64", R_X86_64_DTPOFF64, 0 },
+  { "R_X86_64_IRELATIVE", R_X86_64_IRELATIVE, 0 },
+  { "R_X86_64_TLSGD", R_X86_64_TLSGD, 0 },
+  { "R_X86_64_RELATIVE", R_X86_64_RELATIVE, 0 },
+  { "R_X86_64_NONE", R_X86_64_NONE, 0 },
+  { "R_X86_64_SIZE64", R_X86_64_SIZE64, 0 },
+  { "R_X86_64_GOTTPOFF", R_X86_64_GOTTPOFF, 0 },
+  { "R_X86_64_COPY", R_X86_64_COPY, 0 },
+  { "R_X86_64_REX_GOTPCRELX", R_X86_64_REX_GOTPCRELX, 0 },
+  { "R_X86_64_8", R_X86_64_8, 0 },
+  { "R_X86_64_GOTPC32_TLSDESC", R_X86_64_GOTPC32_TLSDESC, 0 },
+  { "R_X86_64_SIZE32", R_X86_64_SIZE32, 0 },
+  { "R_X86_64_NUM", R_X86_64_NUM, 0 },
+  { "R_X86_64_PLTOFF64", R_X86_64_PLTOFF64, 0 },
+  { "R_X86_64_GOTPLT64", R_X86_64_GOTPLT64, 0 },
+  { "R_X86_64_GOTOFF64", R_X86_64_GOTOFF64, 0 },
+  { "R_X86_64_PC16", R_X86_64_PC16, 0 },
+  { "R_X86_64_PC32", R_X86_64_PC32, 0 },
+  { "R_X86_64_TLSDESC", R_X86_64_TLSDESC, 0 },
+  { "R_X86_64_DTPMOD64", R_X86_64_DTPMOD64, 0 },
+  { "R_X86_64_PC64", R_X86_64_PC64, 0 },
+  { "R_X86_64_TLSDESC_CALL", R_X86_64_TLSDESC_CALL, 0 },
+  { "R_X86_64_RELATIVE64", R_X86_64_RELATIVE64, 0 },
+  { "R_X86_64_16", R_X86_64_16, 0 },
+  { "R_X86_64_32", R_X86_64_32, 0 },
+  { "R_X86_64_GOTPCREL", R_X86_64_GOTPCREL, 0 },
+  { "R_X86_64_GOT32", R_X86_64_GOT32, 0 },
+  { "R_X86_64_JUMP_SLOT", R_X86_64_JUMP_SLOT, 0 },
+  { "R_X86_64_GOTPCRELX", R_X86_64_GOTPCRELX, 0 },
+  { "R_X86_64_GLOB_DAT", R_X86_64_GLOB_DAT, 0 },
+  { "R_X86_64_TLSLD", R_X86_64_TLSLD, 0 },
+  { "R_X86_64_PLT32", R_X86_64_PLT32, 0 },
+  { "R_X86_64_GOTPCREL64", R_X86_64_GOTPCREL64, 0 },
+  { "R_X86_64_GOTPC32", R_X86_64_GOTPC32, 0 },
+  { "R_X86_64_TPOFF32", R_X86_64_TPOFF32, 0 },
+  { "R_X86_64_GOTPC64", R_X86_64_GOTPC64, 0 },
+};
+static struct name _na_SHF_[] = {
+  { "SHF_EXECINSTR", SHF_EXECINSTR, 0 },
+  { "SHF_STRINGS", SHF_STRINGS, 0 },
+  { "SHF_WRITE", SHF_WRITE, 0 },
+  { "SHF_LINK_ORDER", SHF_LINK_ORDER, 0 },
+  { "SHF_ALLOC", SHF_ALLOC, 0 },
+  { "SHF_INFO_LINK", SHF_INFO_LINK, 0 },
+  { "SHF_COMPRESSED", SHF_COMPRESSED, 0 },
+  { "SHF_MASKOS", SHF_MASKOS, 0 },
+  { "SHF_ORDERED", SHF_ORDERED, 0 },
+  { "SHF_MERGE", SHF_MERGE, 0 },
+  { "SHF_OS_NONCONFORMING", SHF_OS_NONCONFORMING, 0 },
+  { "SHF_EXCLUDE", SHF_EXCLUDE, 0 },
+  { "SHF_MASKPROC", SHF_MASKPROC, 0 },
+  { "SHF_GNU_RETAIN", SHF_GNU_RETAIN, 0 },
+  { "SHF_GROUP", SHF_GROUP, 0 },
+  { "SHF_TLS", SHF_TLS, 0 },
+};
+static struct name _na_SHF_ALPHA_[] = {
+  { "SHF_ALPHA_GPREL", SHF_ALPHA_GPREL, 0 },
+};
+static struct name _na_SHF_ARM_[] = {
+  { "SHF_ARM_ENTRYSECT", SHF_ARM_ENTRYSECT, 0 },
+  { "SHF_ARM_COMDEF", SHF_ARM_COMDEF, 0 },
+};
+static struct name _na_SHF_HP_[] = {
+  { "SHF_PARISC_SHORT", SHF_PARISC_SHORT, 0 },
+  { "SHF_PARISC_HUGE", SHF_PARISC_HUGE, 0 },
+  { "SHF_PARISC_SBP", SHF_PARISC_SBP, 0 },
+};
+static struct name _na_SHF_IA_64_[] = {
+  { "SHF_IA_64_SHORT", SHF_IA_64_SHORT, 0 },
+  { "SHF_IA_64_NORECOV", SHF_IA_64_NORECOV, 0 },
+};
+static struct name _na_SHF_MIPS_[] = {
+  { "SHF_MIPS_NOSTRIP", SHF_MIPS_NOSTRIP, 0 },
+  { "SHF_MIPS_ADDR", SHF_MIPS_ADDR, 0 },
+  { "SHF_MIPS_STRINGS", SHF_MIPS_STRINGS, 0 },
+  { "SHF_MIPS_GPREL", SHF_MIPS_GPREL, 0 },
+  { "SHF_MIPS_NAMES", SHF_MIPS_NAMES, 0 },
+  { "SHF_MIPS_NODUPE", SHF_MIPS_NODUPE, 0 },
+  { "SHF_MIPS_LOCAL", SHF_MIPS_LOCAL, 0 },
+  { "SHF_MIPS_MERGE", SHF_MIPS_MERGE, 0 },
+};
+static struct name _na_SHN_[] = {
+  { "SHN_LORESERVE", SHN_LORESERVE, SHN_HIRESERVE - SHN_LORESERVE },
+  { "SHN_ABS", SHN_ABS, 0 },
+  { "SHN_HIRESERVE", SHN_HIRESERVE, 0 },
+  { "SHN_BEFORE", SHN_BEFORE, 0 },
+  { "SHN_COMMON", SHN_COMMON, 0 },
+  { "SHN_HIOS", SHN_HIOS, 0 },
+  { "SHN_LOOS", SHN_LOOS, SHN_HIOS - SHN_LOOS },
+  { "SHN_AFTER", SHN_AFTER, 0 },
+  { "SHN_LOPROC", SHN_LOPROC, SHN_HIPROC - SHN_LOPROC },
+  { "SHN_XINDEX", SHN_XINDEX, 0 },
+  { "SHN_HIPROC", SHN_HIPROC, 0 },
+  { "SHN_UNDEF", SHN_UNDEF, 0 },
+};
+static struct name _na_SHN_HP_[] = {
+  { "SHN_PARISC_HUGE_COMMON", SHN_PARISC_HUGE_COMMON, 0 },
+  { "SHN_PARISC_ANSI_COMMON", SHN_PARISC_ANSI_COMMON, 0 },
+};
+static struct name _na_SHN_MIPS_[] = {
+  { "SHN_MIPS_SCOMMON", SHN_MIPS_SCOMMON, 0 },
+  { "SHN_MIPS_TEXT", SHN_MIPS_TEXT, 0 },
+  { "SHN_MIPS_SUNDEFINED", SHN_MIPS_SUNDEFINED, 0 },
+  { "SHN_MIPS_DATA", SHN_MIPS_DATA, 0 },
+  { "SHN_MIPS_ACOMMON", SHN_MIPS_ACOMMON, 0 },
+};
+static struct name _na_SHT_[] = {
+  { "SHT_HIUSER", SHT_HIUSER, 0 },
+  { "SHT_SUNW_move", SHT_SUNW_move, 0 },
+  { "SHT_GNU_HASH", SHT_GNU_HASH, 0 },
+  { "SHT_SUNW_COMDAT", SHT_SUNW_COMDAT, 0 },
+  { "SHT_PROGBITS", SHT_PROGBITS, 0 },
+  { "SHT_STRTAB", SHT_STRTAB, 0 },
+  { "SHT_HIOS", SHT_HIOS, 0 },
+  { "SHT_INIT_ARRAY", SHT_INIT_ARRAY, 0 },
+  { "SHT_LOOS", SHT_LOOS, SHT_HIOS - SHT_LOOS },
+  { "SHT_GNU_verneed", SHT_GNU_verneed, 0 },
+  { "SHT_CSKY_ATTRIBUTES", SHT_CSKY_ATTRIBUTES, 0 },
+  { "SHT_PREINIT_ARRAY", SHT_PREINIT_ARRAY, 0 },
+  { "SHT_REL", SHT_REL, 0 },
+  { "SHT_SYMTAB_SHNDX", SHT_SYMTAB_SHNDX, 0 },
+  { "SHT_NOBITS", SHT_NOBITS, 0 },
+  { "SHT_SUNW_syminfo", SHT_SUNW_syminfo, 0 },
+  { "SHT_FINI_ARRAY", SHT_FINI_ARRAY, 0 },
+  { "SHT_GNU_LIBLIST", SHT_GNU_LIBLIST, 0 },
+  { "SHT_SHLIB", SHT_SHLIB, 0 },
+  { "SHT_LOSUNW", SHT_LOSUNW, SHT_HISUNW - SHT_LOSUNW },
+  { "SHT_HISUNW", SHT_HISUNW, 0 },
+  { "SHT_GNU_ATTRIBUTES", SHT_GNU_ATTRIBUTES, 0 },
+  { "SHT_GNU_verdef", SHT_GNU_verdef, 0 },
+  { "SHT_NULL", SHT_NULL, 0 },
+  { "SHT_RISCV_ATTRIBUTES", SHT_RISCV_ATTRIBUTES, 0 },
+  { "SHT_NOTE", SHT_NOTE, 0 },
+  { "SHT_LOPROC", SHT_LOPROC, SHT_HIPROC - SHT_LOPROC },
+  { "SHT_RELA", SHT_RELA, 0 },
+  { "SHT_LOUSER", SHT_LOUSER, SHT_HIUSER - SHT_LOUSER },
+  { "SHT_RELR", SHT_RELR, 0 },
+  { "SHT_HIPROC", SHT_HIPROC, 0 },
+  { "SHT_DYNSYM", SHT_DYNSYM, 0 },
+  { "SHT_GNU_versym", SHT_GNU_versym, 0 },
+  { "SHT_DYNAMIC", SHT_DYNAMIC, 0 },
+  { "SHT_GROUP", SHT_GROUP, 0 },
+  { "SHT_NUM", SHT_NUM, 0 },
+  { "SHT_CHECKSUM", SHT_CHECKSUM, 0 },
+  { "SHT_SYMTAB", SHT_SYMTAB, 0 },
+  { "SHT_HASH", SHT_HASH, 0 },
+};
+static struct name _na_SHT_ALPHA_[] = {
+  { "SHT_ALPHA_DEBUG", SHT_ALPHA_DEBUG, 0 },
+  { "SHT_ALPHA_REGINFO", SHT_ALPHA_REGINFO, 0 },
+};
+static struct name _na_SHT_ARM_[] = {
+  { "SHT_ARM_PREEMPTMAP", SHT_ARM_PREEMPTMAP, 0 },
+  { "SHT_ARM_ATTRIBUTES", SHT_ARM_ATTRIBUTES, 0 },
+  { "SHT_ARM_EXIDX", SHT_ARM_EXIDX, 0 },
+};
+static struct name _na_SHT_HP_[] = {
+  { "SHT_PARISC_EXT", SHT_PARISC_EXT, 0 },
+  { "SHT_PARISC_UNWIND", SHT_PARISC_UNWIND, 0 },
+  { "SHT_PARISC_DOC", SHT_PARISC_DOC, 0 },
+};
+static struct name _na_SHT_IA_64_[] = {
+  { "SHT_IA_64_EXT", SHT_IA_64_EXT, 0 },
+  { "SHT_IA_64_UNWIND", SHT_IA_64_UNWIND, 0 },
+};
+static struct name _na_SHT_MIPS_[] = {
+  { "SHT_MIPS_DELTASYM", SHT_MIPS_DELTASYM, 0 },
+  { "SHT_MIPS_DENSE", SHT_MIPS_DENSE, 0 },
+  { "SHT_MIPS_DELTAINST", SHT_MIPS_DELTAINST, 0 },
+  { "SHT_MIPS_TRANSLATE", SHT_MIPS_TRANSLATE, 0 },
+  { "SHT_MIPS_FDESC", SHT_MIPS_FDESC, 0 },
+  { "SHT_MIPS_XLATE_OLD", SHT_MIPS_XLATE_OLD, 0 },
+  { "SHT_MIPS_LOCSTR", SHT_MIPS_LOCSTR, 0 },
+  { "SHT_MIPS_XHASH", SHT_MIPS_XHASH, 0 },
+  { "SHT_MIPS_REGINFO", SHT_MIPS_REGINFO, 0 },
+  { "SHT_MIPS_DELTACLASS", SHT_MIPS_DELTACLASS, 0 },
+  { "SHT_MIPS_EVENTS", SHT_MIPS_EVENTS, 0 },
+  { "SHT_MIPS_AUXSYM", SHT_MIPS_AUXSYM, 0 },
+  { "SHT_MIPS_PDR_EXCEPTION", SHT_MIPS_PDR_EXCEPTION, 0 },
+  { "SHT_MIPS_PIXIE", SHT_MIPS_PIXIE, 0 },
+  { "SHT_MIPS_UCODE", SHT_MIPS_UCODE, 0 },
+  { "SHT_MIPS_GPTAB", SHT_MIPS_GPTAB, 0 },
+  { "SHT_MIPS_XLATE", SHT_MIPS_XLATE, 0 },
+  { "SHT_MIPS_LOCSYM", SHT_MIPS_LOCSYM, 0 },
+  { "SHT_MIPS_PDESC", SHT_MIPS_PDESC, 0 },
+  { "SHT_MIPS_CONTENT", SHT_MIPS_CONTENT, 0 },
+  { "SHT_MIPS_OPTSYM", SHT_MIPS_OPTSYM, 0 },
+  { "SHT_MIPS_CONFLICT", SHT_MIPS_CONFLICT, 0 },
+  { "SHT_MIPS_IFACE", SHT_MIPS_IFACE, 0 },
+  { "SHT_MIPS_SYMBOL_LIB", SHT_MIPS_SYMBOL_LIB, 0 },
+  { "SHT_MIPS_LIBLIST", SHT_MIPS_LIBLIST, 0 },
+  { "SHT_MIPS_XLATE_DEBUG", SHT_MIPS_XLATE_DEBUG, 0 },
+  { "SHT_MIPS_LINE", SHT_MIPS_LINE, 0 },
+  { "SHT_MIPS_RELD", SHT_MIPS_RELD, 0 },
+  { "SHT_MIPS_OPTIONS", SHT_MIPS_OPTIONS, 0 },
+  { "SHT_MIPS_DELTADECL", SHT_MIPS_DELTADECL, 0 },
+  { "SHT_MIPS_PACKSYM", SHT_MIPS_PACKSYM, 0 },
+  { "SHT_MIPS_DEBUG", SHT_MIPS_DEBUG, 0 },
+  { "SHT_MIPS_DWARF", SHT_MIPS_DWARF, 0 },
+  { "SHT_MIPS_EXTSYM", SHT_MIPS_EXTSYM, 0 },
+  { "SHT_MIPS_RFDESC", SHT_MIPS_RFDESC, 0 },
+  { "SHT_MIPS_PACKAGE", SHT_MIPS_PACKAGE, 0 },
+  { "SHT_MIPS_SHDR", SHT_MIPS_SHDR, 0 },
+  { "SHT_MIPS_WHIRL", SHT_MIPS_WHIRL, 0 },
+  { "SHT_MIPS_MSYM", SHT_MIPS_MSYM, 0 },
+  { "SHT_MIPS_EH_REGION", SHT_MIPS_EH_REGION, 0 },
+};
+static struct name _na_SHT_X86_64_[] = {
+  { "SHT_X86_64_UNWIND", SHT_X86_64_UNWIND, 0 },
+};
+static struct name _na_STB_[] = {
+  { "STB_HIPROC", STB_HIPROC, 0 },
+  { "STB_WEAK", STB_WEAK, 0 },
+  { "STB_HIOS", STB_HIOS, 0 },
+  { "STB_LOOS", STB_LOOS, STB_HIOS - STB_LOOS },
+  { "STB_GNU_UNIQUE", STB_GNU_UNIQUE, 0 },
+  { "STB_GLOBAL", STB_GLOBAL, 0 },
+  { "STB_NUM", STB_NUM, 0 },
+  { "STB_LOPROC", STB_LOPROC, STB_HIPROC - STB_LOPROC },
+  { "STB_LOCAL", STB_LOCAL, 0 },
+};
+static struct name _na_STB_MIPS_[] = {
+  { "STB_MIPS_SPLIT_COMMON", STB_MIPS_SPLIT_COMMON, 0 },
+};
+static struct name _na_STN_[] = {
+  { "STN_UNDEF", STN_UNDEF, 0 },
+};
+static struct name _na_STT_[] = {
+  { "STT_OBJECT", STT_OBJECT, 0 },
+  { "STT_SECTION", STT_SECTION, 0 },
+  { "STT_HIOS", STT_HIOS, 0 },
+  { "STT_NOTYPE", STT_NOTYPE, 0 },
+  { "STT_TLS", STT_TLS, 0 },
+  { "STT_LOOS", STT_LOOS, STT_HIOS - STT_LOOS },
+  { "STT_COMMON", STT_COMMON, 0 },
+  { "STT_FILE", STT_FILE, 0 },
+  { "STT_LOPROC", STT_LOPROC, STT_HIPROC - STT_LOPROC },
+  { "STT_GNU_IFUNC", STT_GNU_IFUNC, 0 },
+  { "STT_HIPROC", STT_HIPROC, 0 },
+  { "STT_FUNC", STT_FUNC, 0 },
+  { "STT_NUM", STT_NUM, 0 },
+};
+static struct name _na_STT_ARM_[] = {
+  { "STT_ARM_16BIT", STT_ARM_16BIT, 0 },
+  { "STT_ARM_TFUNC", STT_ARM_TFUNC, 0 },
+};
+static struct name _na_STT_HP_[] = {
+  { "STT_HP_STUB", STT_HP_STUB, 0 },
+  { "STT_HP_OPAQUE", STT_HP_OPAQUE, 0 },
+  { "STT_PARISC_MILLICODE", STT_PARISC_MILLICODE, 0 },
+};
+static struct name _na_STT_SPARC_[] = {
+  { "STT_SPARC_REGISTER", STT_SPARC_REGISTER, 0 },
+};
+static struct name _na_STV_[] = {
+  { "STV_HIDDEN", STV_HIDDEN, 0 },
+  { "STV_DEFAULT", STV_DEFAULT, 0 },
+  { "STV_INTERNAL", STV_INTERNAL, 0 },
+  { "STV_PROTECTED", STV_PROTECTED, 0 },
+};
+static struct name _na_SYMINFO_BT_[] = {
+  { "SYMINFO_BT_LOWRESERVE", SYMINFO_BT_LOWRESERVE, 0 },
+  { "SYMINFO_BT_SELF", SYMINFO_BT_SELF, 0 },
+  { "SYMINFO_BT_PARENT", SYMINFO_BT_PARENT, 0 },
+};
+static struct name _na_SYMINFO_FLG_[] = {
+  { "SYMINFO_FLG_COPY", SYMINFO_FLG_COPY, 0 },
+  { "SYMINFO_FLG_PASSTHRU", SYMINFO_FLG_PASSTHRU, 0 },
+  { "SYMINFO_FLG_LAZYLOAD", SYMINFO_FLG_LAZYLOAD, 0 },
+  { "SYMINFO_FLG_DIRECT", SYMINFO_FLG_DIRECT, 0 },
+};
+static struct name _na_VER_DEF_[] = {
+  { "VER_DEF_CURRENT", VER_DEF_CURRENT, 0 },
+  { "VER_DEF_NONE", VER_DEF_NONE, 0 },
+  { "VER_DEF_NUM", VER_DEF_NUM, 0 },
+};
+static struct name _na_VER_FLG_[] = {
+  { "VER_FLG_BASE", VER_FLG_BASE, 0 },
+  { "VER_FLG_WEAK", VER_FLG_WEAK, 0 },
+};
+static struct name _na_VER_NDX_[] = {
+  { "VER_NDX_GLOBAL", VER_NDX_GLOBAL, 0 },
+  { "VER_NDX_LORESERVE", VER_NDX_LORESERVE, 0 },
+  { "VER_NDX_ELIMINATE", VER_NDX_ELIMINATE, 0 },
+  { "VER_NDX_LOCAL", VER_NDX_LOCAL, 0 },
+};
+static struct name _na_VER_NEED_[] = {
+  { "VER_NEED_NUM", VER_NEED_NUM, 0 },
+  { "VER_NEED_NONE", VER_NEED_NONE, 0 },
+  { "VER_NEED_CURRENT", VER_NEED_CURRENT, 0 },
+};
+static struct nameset namesets[prefixcount][machineidcount] = {
+  {
+    { _na_AT_, sizeof _na_AT_ / sizeof *_na_AT_ },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+  },
+  {
+    { _na_DF_, sizeof _na_DF_ / sizeof *_na_DF_ },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+  },
+  {
+    { _na_DF_1_, sizeof _na_DF_1_ / sizeof *_na_DF_1_ },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+  },
+  {
+    { _na_DTF_, sizeof _na_DTF_ / sizeof *_na_DTF_ },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+  },
+  {
+    { _na_DT_, sizeof _na_DT_ / sizeof *_na_DT_ },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { _na_DT_ALPHA_, sizeof _na_DT_ALPHA_ / sizeof *_na_DT_ALPHA_ },
+    { NULL, 0 },
+    { NULL, 0 },
+    { _na_DT_IA_64_, sizeof _na_DT_IA_64_ / sizeof *_na_DT_IA_64_ },
+    { _na_DT_MIPS_, sizeof _na_DT_MIPS_ / sizeof *_na_DT_MIPS_ },
+    { _na_DT_PPC_, sizeof _na_DT_PPC_ / sizeof *_na_DT_PPC_ },
+    { _na_DT_PPC64_, sizeof _na_DT_PPC64_ / sizeof *_na_DT_PPC64_ },
+    { NULL, 0 },
+    { _na_DT_SPARC_, sizeof _na_DT_SPARC_ / sizeof *_na_DT_SPARC_ },
+    { NULL, 0 },
+  },
+  {
+    { _na_EF_, sizeof _na_EF_ / sizeof *_na_EF_ },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { _na_EF_ALPHA_, sizeof _na_EF_ALPHA_ / sizeof *_na_EF_ALPHA_ },
+    { _na_EF_ARM_, sizeof _na_EF_ARM_ / sizeof *_na_EF_ARM_ },
+    { _na_EF_HP_, sizeof _na_EF_HP_ / sizeof *_na_EF_HP_ },
+    { _na_EF_IA_64_, sizeof _na_EF_IA_64_ / sizeof *_na_EF_IA_64_ },
+    { _na_EF_MIPS_, sizeof _na_EF_MIPS_ / sizeof *_na_EF_MIPS_ },
+    { _na_EF_PPC_, sizeof _na_EF_PPC_ / sizeof *_na_EF_PPC_ },
+    { _na_EF_PPC64_, sizeof _na_EF_PPC64_ / sizeof *_na_EF_PPC64_ },
+    { _na_EF_SH_, sizeof _na_EF_SH_ / sizeof *_na_EF_SH_ },
+    { _na_EF_SPARC_, sizeof _na_EF_SPARC_ / sizeof *_na_EF_SPARC_ },
+    { NULL, 0 },
+  },
+  {
+    { _na_ELFCLASS, sizeof _na_ELFCLASS / sizeof *_na_ELFCLASS },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+  },
+  {
+    { _na_ELFDATA, sizeof _na_ELFDATA / sizeof *_na_ELFDATA },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+  },
+  {
+    { _na_ELFMAG, sizeof _na_ELFMAG / sizeof *_na_ELFMAG },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+  },
+  {
+    { _na_ELFOSABI_, sizeof _na_ELFOSABI_ / sizeof *_na_ELFOSABI_ },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { _na_ELFOSABI_ARM_, sizeof _na_ELFOSABI_ARM_ / sizeof *_na_ELFOSABI_ARM_ },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+  },
+  {
+    { _na_ELF_NOTE_OS_, sizeof _na_ELF_NOTE_OS_ / sizeof *_na_ELF_NOTE_OS_ },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+  },
+  {
+    { _na_EM_, sizeof _na_EM_ / sizeof *_na_EM_ },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+  },
+  {
+    { _na_ET_, sizeof _na_ET_ / sizeof *_na_ET_ },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+  },
+  {
+    { _na_EV_, sizeof _na_EV_ / sizeof *_na_EV_ },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+  },
+  {
+    { _na_NT_, sizeof _na_NT_ / sizeof *_na_NT_ },
+    { _na_NT_386_, sizeof _na_NT_386_ / sizeof *_na_NT_386_ },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { _na_NT_ARM_, sizeof _na_NT_ARM_ / sizeof *_na_NT_ARM_ },
+    { NULL, 0 },
+    { NULL, 0 },
+    { _na_NT_MIPS_, sizeof _na_NT_MIPS_ / sizeof *_na_NT_MIPS_ },
+    { _na_NT_PPC_, sizeof _na_NT_PPC_ / sizeof *_na_NT_PPC_ },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+  },
+  {
+    { _na_NT_GNU_, sizeof _na_NT_GNU_ / sizeof *_na_NT_GNU_ },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+  },
+  {
+    { _na_PF_, sizeof _na_PF_ / sizeof *_na_PF_ },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { _na_PF_ARM_, sizeof _na_PF_ARM_ / sizeof *_na_PF_ARM_ },
+    { _na_PF_HP_, sizeof _na_PF_HP_ / sizeof *_na_PF_HP_ },
+    { _na_PF_IA_64_, sizeof _na_PF_IA_64_ / sizeof *_na_PF_IA_64_ },
+    { _na_PF_MIPS_, sizeof _na_PF_MIPS_ / sizeof *_na_PF_MIPS_ },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+  },
+  {
+    { _na_PT_, sizeof _na_PT_ / sizeof *_na_PT_ },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { _na_PT_ARM_, sizeof _na_PT_ARM_ / sizeof *_na_PT_ARM_ },
+    { _na_PT_HP_, sizeof _na_PT_HP_ / sizeof *_na_PT_HP_ },
+    { _na_PT_IA_64_, sizeof _na_PT_IA_64_ / sizeof *_na_PT_IA_64_ },
+    { _na_PT_MIPS_, sizeof _na_PT_MIPS_ / sizeof *_na_PT_MIPS_ },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+  },
+  {
+    { _na_R_, sizeof _na_R_ / sizeof *_na_R_ },
+    { _na_R_386_, sizeof _na_R_386_ / sizeof *_na_R_386_ },
+    { _na_R_390_, sizeof _na_R_390_ / sizeof *_na_R_390_ },
+    { _na_R_68K_, sizeof _na_R_68K_ / sizeof *_na_R_68K_ },
+    { _na_R_ALPHA_, sizeof _na_R_ALPHA_ / sizeof *_na_R_ALPHA_ },
+    { _na_R_ARM_, sizeof _na_R_ARM_ / sizeof *_na_R_ARM_ },
+    { _na_R_HP_, sizeof _na_R_HP_ / sizeof *_na_R_HP_ },
+    { _na_R_IA_64_, sizeof _na_R_IA_64_ / sizeof *_na_R_IA_64_ },
+    { _na_R_MIPS_, sizeof _na_R_MIPS_ / sizeof *_na_R_MIPS_ },
+    { _na_R_PPC_, sizeof _na_R_PPC_ / sizeof *_na_R_PPC_ },
+    { _na_R_PPC64_, sizeof _na_R_PPC64_ / sizeof *_na_R_PPC64_ },
+    { _na_R_SH_, sizeof _na_R_SH_ / sizeof *_na_R_SH_ },
+    { _na_R_SPARC_, sizeof _na_R_SPARC_ / sizeof *_na_R_SPARC_ },
+    { _na_R_X86_64_, sizeof _na_R_X86_64_ / sizeof *_na_R_X86_64_ },
+  },
+  {
+    { _na_SHF_, sizeof _na_SHF_ / sizeof *_na_SHF_ },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { _na_SHF_ALPHA_, sizeof _na_SHF_ALPHA_ / sizeof *_na_SHF_ALPHA_ },
+    { _na_SHF_ARM_, sizeof _na_SHF_ARM_ / sizeof *_na_SHF_ARM_ },
+    { _na_SHF_HP_, sizeof _na_SHF_HP_ / sizeof *_na_SHF_HP_ },
+    { _na_SHF_IA_64_, sizeof _na_SHF_IA_64_ / sizeof *_na_SHF_IA_64_ },
+    { _na_SHF_MIPS_, sizeof _na_SHF_MIPS_ / sizeof *_na_SHF_MIPS_ },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+  },
+  {
+    { _na_SHN_, sizeof _na_SHN_ / sizeof *_na_SHN_ },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { _na_SHN_HP_, sizeof _na_SHN_HP_ / sizeof *_na_SHN_HP_ },
+    { NULL, 0 },
+    { _na_SHN_MIPS_, sizeof _na_SHN_MIPS_ / sizeof *_na_SHN_MIPS_ },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+  },
+  {
+    { _na_SHT_, sizeof _na_SHT_ / sizeof *_na_SHT_ },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { _na_SHT_ALPHA_, sizeof _na_SHT_ALPHA_ / sizeof *_na_SHT_ALPHA_ },
+    { _na_SHT_ARM_, sizeof _na_SHT_ARM_ / sizeof *_na_SHT_ARM_ },
+    { _na_SHT_HP_, sizeof _na_SHT_HP_ / sizeof *_na_SHT_HP_ },
+    { _na_SHT_IA_64_, sizeof _na_SHT_IA_64_ / sizeof *_na_SHT_IA_64_ },
+    { _na_SHT_MIPS_, sizeof _na_SHT_MIPS_ / sizeof *_na_SHT_MIPS_ },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { _na_SHT_X86_64_, sizeof _na_SHT_X86_64_ / sizeof *_na_SHT_X86_64_ },
+  },
+  {
+    { _na_STB_, sizeof _na_STB_ / sizeof *_na_STB_ },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { _na_STB_MIPS_, sizeof _na_STB_MIPS_ / sizeof *_na_STB_MIPS_ },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+  },
+  {
+    { _na_STN_, sizeof _na_STN_ / sizeof *_na_STN_ },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+  },
+  {
+    { _na_STT_, sizeof _na_STT_ / sizeof *_na_STT_ },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { _na_STT_ARM_, sizeof _na_STT_ARM_ / sizeof *_na_STT_ARM_ },
+    { _na_STT_HP_, sizeof _na_STT_HP_ / sizeof *_na_STT_HP_ },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { _na_STT_SPARC_, sizeof _na_STT_SPARC_ / sizeof *_na_STT_SPARC_ },
+    { NULL, 0 },
+  },
+  {
+    { _na_STV_, sizeof _na_STV_ / sizeof *_na_STV_ },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+  },
+  {
+    { _na_SYMINFO_BT_, sizeof _na_SYMINFO_BT_ / sizeof *_na_SYMINFO_BT_ },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+  },
+  {
+    { _na_SYMINFO_FLG_, sizeof _na_SYMINFO_FLG_ / sizeof *_na_SYMINFO_FLG_ },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+  },
+  {
+    { _na_VER_DEF_, sizeof _na_VER_DEF_ / sizeof *_na_VER_DEF_ },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+  },
+  {
+    { _na_VER_FLG_, sizeof _na_VER_FLG_ / sizeof *_na_VER_FLG_ },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+  },
+  {
+    { _na_VER_NDX_, sizeof _na_VER_NDX_ / sizeof *_na_VER_NDX_ },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+  },
+  {
+    { _na_VER_NEED_, sizeof _na_VER_NEED_ / sizeof *_na_VER_NEED_ },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+  },
+};
@@ -3,13 +3,20 @@
  * This is free software; you are free to change and redistribute it.
  * There is NO WARRANTY, to the extent permitted by law.
  */
+#define _GNU_SOURCE
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
 #include <stdarg.h>
 #include <errno.h>
+#include <limits.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <fcntl.h>
 #include <getopt.h>
+#include <sys/uio.h>
+#include <sys/sendfile.h>
 #include <elf.h>
 #include "elfrw.h"
 
@@ -17,7 +24,7 @@
  * objres produces an object file with the following layout:
  *
  * 1. An ELF header.
- * 2. A section header table with four entries: one for each section
+ * 2. A section header table, with one entry for each section
  *    following this one.
  * 3. A symbol table with two entries for each binary object (one
  *    local symbol for the source file name and one global symbol for
@@ -25,9 +32,59 @@
  * 4. A string table accompanying the symbol table.
  * 5. A string table accompanying the section header table.
  * 6. A .data section, containing all of the actual data.
+ * 7. A .bss section, present only when the data is compressed, which
+ *    holds a pointer to each object's decompressed contents.
+ * 8. A table of extended section indexes for the symbol table, present
+ *    only when there are too many sections to fit in a symbol entry.
  *
  * This layout is reflected in the ordering of the pieces array.
+ *
+ * Normally the .data section has a single section header entry. When
+ * separate sections are requested, each object in the .data section
+ * is instead given its own entry, named after the object, so that
+ * the linker can discard the ones that are never used. The section
+ * for the object's data is then used in place of the .data section
+ * everywhere.
+ *
+ * Each piece is first generated in memory, and then the entire file
+ * is written out at once, as a list of extents. The contents of the
+ * input files are not read into memory, but are copied directly from
+ * the input files.
+ *
+ * Large objects are page-aligned within the .data section, which then
+ * begins on a page boundary in the file. This allows their data to be
+ * copied from the input files by the kernel, which on filesystems
+ * that support it can simply share the input files' storage.
+ *
+ * When compression is requested, each object is instead read into
+ * memory and stored in a simple LZ77 format (the same as an LZ4
+ * block), under the symbol name with "_lz" appended. The header file
+ * then includes a small decompressor, and an accessor function for
+ * each object that decompresses it the first time it is called. The
+ * decompressed copy is kept in a pointer exported from the .bss
+ * section, so that it is shared by every part of the program.
+ *
+ * When the objects are read-only, input files with identical
+ * contents are only stored once. Each duplicate's symbol is simply
+ * made an alias of the first copy.
+ */
+
+/* The file alignment used for the .data section, and the size above
+ * which an object is page-aligned within it.
  */
+#define	PAGEALIGN	4096
+#define	LARGEOBJECT	65536
+
+/* The size of the compressor's hash table, the shortest match it
+ * will encode, and the furthest back a match can be found.
+ */
+#define	LZHASHBITS	14
+#define	LZMINMATCH	4
+#define	LZWINDOW	65535
+
+/* The size of the buffers used when comparing input files.
+ */
+#define	READBUFSIZE	65536
 
 /* The online help text.
  */
@@ -39,6 +96,9 @@ static char const *yowzitch =
     "  -m, --machine=[32|64]   Set the object file to be 32-bit or 64-bit.\n"
     "  -R, --reference=OBJFILE Use an existing object file as a template.\n"
     "  -r, --read-only         Make the exported objects const.\n"
+    "  -c, --compress          Compress the objects, and declare accessor\n"
+    "                          functions that decompress them on first use.\n"
+    "  -s, --sections          Put each object in a separate section.\n"
     "      --help              Display this help and exit.\n"
     "      --version           Display version information and exit.\n\n"
     "An input filename can be prefixed with an explicit name to use as the\n"
@@ -56,16 +116,90 @@ static char const *vourzhon =
     "This is free software; you are free to change and redistribute it.\n"
     "There is NO WARRANTY, to the extent permitted by law.\n";
 
+/* The decompressor that is included in the header file when the
+ * objects are compressed. It returns the object's contents in a
+ * newly allocated buffer, or NULL if memory cannot be allocated or if
+ * the data is corrupt.
+ */
+static char const *lzdecoder =
+    "#ifndef _objres_lzdecode_\n"
+    "#define _objres_lzdecode_\n\n"
+    "#include <stdlib.h>\n"
+    "#include <string.h>\n\n"
+    "static unsigned char *objres_lzdecode(unsigned char const *in,\n"
+    "                                      long insize, long outsize)\n"
+    "{\n"
+    "    unsigned char const *end = in + insize;\n"
+    "    unsigned char *out, *p;\n"
+    "    long lit, len, dist;\n"
+    "    int token;\n\n"
+    "    out = (unsigned char *)malloc(outsize ? outsize : 1);\n"
+    "    if (!out)\n"
+    "        return NULL;\n"
+    "    p = out;\n"
+    "    while (in < end) {\n"
+    "        token = *in++;\n"
+    "        lit = token >> 4;\n"
+    "        if (lit == 15) {\n"
+    "            do {\n"
+    "                if (in == end)\n"
+    "                    goto corrupt;\n"
+    "                lit += *in;\n"
+    "            } while (*in++ == 255);\n"
+    "        }\n"
+    "        if (lit > end - in || lit > out + outsize - p)\n"
+    "            goto corrupt;\n"
+    "        memcpy(p, in, lit);\n"
+    "        p += lit;\n"
+    "        in += lit;\n"
+    "        if (in == end)\n"
+    "            break;\n"
+    "        if (end - in < 2)\n"
+    "            goto corrupt;\n"
+    "        dist = in[0] | in[1] << 8;\n"
+    "        in += 2;\n"
+    "        if (dist == 0 || dist > p - out)\n"
+    "            goto corrupt;\n"
+    "        len = token & 15;\n"
+    "        if (len == 15) {\n"
+    "            do {\n"
+    "                if (in == end)\n"
+    "                    goto corrupt;\n"
+    "                len += *in;\n"
+    "            } while (*in++ == 255);\n"
+    "        }\n"
+    "        len += 4;\n"
+    "        if (len > out + outsize - p)\n"
+    "            goto corrupt;\n"
+    "        for ( ; len ; --len, ++p)\n"
+    "            *p = p[-dist];\n"
+    "    }\n"
+    "    if (p == out + outsize)\n"
+    "        return out;\n"
+    "  corrupt:\n"
+    "    free(out);\n"
+    "    return NULL;\n"
+    "}\n\n"
+    "#endif\n\n";
+
 /* Data about each binary object being added to the ELF object file.
  */
 struct object {
     char const *filename;		/* filename for the binary data */
     char const *objectname;		/* name of the variable to create */
+    char const *symbolname;		/* name of the symbol for the data */
+    char const *cachename;		/* name of the decompressed pointer */
     int		filenamestrpos;		/* filename position in .strtab */
-    int		objectnamestrpos;	/* objectname position in .strtab */
+    int		symbolnamestrpos;	/* symbolname position in .strtab */
+    int		cachenamestrpos;	/* cachename position in .strtab */
     long	offset;			/* offset of the object in .data */
     long	size;			/* size of the object */
+    long	fullsize;		/* size of the object uncompressed */
     void const *data;			/* the actual binary data */
+    int		alias;			/* identical earlier object, or -1 */
+    int		shndx;			/* index of the section holding it */
+    int		sectionnamestrpos;	/* its name's position in .shstrtab */
+    uint64_t	hash[2];		/* hash of the object's contents */
 };
 
 /* Data about each piece of the ELF object file to be created.
@@ -85,6 +219,16 @@ struct elfpiece {
     void      (*output)(void);		/* pointer to the output function */
 };
 
+/* A piece of the object file's contents: either a buffer in memory,
+ * or the contents of an input file.
+ */
+struct extent {
+    long	offset;			/* position in the object file */
+    long	size;			/* number of bytes */
+    void       *data;			/* the contents, or NULL */
+    char const *filename;		/* else the file to copy */
+};
+
 /*
  * Global variables.
  */
@@ -96,16 +240,24 @@ static FILE *destfile = NULL;		/* the currently-open output file */
 static Elf64_Ehdr refehdr;		/* a reference ELF header to output */
 static int output64;			/* true if building a 64-bit target */
 static int readonly = 0;		/* true if exporting const objects */
+static int compress = 0;		/* true if compressing the objects */
+static int sections = 0;		/* true if one section per object */
 
 /* The list of binary objects that will go into the object file's data.
  */
 static int objectcount = 0;
 static struct object *objects = NULL;
 
+/* The list of extents that make up the object file's contents.
+ */
+static int extentcount = 0;
+static int extentalloc = 0;
+static struct extent *extents = NULL;
+
 /* The list of pieces that will comprise the ELF object file.
  */
-static int const piececount = 6;
-static struct elfpiece pieces[6];
+static int const piececount = 8;
+static struct elfpiece pieces[8];
 
 /* Direct pointers to the individual pieces.
  */
@@ -115,6 +267,8 @@ static struct elfpiece *piece_symtab = &pieces[2];
 static struct elfpiece *piece_strtab = &pieces[3];
 static struct elfpiece *piece_shstrtab = &pieces[4];
 static struct elfpiece *piece_data = &pieces[5];
+static struct elfpiece *piece_bss = &pieces[6];
+static struct elfpiece *piece_xindex = &pieces[7];
 
 /*
  * General-purpose functions.
@@ -160,28 +314,229 @@ static void *reallocate(void *p, size_t size)
     return p;
 }
 
-/* Copy the contents of the given file to the current output file.
+/* Add an extent to the list of the object file's contents.
  */
-static void fcopy(char const *srcfilename)
+static void addextent(long offset, long size, void *data,
+		      char const *filename)
+{
+    if (extentcount == extentalloc) {
+	extentalloc = extentalloc ? 2 * extentalloc : 64;
+	extents = reallocate(extents, extentalloc * sizeof *extents);
+    }
+    extents[extentcount].offset = offset;
+    extents[extentcount].size = size;
+    extents[extentcount].data = data;
+    extents[extentcount].filename = filename;
+    ++extentcount;
+}
+
+/* Write an array of buffers to the output file at the given offset,
+ * continuing after partial writes.
+ */
+static void writeiov(int fd, struct iovec *iov, int count, off_t offset)
+{
+    ssize_t n;
+
+    while (count > 0) {
+	n = pwritev(fd, iov, count, offset);
+	if (n < 0)
+	    fail("%s: %s", outputfile, strerror(errno));
+	offset += n;
+	while (count > 0 && (size_t)n >= iov->iov_len) {
+	    n -= iov->iov_len;
+	    ++iov;
+	    --count;
+	}
+	if (count > 0) {
+	    iov->iov_base = (char*)iov->iov_base + n;
+	    iov->iov_len -= n;
+	}
+    }
+}
+
+/* Copy the next size bytes of an input file into the output file at
+ * destpos, through a buffer.
+ */
+static void fcopy(int srcfd, char const *srcfilename,
+		  int destfd, off_t destpos, long size)
 {
-    FILE *srcfile;
     char buf[BUFSIZ];
-    int n;
+    ssize_t n;
+
+    while (size > 0) {
+	n = read(srcfd, buf, size < BUFSIZ ? size : BUFSIZ);
+	if (n <= 0)
+	    fail("%s: %s", srcfilename,
+			   n ? strerror(errno) : "file changed size");
+	if (pwrite(destfd, buf, n, destpos) != n)
+	    fail("%s: %s", outputfile, strerror(errno));
+	destpos += n;
+	size -= n;
+    }
+}
+
+/* Copy the contents of the given file into the output file at
+ * destpos. The data is moved directly between the files by the
+ * kernel, if possible, via copy_file_range() or else sendfile(). If
+ * neither can be used with these files, the data is copied through a
+ * buffer instead.
+ */
+static void copyobject(char const *srcfilename, int destfd, off_t destpos,
+		       long size)
+{
+    off_t srcpos;
+    ssize_t n = 0;
+    int srcfd;
 
-    srcfile = fopen(srcfilename, "rb");
-    if (!srcfile)
+    srcfd = open(srcfilename, O_RDONLY);
+    if (srcfd < 0)
 	fail("%s: %s", srcfilename, strerror(errno));
-    for (;;) {
-	n = fread(buf, 1, sizeof buf, srcfile);
-	if (n == 0) {
-	    if (ferror(srcfile))
-		fail("%s: %s", srcfilename, strerror(errno));
+    srcpos = 0;
+
+    while (size > 0) {
+	n = copy_file_range(srcfd, &srcpos, destfd, &destpos, size, 0);
+	if (n <= 0)
 	    break;
+	size -= n;
+    }
+    if (size > 0 && n < 0 && lseek(destfd, destpos, SEEK_SET) >= 0) {
+	while (size > 0) {
+	    n = sendfile(destfd, srcfd, &srcpos, size);
+	    if (n <= 0)
+		break;
+	    size -= n;
+	    destpos += n;
 	}
-	if (fwrite(buf, n, 1, destfile) != 1)
-	    ferr();
     }
-    fclose(srcfile);
+    if (size > 0 && n == 0)
+	fail("%s: file changed size", srcfilename);
+    if (size > 0) {
+	if (lseek(srcfd, srcpos, SEEK_SET) < 0)
+	    fail("%s: %s", srcfilename, strerror(errno));
+	fcopy(srcfd, srcfilename, destfd, destpos, size);
+    }
+    close(srcfd);
+}
+
+/* Write out all of the extents in order. Consecutive buffers in
+ * memory, and the zero padding between them, are collected and
+ * written with a single system call. The extents that come from input
+ * files are copied separately.
+ */
+static void writeextents(int fd)
+{
+    static char const zeros[PAGEALIGN];
+    struct iovec iov[IOV_MAX];
+    long pos, start, gap;
+    int n, i;
+
+    pos = start = 0;
+    n = 0;
+    for (i = 0 ; i <= extentcount ; ++i) {
+	if (i == extentcount || !extents[i].data
+			     || n + 2 > IOV_MAX) {
+	    writeiov(fd, iov, n, start);
+	    n = 0;
+	    start = pos;
+	    if (i == extentcount)
+		break;
+	}
+	for ( ; pos < extents[i].offset ; pos += gap) {
+	    gap = extents[i].offset - pos;
+	    if (gap > PAGEALIGN)
+		gap = PAGEALIGN;
+	    if (n == IOV_MAX) {
+		writeiov(fd, iov, n, start);
+		n = 0;
+		start = pos;
+	    }
+	    iov[n].iov_base = (void*)zeros;
+	    iov[n].iov_len = gap;
+	    ++n;
+	}
+	if (extents[i].data) {
+	    iov[n].iov_base = extents[i].data;
+	    iov[n].iov_len = extents[i].size;
+	    ++n;
+	} else {
+	    writeiov(fd, iov, n, start);
+	    n = 0;
+	    copyobject(extents[i].filename, fd, pos, extents[i].size);
+	    start = pos + extents[i].size;
+	}
+	pos += extents[i].size;
+    }
+}
+
+/* Append one sequence to a compressed buffer: a run of literal bytes
+ * followed by a match of the given length and distance. A length of
+ * zero marks the final sequence, which has no match.
+ */
+static unsigned char *lzsequence(unsigned char *out,
+				 unsigned char const *lit, long litsize,
+				 long len, long dist)
+{
+    unsigned char *token;
+    long n;
+
+    token = out++;
+    *token = (litsize < 15 ? litsize : 15) << 4;
+    for (n = litsize - 15 ; n >= 0 ; n -= 255)
+	*out++ = n < 255 ? n : 255;
+    memcpy(out, lit, litsize);
+    out += litsize;
+    if (len) {
+	*out++ = dist & 0xFF;
+	*out++ = dist >> 8;
+	len -= LZMINMATCH;
+	*token |= len < 15 ? len : 15;
+	for (n = len - 15 ; n >= 0 ; n -= 255)
+	    *out++ = n < 255 ? n : 255;
+    }
+    return out;
+}
+
+/* Compress a buffer, returning the compressed data in a newly
+ * allocated buffer. Matches are found greedily, using a hash table
+ * of the four-byte sequences seen so far. As with LZ4, the final five
+ * bytes are always literals, and no match begins in the last twelve
+ * bytes. The search skips ahead faster the longer it goes without
+ * finding a match, so that incompressible data passes through
+ * quickly.
+ */
+static unsigned char *lzcompress(unsigned char const *in, long size,
+				 long *outsize)
+{
+    static long table[1 << LZHASHBITS];
+    unsigned char *out, *p;
+    unsigned int h;
+    long pos, ref, anchor, len;
+
+    out = allocate(size + size / 255 + 16);
+    p = out;
+    memset(table, 0xFF, sizeof table);
+    pos = anchor = 0;
+    while (pos < size - 12) {
+	h = (in[pos] | in[pos + 1] << 8 | in[pos + 2] << 16
+		     | (unsigned int)in[pos + 3] << 24) * 2654435761U;
+	h >>= 32 - LZHASHBITS;
+	ref = table[h];
+	table[h] = pos;
+	if (ref < 0 || pos - ref > LZWINDOW
+		    || memcmp(in + ref, in + pos, LZMINMATCH)) {
+	    pos += 1 + ((pos - anchor) >> 6);
+	    continue;
+	}
+	len = LZMINMATCH;
+	while (pos + len < size - 5 && in[ref + len] == in[pos + len])
+	    ++len;
+	p = lzsequence(p, in + anchor, pos - anchor, len, pos - ref);
+	pos += len;
+	anchor = pos;
+    }
+    p = lzsequence(p, in + anchor, size - anchor, 0, 0);
+    *outsize = p - out;
+    return out;
 }
 
 /*
@@ -249,7 +604,8 @@ static void outputehdr(void)
     ehdr.e_phentsize = 0;
     ehdr.e_phnum = 0;
     ehdr.e_shentsize = piece_shtab->entsize;
-    ehdr.e_shnum = piece_shtab->entcount;
+    ehdr.e_shnum = piece_shtab->entcount < SHN_LORESERVE ?
+					piece_shtab->entcount : 0;
     ehdr.e_shstrndx = piece_shstrtab->shndx;
     if (!elfrw_write_Ehdr(destfile, &ehdr))
 	ferr();
@@ -267,8 +623,13 @@ static void outputstrtab(void)
 	n = strlen(objects[i].filename) + 1;
 	if (fwrite(objects[i].filename, n, 1, destfile) != 1)
 	    ferr();
-	n = strlen(objects[i].objectname) + 1;
-	if (fwrite(objects[i].objectname, n, 1, destfile) != 1)
+	n = strlen(objects[i].symbolname) + 1;
+	if (fwrite(objects[i].symbolname, n, 1, destfile) != 1)
+	    ferr();
+	if (!objects[i].cachename)
+	    continue;
+	n = strlen(objects[i].cachename) + 1;
+	if (fwrite(objects[i].cachename, n, 1, destfile) != 1)
 	    ferr();
     }
 }
@@ -281,81 +642,113 @@ static void outputshstrtab(void)
 
     fputc(0, destfile);
     for (i = 0 ; i < piececount ; ++i) {
-	if (!pieces[i].name)
+	if (!pieces[i].shndx)
 	    continue;
 	n = strlen(pieces[i].name) + 1;
 	if (fwrite(pieces[i].name, n, 1, destfile) != 1)
 	    ferr();
     }
+    if (!sections)
+	return;
+    for (i = 0 ; i < objectcount ; ++i) {
+	if (objects[i].alias >= 0)
+	    continue;
+	fprintf(destfile, "%s.%s", piece_data->name, objects[i].symbolname);
+	fputc(0, destfile);
+    }
+    if (ferror(destfile))
+	ferr();
 }
 
 /* Output the object file's data section, containing the binary data
- * for each object.
+ * for each object. Nothing is actually written here; instead, each
+ * object other than an alias is added directly to the list of
+ * extents.
  */
 static void outputdata(void)
 {
-    long pos;
     int i;
 
-    pos = 0;
     for (i = 0 ; i < objectcount ; ++i) {
-	for ( ; pos < objects[i].offset ; ++pos)
-	    fputc(0, destfile);
-	if (objects[i].data) {
-	    if (fwrite(objects[i].data, objects[i].size, 1, destfile) != 1)
-		ferr();
-	    free((void*)objects[i].data);
-	    objects[i].data = NULL;
-	} else {
-	    fcopy(objects[i].filename);
-	}
-	pos += objects[i].size;
+	if (objects[i].alias >= 0)
+	    continue;
+	addextent(piece_data->offset + objects[i].offset, objects[i].size,
+		  (void*)objects[i].data, objects[i].filename);
+	objects[i].data = NULL;
     }
 }
 
 /* Output the object file's section header table, one entry for each
- * piece with a nonzero index.
+ * piece with a nonzero index, and one for each object that has its
+ * own section. If there are too many entries for the ELF header to
+ * record, the count is stored in the first entry instead.
  */
 static void outputshtab(void)
 {
     Elf64_Shdr shdr;
-    int n, i;
+    int n, i, j;
 
     memset(&shdr, 0, sizeof shdr);
+    if (piece_shtab->entcount >= SHN_LORESERVE)
+	shdr.sh_size = piece_shtab->entcount;
     if (!elfrw_write_Shdr(destfile, &shdr))
 	ferr();
-    for (n = 1 ; n <= piececount ; ++n) {
+    j = 0;
+    for (n = 1 ; n < piece_shtab->entcount ; ++n) {
 	for (i = 0 ; i < piececount ; ++i)
 	    if (pieces[i].shndx == n)
 		break;
-	if (i == piececount)
-	    continue;
-	shdr.sh_name = pieces[i].namestrpos;
-	shdr.sh_type = pieces[i].type;
-	if (pieces[i].type == SHT_PROGBITS)
+	if (i == piececount) {
+	    while (objects[j].alias >= 0 || objects[j].shndx != n)
+		++j;
+	    shdr.sh_name = objects[j].sectionnamestrpos;
+	    shdr.sh_type = piece_data->type;
+	    shdr.sh_offset = piece_data->offset + objects[j].offset;
+	    shdr.sh_size = objects[j].size;
+	    shdr.sh_link = 0;
+	    shdr.sh_info = 0;
+	    shdr.sh_addralign = piece_data->align;
+	    shdr.sh_entsize = 0;
+	} else {
+	    shdr.sh_name = pieces[i].namestrpos;
+	    shdr.sh_type = pieces[i].type;
+	    shdr.sh_offset = pieces[i].offset;
+	    shdr.sh_size = pieces[i].size;
+	    shdr.sh_link = pieces[i].link;
+	    shdr.sh_info = pieces[i].info;
+	    shdr.sh_addralign = pieces[i].align;
+	    shdr.sh_entsize = pieces[i].entsize;
+	}
+	if (shdr.sh_type == SHT_PROGBITS)
 	    shdr.sh_flags = readonly ? SHF_ALLOC : SHF_ALLOC | SHF_WRITE;
+	else if (shdr.sh_type == SHT_NOBITS)
+	    shdr.sh_flags = SHF_ALLOC | SHF_WRITE;
 	else
 	    shdr.sh_flags = 0;
 	shdr.sh_addr = 0;
-	shdr.sh_offset = pieces[i].offset;
-	shdr.sh_size = pieces[i].size;
-	shdr.sh_link = pieces[i].link;
-	shdr.sh_info = pieces[i].info;
-	shdr.sh_addralign = pieces[i].align;
-	shdr.sh_entsize = pieces[i].entsize;
 	if (!elfrw_write_Shdr(destfile, &shdr))
 	    ferr();
     }
 }
 
+/* Return the value to store in a symbol's st_shndx field. Indexes
+ * too large to fit are stored in the extended section index table.
+ */
+static int symshndx(int shndx)
+{
+    return shndx < SHN_LORESERVE ? shndx : SHN_XINDEX;
+}
+
 /* Output the object file's symbol table, containing one section
- * symbol, one file symbol for each input file, and one exported
- * symbol for each binary object.
+ * symbol (if there is a single .data section), one file symbol for
+ * each input file, and one exported symbol for each binary object.
+ * Compressed objects also export a symbol for their pointer in the
+ * .bss section.
  */
 static void outputsymtab(void)
 {
     Elf64_Sym sym;
-    int i;
+    int n, i;
 
     sym.st_name = 0;
     sym.st_info = 0;
@@ -365,11 +758,13 @@ static void outputsymtab(void)
     sym.st_size = 0;
     if (!elfrw_write_Sym(destfile, &sym))
 	ferr();
-    sym.st_info = ELF64_ST_INFO(STB_LOCAL, STT_SECTION);
-    sym.st_shndx = piece_data->shndx;
-    if (!elfrw_write_Sym(destfile, &sym))
-	ferr();
-    sym.st_shndx = SHN_UNDEF;
+    if (!sections) {
+	sym.st_info = ELF64_ST_INFO(STB_LOCAL, STT_SECTION);
+	sym.st_shndx = piece_data->shndx;
+	if (!elfrw_write_Sym(destfile, &sym))
+	    ferr();
+	sym.st_shndx = SHN_UNDEF;
+    }
     for (i = 0 ; i < objectcount ; ++i) {
 	sym.st_name = objects[i].filenamestrpos;
 	sym.st_info = ELF64_ST_INFO(STB_LOCAL, STT_FILE);
@@ -377,14 +772,53 @@ static void outputsymtab(void)
 	    ferr();
     }
     for (i = 0 ; i < objectcount ; ++i) {
-	sym.st_name = objects[i].objectnamestrpos;
+	sym.st_name = objects[i].symbolnamestrpos;
 	sym.st_info = ELF64_ST_INFO(STB_GLOBAL, STT_OBJECT);
-	sym.st_shndx = piece_data->shndx;
-	sym.st_value = objects[i].offset;
+	sym.st_shndx = symshndx(objects[i].shndx);
+	sym.st_value = sections ? 0 : objects[i].offset;
 	sym.st_size = objects[i].size;
 	if (!elfrw_write_Sym(destfile, &sym))
 	    ferr();
     }
+    if (!compress)
+	return;
+    for (i = 0 ; i < objectcount ; ++i) {
+	sym.st_name = objects[i].cachenamestrpos;
+	sym.st_info = ELF64_ST_INFO(STB_GLOBAL, STT_OBJECT);
+	sym.st_shndx = symshndx(piece_bss->shndx);
+	n = objects[i].alias >= 0 ? objects[i].alias : i;
+	sym.st_value = n * piece_bss->entsize;
+	sym.st_size = piece_bss->entsize;
+	if (!elfrw_write_Sym(destfile, &sym))
+	    ferr();
+    }
+}
+
+/* Output the extended section indexes for the symbol table, which
+ * are zero for all symbols whose index fit in the symbol table.
+ */
+static void outputxindex(void)
+{
+    Elf64_Word shndx;
+    int i;
+
+    if (!piece_xindex->shndx)
+	return;
+    shndx = 0;
+    for (i = 0 ; i < piece_symtab->info ; ++i)
+	if (!elfrw_write_Word(destfile, &shndx))
+	    ferr();
+    for (i = 0 ; i < objectcount ; ++i) {
+	shndx = objects[i].shndx < SHN_LORESERVE ? 0 : objects[i].shndx;
+	if (!elfrw_write_Word(destfile, &shndx))
+	    ferr();
+    }
+    if (!compress)
+	return;
+    shndx = piece_bss->shndx < SHN_LORESERVE ? 0 : piece_bss->shndx;
+    for (i = 0 ; i < objectcount ; ++i)
+	if (!elfrw_write_Word(destfile, &shndx))
+	    ferr();
 }
 
 /*
@@ -430,7 +864,6 @@ static void initpieces(void)
     piece_shstrtab->link = 0;
     piece_shstrtab->info = 0;
 
-    piece_data->shndx = 4;
     piece_data->type = SHT_PROGBITS;
     piece_data->name = readonly ? ".rodata" : ".data";
     piece_data->output = outputdata;
@@ -438,6 +871,21 @@ static void initpieces(void)
     piece_data->align = 32;
     piece_data->link = 0;
     piece_data->info = 0;
+
+    piece_bss->type = SHT_NOBITS;
+    piece_bss->name = ".bss";
+    piece_bss->output = NULL;
+    piece_bss->entsize = output64 ? sizeof(Elf64_Addr) : sizeof(Elf32_Addr);
+    piece_bss->align = piece_bss->entsize;
+    piece_bss->link = 0;
+    piece_bss->info = 0;
+
+    piece_xindex->type = SHT_SYMTAB_SHNDX;
+    piece_xindex->name = ".symtab_shndx";
+    piece_xindex->output = outputxindex;
+    piece_xindex->entsize = sizeof(Elf32_Word);
+    piece_xindex->align = sizeof(Elf32_Word);
+    piece_xindex->info = 0;
 }
 
 /* Determine the size of the input files. Seekable files are simply
@@ -479,56 +927,362 @@ static void measureobjects(void)
     }
 }
 
+/* Open an object's input file for reading, unless its contents are
+ * already in memory.
+ */
+static FILE *openobject(struct object const *obj)
+{
+    FILE *file;
+
+    if (obj->data)
+	return NULL;
+    file = fopen(obj->filename, "rb");
+    if (!file)
+	fail("%s: %s", obj->filename, strerror(errno));
+    return file;
+}
+
+/* Return the next size bytes of an object's contents, starting at
+ * pos, either directly from memory or else read into buf from the
+ * object's input file.
+ */
+static unsigned char const *readobject(struct object const *obj, FILE *file,
+				       long pos, unsigned char *buf, long size)
+{
+    if (obj->data)
+	return (unsigned char const*)obj->data + pos;
+    if (fread(buf, 1, size, file) != (size_t)size)
+	fail("%s: %s", obj->filename,
+		       ferror(file) ? strerror(errno) : "file changed size");
+    return buf;
+}
+
+/* Mix one 16-byte block into the hash state. Together with
+ * hashobject(), this is the 128-bit x64 variant of MurmurHash3.
+ */
+#define	ROTL64(x, n)	((x) << (n) | (x) >> (64 - (n)))
+
+static void hashblock(uint64_t h[2], unsigned char const *block, int final)
+{
+    uint64_t k1, k2;
+
+    memcpy(&k1, block, 8);
+    memcpy(&k2, block + 8, 8);
+    k1 *= 0x87C37B91114253D5ULL;
+    k1 = ROTL64(k1, 31);
+    k1 *= 0x4CF5AD432745937FULL;
+    h[0] ^= k1;
+    if (!final) {
+	h[0] = ROTL64(h[0], 27);
+	h[0] += h[1];
+	h[0] = h[0] * 5 + 0x52DCE729;
+    }
+    k2 *= 0x4CF5AD432745937FULL;
+    k2 = ROTL64(k2, 33);
+    k2 *= 0x87C37B91114253D5ULL;
+    h[1] ^= k2;
+    if (!final) {
+	h[1] = ROTL64(h[1], 31);
+	h[1] += h[0];
+	h[1] = h[1] * 5 + 0x38495AB5;
+    }
+}
+
+/* Scramble the bits of one half of the hash state.
+ */
+static uint64_t hashmix(uint64_t h)
+{
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDULL;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+/* Compute the 128-bit hash of an object's contents.
+ */
+static void hashobject(struct object *obj)
+{
+    static unsigned char buf[READBUFSIZE];
+    unsigned char tail[16];
+    unsigned char const *p;
+    FILE *file;
+    uint64_t h[2];
+    long pos, size, n;
+
+    file = openobject(obj);
+    h[0] = h[1] = 0;
+    for (pos = 0 ; pos < obj->size ; pos += size) {
+	size = obj->size - pos;
+	if (size > READBUFSIZE)
+	    size = READBUFSIZE;
+	p = readobject(obj, file, pos, buf, size);
+	for (n = 0 ; n + 16 <= size ; n += 16)
+	    hashblock(h, p + n, 0);
+	if (n < size) {
+	    memset(tail, 0, sizeof tail);
+	    memcpy(tail, p + n, size - n);
+	    hashblock(h, tail, 1);
+	}
+    }
+    if (file)
+	fclose(file);
+
+    h[0] ^= obj->size;
+    h[1] ^= obj->size;
+    h[0] += h[1];
+    h[1] += h[0];
+    h[0] = hashmix(h[0]);
+    h[1] = hashmix(h[1]);
+    h[0] += h[1];
+    h[1] += h[0];
+    obj->hash[0] = h[0];
+    obj->hash[1] = h[1];
+}
+
+/* Compare the contents of two objects of the same size, and return
+ * true if they are identical.
+ */
+static int sameobject(struct object const *obj1, struct object const *obj2)
+{
+    static unsigned char buf1[READBUFSIZE], buf2[READBUFSIZE];
+    unsigned char const *p1, *p2;
+    FILE *file1, *file2;
+    long pos, size;
+    int same;
+
+    file1 = openobject(obj1);
+    file2 = openobject(obj2);
+    same = 1;
+    for (pos = 0 ; same && pos < obj1->size ; pos += size) {
+	size = obj1->size - pos;
+	if (size > READBUFSIZE)
+	    size = READBUFSIZE;
+	p1 = readobject(obj1, file1, pos, buf1, size);
+	p2 = readobject(obj2, file2, pos, buf2, size);
+	same = !memcmp(p1, p2, size);
+    }
+    if (file1)
+	fclose(file1);
+    if (file2)
+	fclose(file2);
+    return same;
+}
+
+/* Compare two entries in an array of object indexes, ordering them
+ * by size, then by hash value, and finally by their position in the
+ * objects array.
+ */
+static int objectorder(void const *p1, void const *p2)
+{
+    int i1 = *(int const*)p1, i2 = *(int const*)p2;
+    struct object const *obj1 = &objects[i1], *obj2 = &objects[i2];
+
+    if (obj1->size != obj2->size)
+	return obj1->size < obj2->size ? -1 : 1;
+    if (obj1->hash[0] != obj2->hash[0])
+	return obj1->hash[0] < obj2->hash[0] ? -1 : 1;
+    if (obj1->hash[1] != obj2->hash[1])
+	return obj1->hash[1] < obj2->hash[1] ? -1 : 1;
+    return i1 - i2;
+}
+
+/* Find the objects whose contents are identical to an earlier
+ * object, and mark them as aliases of it. Only objects that have the
+ * same size as another object are hashed, and objects with the same
+ * hash are then compared directly.
+ */
+static void dedupobjects(void)
+{
+    struct object *obj, *dup;
+    int *order;
+    int i, j, k, n;
+
+    order = allocate(objectcount * sizeof *order);
+    for (i = 0 ; i < objectcount ; ++i) {
+	objects[i].hash[0] = objects[i].hash[1] = 0;
+	order[i] = i;
+    }
+    qsort(order, objectcount, sizeof *order, objectorder);
+    for (i = 0 ; i < objectcount ; i = j) {
+	for (j = i + 1 ; j < objectcount ; ++j)
+	    if (objects[order[j]].size != objects[order[i]].size)
+		break;
+	if (j - i > 1 && objects[order[i]].size > 0)
+	    for (k = i ; k < j ; ++k)
+		hashobject(&objects[order[k]]);
+    }
+    qsort(order, objectcount, sizeof *order, objectorder);
+
+    for (i = 0 ; i < objectcount ; i = j) {
+	obj = &objects[order[i]];
+	for (j = i + 1 ; j < objectcount ; ++j) {
+	    dup = &objects[order[j]];
+	    if (dup->size != obj->size || dup->hash[0] != obj->hash[0]
+				       || dup->hash[1] != obj->hash[1])
+		break;
+	}
+	for (k = i + 1 ; k < j ; ++k) {
+	    dup = &objects[order[k]];
+	    for (n = i ; n < k ; ++n) {
+		obj = &objects[order[n]];
+		if (obj->alias < 0 && sameobject(obj, dup)) {
+		    dup->alias = order[n];
+		    free((void*)dup->data);
+		    dup->data = NULL;
+		    break;
+		}
+	    }
+	}
+    }
+    free(order);
+}
+
+/* Read each input file into memory and replace its contents with
+ * the compressed form. The exported symbols are given new names, so
+ * that the compressed data cannot be mistaken for the original. An
+ * object that does not get smaller is stored as it is, which leaves
+ * its size the same as its full size.
+ */
+static void compressobjects(void)
+{
+    FILE *srcfile;
+    unsigned char *buf;
+    char *name;
+    long size;
+    int i, n;
+
+    for (i = 0 ; i < objectcount ; ++i) {
+	n = strlen(objects[i].objectname);
+	name = allocate(n + 4);
+	memcpy(name, objects[i].objectname, n);
+	memcpy(name + n, "_lz", 4);
+	objects[i].symbolname = name;
+	name = allocate(n + 7);
+	memcpy(name, objects[i].objectname, n);
+	memcpy(name + n, "_cache", 7);
+	objects[i].cachename = name;
+
+	size = objects[i].size;
+	objects[i].fullsize = size;
+	if (objects[i].alias >= 0) {
+	    objects[i].size = objects[objects[i].alias].size;
+	    continue;
+	}
+	buf = (unsigned char*)objects[i].data;
+	if (!buf) {
+	    buf = allocate(size ? size : 1);
+	    srcfile = fopen(objects[i].filename, "rb");
+	    if (!srcfile)
+		fail("%s: %s", objects[i].filename, strerror(errno));
+	    if (fread(buf, 1, size, srcfile) != (size_t)size)
+		fail("%s: %s", objects[i].filename,
+			       ferror(srcfile) ? strerror(errno)
+					       : "file changed size");
+	    fclose(srcfile);
+	}
+	objects[i].data = lzcompress(buf, size, &objects[i].size);
+	if (objects[i].size < size) {
+	    free(buf);
+	} else {
+	    free((void*)objects[i].data);
+	    objects[i].data = buf;
+	    objects[i].size = size;
+	}
+    }
+}
+
 /* Determine the size and position of each ELF section, and fill in
  * any remaining metadata values.
  */
 static void measurepieces(void)
 {
     long pos;
-    int i;
+    int shndx, pagealign, i;
 
     piece_ehdr->size = piece_ehdr->entsize;
 
-    piece_shtab->entcount = 1;
-    for (i = 0 ; i < piececount ; ++i) {
-	if (pieces[i].shndx > 0)
-	    ++piece_shtab->entcount;
+    shndx = piece_shstrtab->shndx + 1;
+    piece_data->shndx = sections ? 0 : shndx++;
+    for (i = 0 ; i < objectcount ; ++i) {
+	if (objects[i].alias >= 0)
+	    objects[i].shndx = objects[objects[i].alias].shndx;
+	else
+	    objects[i].shndx = sections ? shndx++ : piece_data->shndx;
     }
+    piece_bss->shndx = compress ? shndx++ : 0;
+    piece_xindex->shndx = shndx > SHN_LORESERVE ? shndx++ : 0;
+
+    piece_shtab->entcount = shndx;
     piece_shtab->size = piece_shtab->entcount * piece_shtab->entsize;
 
-    piece_symtab->entcount = 2 + 2 * objectcount;
+    piece_symtab->entcount = (sections ? 1 : 2)
+			   + (compress ? 3 : 2) * objectcount;
     piece_symtab->size = piece_symtab->entcount * piece_symtab->entsize;
-    piece_symtab->info = 2 + objectcount;
+    piece_symtab->info = (sections ? 1 : 2) + objectcount;
     piece_symtab->link = piece_strtab->shndx;
 
+    piece_xindex->entcount = piece_xindex->shndx ?
+					piece_symtab->entcount : 0;
+    piece_xindex->size = piece_xindex->entcount * piece_xindex->entsize;
+    piece_xindex->link = piece_symtab->shndx;
+
     piece_strtab->size = 1;
     for (i = 0 ; i < objectcount ; ++i) {
 	objects[i].filenamestrpos = piece_strtab->size;
 	piece_strtab->size += 1 + strlen(objects[i].filename);
-	objects[i].objectnamestrpos = piece_strtab->size;
-	piece_strtab->size += 1 + strlen(objects[i].objectname);
+	objects[i].symbolnamestrpos = piece_strtab->size;
+	piece_strtab->size += 1 + strlen(objects[i].symbolname);
+	if (objects[i].cachename) {
+	    objects[i].cachenamestrpos = piece_strtab->size;
+	    piece_strtab->size += 1 + strlen(objects[i].cachename);
+	}
     }
 
     piece_shstrtab->size = 1;
     for (i = 0 ; i < piececount ; ++i) {
-	if (pieces[i].name) {
+	if (pieces[i].shndx) {
 	    pieces[i].namestrpos = piece_shstrtab->size;
 	    piece_shstrtab->size += 1 + strlen(pieces[i].name);
 	}
     }
+    for (i = 0 ; sections && i < objectcount ; ++i) {
+	if (objects[i].alias < 0) {
+	    objects[i].sectionnamestrpos = piece_shstrtab->size;
+	    piece_shstrtab->size += 2 + strlen(piece_data->name)
+				      + strlen(objects[i].symbolname);
+	}
+    }
 
     piece_data->size = 0;
+    pagealign = 0;
     for (i = 0 ; i < objectcount ; ++i) {
-	piece_data->size = (piece_data->size + 31) & ~31;
+	if (objects[i].alias >= 0) {
+	    objects[i].offset = objects[objects[i].alias].offset;
+	    continue;
+	}
+	if (!objects[i].data && objects[i].size >= LARGEOBJECT) {
+	    piece_data->size = (piece_data->size + PAGEALIGN - 1)
+						& ~(PAGEALIGN - 1);
+	    pagealign = 1;
+	} else
+	    piece_data->size = (piece_data->size + 31) & ~31;
 	objects[i].offset = piece_data->size;
 	piece_data->size += objects[i].size;
     }
 
+    piece_bss->entcount = compress ? objectcount : 0;
+    piece_bss->size = piece_bss->entcount * piece_bss->entsize;
+
     pos = 0;
     for (i = 0 ; i < piececount ; ++i) {
 	pos = (pos + pieces[i].align - 1) & ~(pieces[i].align - 1);
+	if (&pieces[i] == piece_data && pagealign)
+	    pos = (pos + PAGEALIGN - 1) & ~(PAGEALIGN - 1);
 	pieces[i].offset = pos;
-	pos += pieces[i].size;
+	if (pieces[i].type != SHT_NOBITS)
+	    pos += pieces[i].size;
     }
 }
 
@@ -536,32 +1290,49 @@ static void measurepieces(void)
  * Top-level output functions.
  */
 
-/* Create the object file by calling each section's output function.
+/* Create the object file by calling each section's output function,
+ * each of which writes its piece into a memory buffer, and then
+ * writing out all of the pieces together.
  */
 static void outputelf(void)
 {
-    long pos;
-    int i;
-
-    destfile = fopen(outputfile, "wb");
-    if (!destfile)
-	ferr();
+    char *buf;
+    size_t size;
+    int fd, i;
 
-    pos = 0;
     for (i = 0 ; i < piececount ; ++i) {
-	for ( ; pos < pieces[i].offset ; ++pos)
-	    fputc(0, destfile);
+	if (!pieces[i].output)
+	    continue;
+	buf = NULL;
+	destfile = open_memstream(&buf, &size);
+	if (!destfile)
+	    fail(strerror(errno));
 	pieces[i].output();
-	pos += pieces[i].size;
+	if (fclose(destfile))
+	    ferr();
+	destfile = NULL;
+	if (size)
+	    addextent(pieces[i].offset, size, buf, NULL);
+	else
+	    free(buf);
     }
 
-    if (fclose(destfile))
-	ferr();
-    destfile = NULL;
+    fd = open(outputfile, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if (fd < 0)
+	fail("%s: %s", outputfile, strerror(errno));
+    writeextents(fd);
+    if (close(fd))
+	fail("%s: %s", outputfile, strerror(errno));
+
+    for (i = 0 ; i < extentcount ; ++i)
+	free(extents[i].data);
+    extentcount = 0;
 }
 
 /* Output a C header file that declares each object as an array of
- * unsigned char.
+ * unsigned char. Compressed objects are instead declared with their
+ * uncompressed size, and an inline function that returns their
+ * contents, decompressing them when first called.
  */
 static void outputheader(void)
 {
@@ -584,10 +1355,56 @@ static void outputheader(void)
     ppsymbol[i + 2] = '\0';
 
     fprintf(file, "#ifndef %s\n#define %s\n\n", ppsymbol, ppsymbol);
-    for (i = 0 ; i < objectcount ; ++i)
-	fprintf(file, "extern unsigned char %s%s[%ld];\n",
-		      (readonly ? "const " : ""),
-		      objects[i].objectname, objects[i].size);
+    if (compress) {
+	for (i = 0 ; i < objectcount ; ++i)
+	    if (objects[i].size < objects[i].fullsize)
+		break;
+	if (i < objectcount)
+	    fputs(lzdecoder, file);
+    }
+
+    /* The compressed arrays are only used through the accessors, so
+     * their sizes are left out, which keeps an empty one legal.
+     */
+    for (i = 0 ; i < objectcount ; ++i) {
+	if (compress)
+	    fprintf(file, "extern unsigned char const %s[];\n",
+			  objects[i].symbolname);
+	else
+	    fprintf(file, "extern unsigned char %s%s[%ld];\n",
+			  (readonly ? "const " : ""),
+			  objects[i].symbolname, objects[i].size);
+    }
+    if (compress) {
+	for (i = 0 ; i < objectcount ; ++i)
+	    fprintf(file, "extern unsigned char *%s;\n",
+			  objects[i].cachename);
+	fputc('\n', file);
+	for (i = 0 ; i < objectcount ; ++i)
+	    fprintf(file, "#define %s_size %ldL\n",
+			  objects[i].objectname, objects[i].fullsize);
+	for (i = 0 ; i < objectcount ; ++i) {
+	    if (objects[i].size == objects[i].fullsize) {
+		fprintf(file, "\nstatic inline unsigned char const *"
+			      "%s_data(void)\n{\n"
+			      "    return %s;\n"
+			      "}\n",
+			      objects[i].objectname, objects[i].symbolname);
+		continue;
+	    }
+	    fprintf(file, "\nstatic inline unsigned char const *"
+			  "%s_data(void)\n{\n"
+			  "    if (!%s)\n"
+			  "        %s = objres_lzdecode(%s, %ldL,"
+			  " %s_size);\n"
+			  "    return %s;\n"
+			  "}\n",
+			  objects[i].objectname, objects[i].cachename,
+			  objects[i].cachename, objects[i].symbolname,
+			  objects[i].size, objects[i].objectname,
+			  objects[i].cachename);
+	}
+    }
     fprintf(file, "\n#endif\n");
 
     if (fclose(file))
@@ -638,13 +1455,15 @@ static void pickfilenames(void)
  */
 static void readcmdline(int argc, char *argv[])
 {
-    static char const *optstring = "h:m:o:rR:";
+    static char const *optstring = "ch:m:o:rR:s";
     static struct option options[] = {
 	{ "header", required_argument, NULL, 'h' },
 	{ "output", required_argument, NULL, 'o' },
 	{ "machine", required_argument, NULL, 'm' },
 	{ "reference", required_argument, NULL, 'R' },
 	{ "read-only", no_argument, NULL, 'r' },
+	{ "compress", no_argument, NULL, 'c' },
+	{ "sections", no_argument, NULL, 's' },
 	{ "help", no_argument, NULL, 'H' },
 	{ "version", no_argument, NULL, 'V' },
 	{ 0, 0, 0, 0 }
@@ -684,6 +1503,13 @@ static void readcmdline(int argc, char *argv[])
 	  case 'r':
 	    readonly = 1;
 	    break;
+	  case 'c':
+	    compress = 1;
+	    readonly = 1;
+	    break;
+	  case 's':
+	    sections = 1;
+	    break;
 	  case 'H':
 	    fputs(yowzitch, stdout);
 	    exit(EXIT_SUCCESS);
@@ -737,6 +1563,9 @@ static void readcmdline(int argc, char *argv[])
 		if (!isalnum(*p))
 		    *p = '_';
 	}
+	objects[i].symbolname = objects[i].objectname;
+	objects[i].cachename = NULL;
+	objects[i].alias = -1;
     }
 }
 
@@ -746,6 +1575,10 @@ int main(int argc, char *argv[])
 {
     readcmdline(argc, argv);
     measureobjects();
+    if (readonly)
+	dedupobjects();
+    if (compress)
+	compressobjects();
 
     initpieces();
     measurepieces();
@@ -5,10 +5,17 @@
  */
 #include <stdio.h>
 #include <stdlib.h>
+#include <stddef.h>
 #include <string.h>
+#include <ctype.h>
 #include <errno.h>
 #include <unistd.h>
 #include <getopt.h>
+#include <fcntl.h>
+#include <ar.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
 #include <elf.h>
 #include "elfrw.h"
 
@@ -26,18 +33,36 @@
  */
 static char const *yowzitch =
     "Usage: rebind [OPTIONS] FILE [SYMBOL...]\n"
-    "Change the binding/visibility of symbols in an ELF object file.\n\n"
+    "   or: rebind [OPTIONS] -f SYMFILE FILE...\n"
+    "   or: rebind [OPTIONS] -a [-e EXTFILE]... FILE...\n"
+    "   or: rebind -s [OPTIONS] FILE...\n"
+    "Change the binding/visibility of symbols in an ELF object file.\n"
+    "FILE can also be a static library, in which case every object\n"
+    "file in the library is changed.\n\n"
     "  -b, --binding=BIND    Change symbol binding to BIND.\n"
     "  -v, --visibility=VIS  Change symbol visibility to VIS.\n"
     "  -w, --weaken          Short for \"--binding=weak\".\n"
     "  -h, --hide            Short for \"--visibility=hidden\".\n"
+    "  -f, --symbols=SYMFILE Read the symbol names from SYMFILE.\n"
+    "  -j, --jobs=N          Modify up to N files at once.\n"
+    "  -g, --glob            Treat symbol names as wildcard patterns.\n"
+    "  -u, --unexport        Remove hidden symbols from a shared\n"
+    "                          library's dynamic symbol table.\n"
+    "  -a, --advise          Find the symbols only used within FILEs.\n"
+    "  -e, --external=EXTFILE  Symbols in EXTFILE are used elsewhere.\n"
+    "  -s, --stats           Show symbol statistics without changing\n"
+    "                          anything.\n"
     "  -i, --verbose         Describe which symbols are changed.\n"
     "      --help            Display this help and exit.\n"
     "      --version         Display version information and exit.\n\n"
     "BIND can be either \"global\" or \"weak\".\n"
     "VIS can be \"hidden\", \"internal\", \"protected\", or \"default\".\n"
     "If no symbol names are given on the command line, the program\n"
-    "reads the symbol names from standard input.\n";
+    "reads the symbol names from standard input. With --symbols, all\n"
+    "of the arguments are object files, and the same symbols are\n"
+    "changed in each one. With --advise, the symbols are those that\n"
+    "the FILEs define which are not needed outside of them; if no\n"
+    "changes are requested, their names are listed instead.\n";
 
 /* The version text.
  */
@@ -53,22 +78,125 @@ static unsigned char	chgvisibility;	/* true if visibility is changing */
 static unsigned char	tobind;		/* the binding to change to */
 static unsigned char	tovisibility;	/* the visibility to change to */
 static int		verbose;	/* whether to tell the user */
+static int		jobcount;	/* the number of worker processes */
+static int		useglobs;	/* true if names can be patterns */
+static int		unexport;	/* true if removing hidden symbols */
+static int		statsonly;	/* true if only counting symbols */
+static char const      *symbolfile;	/* the file listing symbol names */
+static int		advise;		/* true if finding unneeded symbols */
+static char const     **externals;	/* files that use the symbols */
+static int		externalcount;	/* the number of files in externals */
+static int	      (*theaction)(void); /* the function applied to files */
+static int		readonly;	/* true if files are only read */
+
+static char	      **filelist;	/* the list of files to modify */
+static int		filecount;	/* the number of files in filelist */
 
 static char	      **namelist;	/* the list of symbol names to seek */
 static int		namecount;	/* the number of symbols in namelist */
+static int		namelistsize;	/* the allocated size of namelist */
+
+static char const     **nameset;	/* hash table of namelist's strings */
+static unsigned long	namesetmask;	/* the hash table's size minus one */
+static unsigned char   *namefound;	/* which names have been seen */
+
+/* A wildcard pattern is compiled into a sequence of elements, each of
+ * which either matches one character from a set, or matches any
+ * number of characters. All of the patterns are stored end to end in
+ * a single array, each one terminated by an element marking a match.
+ */
+enum { GLOB_CHARS, GLOB_STAR, GLOB_END };
+typedef struct globelem {
+    unsigned char	type;		/* one of the GLOB_* values */
+    unsigned char	chars[32];	/* bitmap of characters matched */
+} globelem;
+
+static globelem	       *globelems;	/* the compiled patterns */
+static int		globelemcount;	/* the number of elements */
+static int		globcount;	/* the number of patterns */
+
+/* The patterns are matched all at once by a deterministic automaton,
+ * each state of which corresponds to a set of positions in the
+ * compiled patterns. The states are created as needed while matching,
+ * and if too many are created, they are all thrown away and the
+ * process starts over.
+ */
+#define	MAXDFASTATES	4096
+#define	SETBITS		(8 * sizeof(unsigned long))
+
+static int	       *dfanext;	/* transitions, 256 for each state */
+static unsigned long   *dfasets;	/* the position set of each state */
+static signed char     *dfaaccept;	/* 1 if a match, -1 if a dead end */
+static int		dfacount;	/* the number of states */
+static int		dfaallocated;	/* the number of states allocated */
+static int		dfastartstate;	/* the initial state, or -1 */
+static int		dfahash[2 * MAXDFASTATES]; /* states by position set */
+static int		setwords;	/* the size of a position set */
+static unsigned long   *startset;	/* the initial position set */
+static unsigned long   *scratchset;	/* a position set being built */
 
 static char const      *theprogram;	/* the name of this executable */
 static char const      *thefilename;	/* the current file name */
 static FILE	       *thefile;	/* the current file handle */
+static unsigned char   *theimage;	/* the current archive member */
+static unsigned long	theimagesize;	/* the size of the archive member */
 
 static Elf64_Ehdr	ehdr;		/* the file's ELF header */
 
-/* Standard qsort/bsearch string comparison function.
+/* The flags recorded for each symbol name found when looking for
+ * symbols to hide.
  */
-static int qstrcmp(void const *a, void const *b)
-{
-    return strcmp(*(char const**)a, *(char const**)b);
-}
+#define	SYM_DEFINED	0x01	/* defined in one of the files */
+#define	SYM_EXPORTED	0x02	/* defined with a visibility to change */
+#define	SYM_REFERENCED	0x04	/* referred to by one of the files */
+#define	SYM_EXTERNAL	0x08	/* needed by something else */
+
+typedef struct symnode {
+    char const	       *name;		/* the symbol's name */
+    unsigned int	flags;		/* the SYM_* flags for the name */
+} symnode;
+
+static symnode	       *symgraph;	/* hash table of all symbol names */
+static unsigned long	symgraphmask;	/* the hash table's size minus one */
+static unsigned long	symgraphcount;	/* the number of names in the table */
+static int		collectexternal; /* true if reading external files */
+
+/* A run of consecutive entries in a symbol table.
+ */
+typedef struct symrange {
+    int		from;		/* the index of the first entry */
+    int		to;		/* the index following the last entry */
+} symrange;
+
+static symrange	       *dirty;		/* the runs of altered symbols */
+static int		dirtycount;	/* the number of runs in dirty */
+
+/* The symbol counts displayed by --stats. All the fields are
+ * unsigned longs, so that they can be summed as an array.
+ */
+typedef struct symstats {
+    unsigned long	exported;	/* default or protected definitions */
+    unsigned long	weak;		/* weak definitions */
+    unsigned long	undefined;	/* references to other objects */
+    unsigned long	visibility[4];	/* definitions by visibility */
+    unsigned long	matched;	/* symbols that were selected */
+    unsigned long	changed;	/* symbols that would be altered */
+} symstats;
+
+#define	STATSFIELDS	(sizeof(symstats) / sizeof(unsigned long))
+
+static symstats		filestats;	/* the counts for the current file */
+static symstats	       *totalstats;	/* the counts for all the files */
+
+/* The progress of the workers through the file list. When running
+ * more than one worker, this lives in memory shared between them.
+ */
+typedef struct progress {
+    int		next;		/* the index of the next file to modify */
+    int		done;		/* the number of files modified */
+    int		failed;		/* the number of files that failed */
+    symstats	total;		/* the symbol counts, for --stats */
+} progress;
 
 /* An error-handling function. The given error message is used only
  * when errno is not set.
@@ -90,29 +218,341 @@ static int badcmdline(char const *errmsg)
     exit(EXIT_FAILURE);
 }
 
-/* namelistfromfile() builds an array of all the non-whitespace strings
- * in the given file.
+/* namelistfromfile() adds to namelist all the non-whitespace strings
+ * in the given file. The entire file is read into a single buffer,
+ * and the strings are terminated in place, so that the array just
+ * points into the buffer.
  */
 static int namelistfromfile(FILE *fp)
 {
-    char	word[256];
-    int		allocated = 0;
-    int		n;
+    char       *namearena = NULL;
+    char       *p;
+    size_t	allocated = 0;
+    size_t	size = 0;
+    size_t	n;
+
+    for (;;) {
+	if (size + 1 >= allocated) {
+	    allocated = allocated ? allocated * 2 : 65536;
+	    alloc(namearena, allocated);
+	}
+	n = fread(namearena + size, 1, allocated - size - 1, fp);
+	if (!n)
+	    break;
+	size += n;
+    }
+    if (ferror(fp)) {
+	fprintf(stderr, "%s: %s\n", theprogram, strerror(errno));
+	return FALSE;
+    }
+    namearena[size] = '\0';
 
-    while (fscanf(fp, "%255s", word) > 0) {
-	if (namecount >= allocated) {
-	    allocated = allocated ? allocated * 2 : 16;
-	    alloc(namelist, allocated * sizeof *namelist);
+    p = namearena;
+    for (;;) {
+	while (isspace((unsigned char)*p))
+	    ++p;
+	if (!*p)
+	    break;
+	if (namecount >= namelistsize) {
+	    namelistsize = namelistsize ? namelistsize * 2 : 1024;
+	    alloc(namelist, namelistsize * sizeof *namelist);
 	}
-	namelist[namecount] = NULL;
-	n = strlen(word) + 1;
-	alloc(namelist[namecount], n);
-	memcpy(namelist[namecount], word, n);
-	++namecount;
+	namelist[namecount++] = p;
+	while (*p && !isspace((unsigned char)*p))
+	    ++p;
+	if (*p)
+	    *p++ = '\0';
     }
     return TRUE;
 }
 
+/* namehash() returns the FNV-1a hash of a string.
+ */
+static unsigned long namehash(char const *str)
+{
+    unsigned long h = 2166136261UL;
+
+    for ( ; *str ; ++str)
+	h = ((h ^ (unsigned char)*str) * 16777619UL) & 0xFFFFFFFFUL;
+    return h;
+}
+
+/* buildnameset() creates an open-addressing hash table containing the
+ * strings in namelist. The table is kept no more than half full, so
+ * that a lookup only needs to examine a few entries on average.
+ */
+static void addglob(char const *pattern);
+
+static void buildnameset(void)
+{
+    unsigned long size, h;
+    int i;
+
+    for (size = 16 ; size < 2 * (unsigned long)namecount ; size *= 2) ;
+    nameset = NULL;
+    alloc(nameset, size * sizeof *nameset);
+    memset(nameset, 0, size * sizeof *nameset);
+    namesetmask = size - 1;
+    for (i = 0 ; i < namecount ; ++i) {
+	if (useglobs && strpbrk(namelist[i], "*?[\\")) {
+	    addglob(namelist[i]);
+	    continue;
+	}
+	for (h = namehash(namelist[i]) & namesetmask ; nameset[h] ;
+						h = (h + 1) & namesetmask)
+	    if (!strcmp(nameset[h], namelist[i]))
+		break;
+	nameset[h] = namelist[i];
+    }
+}
+
+/* innameset() returns TRUE if the given string appears in namelist.
+ * The name is also marked as found, if this is being tracked.
+ */
+static int innameset(char const *name)
+{
+    unsigned long h;
+
+    for (h = namehash(name) & namesetmask ; nameset[h] ;
+					     h = (h + 1) & namesetmask) {
+	if (!strcmp(nameset[h], name)) {
+	    if (namefound)
+		namefound[h] = TRUE;
+	    return TRUE;
+	}
+    }
+    return FALSE;
+}
+
+/* addposition() adds a position in the compiled patterns to a set.
+ * Since a wildcard can match zero characters, the position following
+ * a wildcard is always added along with it.
+ */
+static void addposition(unsigned long *set, int pos)
+{
+    for (;;) {
+	set[pos / SETBITS] |= 1UL << (pos % SETBITS);
+	if (globelems[pos].type != GLOB_STAR)
+	    break;
+	++pos;
+    }
+}
+
+/* newglobelem() appends an element to the compiled patterns.
+ */
+static globelem *newglobelem(int type)
+{
+    static int allocated = 0;
+    globelem *elem;
+
+    if (globelemcount >= allocated) {
+	allocated = allocated ? allocated * 2 : 64;
+	alloc(globelems, allocated * sizeof *globelems);
+    }
+    elem = globelems + globelemcount++;
+    elem->type = type;
+    memset(elem->chars, 0, sizeof elem->chars);
+    return elem;
+}
+
+/* addglob() compiles a wildcard pattern and appends it to globelems.
+ * A "*" matches any sequence of characters, a "?" matches any single
+ * character, and a bracket expression matches any one of the
+ * characters listed inside, which can include ranges, and which is
+ * negated if it begins with "!" or "^". A backslash causes the
+ * following character to be taken literally.
+ */
+static void addglob(char const *pattern)
+{
+    unsigned char const *p = (unsigned char const*)pattern;
+    unsigned char const *q;
+    globelem *elem;
+    int start, negate, from, to, c;
+
+    start = globelemcount;
+    while (*p) {
+	if (*p == '*') {
+	    if (globelemcount == start
+			|| globelems[globelemcount - 1].type != GLOB_STAR)
+		newglobelem(GLOB_STAR);
+	    ++p;
+	    continue;
+	}
+	elem = newglobelem(GLOB_CHARS);
+	if (*p == '?') {
+	    memset(elem->chars, 0xFF, sizeof elem->chars);
+	    ++p;
+	    continue;
+	}
+	if (*p == '[') {
+	    q = p + 1;
+	    negate = *q == '!' || *q == '^';
+	    if (negate)
+		++q;
+	    if (*q == ']')
+		++q;
+	    while (*q && *q != ']')
+		++q;
+	    if (*q) {
+		q = p + 1 + negate;
+		do {
+		    from = to = *q++;
+		    if (*q == '-' && q[1] && q[1] != ']') {
+			to = q[1];
+			q += 2;
+		    }
+		    for (c = from ; c <= to ; ++c)
+			elem->chars[c / 8] |= 1 << (c % 8);
+		} while (*q != ']');
+		if (negate)
+		    for (c = 0 ; c < 32 ; ++c)
+			elem->chars[c] = ~elem->chars[c];
+		p = q + 1;
+		continue;
+	    }
+	}
+	if (*p == '\\' && p[1])
+	    ++p;
+	elem->chars[*p / 8] |= 1 << (*p % 8);
+	++p;
+    }
+    newglobelem(GLOB_END);
+    ++globcount;
+}
+
+/* flushdfa() discards all of the automaton's states.
+ */
+static void flushdfa(void)
+{
+    memset(dfahash, -1, sizeof dfahash);
+    dfacount = 0;
+    dfastartstate = -1;
+}
+
+/* dfastate() returns the automaton state for the given position set,
+ * creating it if necessary. If the states have to be flushed in order
+ * to make room, *flushed is set to TRUE.
+ */
+static int dfastate(unsigned long const *set, int *flushed)
+{
+    unsigned long hash, h;
+    int empty, n, i;
+
+    hash = 2166136261UL;
+    for (i = 0 ; i < setwords ; ++i)
+	hash = ((hash ^ set[i]) * 16777619UL) & 0xFFFFFFFFUL;
+    for (;;) {
+	for (h = hash % (2 * MAXDFASTATES) ; dfahash[h] >= 0 ;
+					     h = (h + 1) % (2 * MAXDFASTATES))
+	    if (!memcmp(dfasets + dfahash[h] * setwords, set,
+			setwords * sizeof *set))
+		return dfahash[h];
+	if (dfacount < MAXDFASTATES)
+	    break;
+	flushdfa();
+	*flushed = TRUE;
+    }
+
+    if (dfacount >= dfaallocated) {
+	dfaallocated = dfaallocated ? dfaallocated * 2 : 64;
+	alloc(dfanext, dfaallocated * 256 * sizeof *dfanext);
+	alloc(dfasets, dfaallocated * setwords * sizeof *dfasets);
+	alloc(dfaaccept, dfaallocated * sizeof *dfaaccept);
+    }
+    n = dfacount++;
+    dfahash[h] = n;
+    memcpy(dfasets + n * setwords, set, setwords * sizeof *set);
+    for (i = 0 ; i < 256 ; ++i)
+	dfanext[n * 256 + i] = -1;
+    dfaaccept[n] = 0;
+    empty = TRUE;
+    for (i = 0 ; i < globelemcount ; ++i) {
+	if (set[i / SETBITS] & (1UL << (i % SETBITS))) {
+	    empty = FALSE;
+	    if (globelems[i].type == GLOB_END) {
+		dfaaccept[n] = 1;
+		break;
+	    }
+	}
+    }
+    if (empty)
+	dfaaccept[n] = -1;
+    return n;
+}
+
+/* dfastep() computes the state that follows the given state on the
+ * given character, and records it in the transition table.
+ */
+static int dfastep(int state, int ch)
+{
+    unsigned long const *set;
+    globelem const *elem;
+    int flushed = FALSE;
+    int next, i;
+
+    set = dfasets + state * setwords;
+    memset(scratchset, 0, setwords * sizeof *scratchset);
+    for (i = 0 ; i < globelemcount ; ++i) {
+	if (!(set[i / SETBITS] & (1UL << (i % SETBITS))))
+	    continue;
+	elem = globelems + i;
+	if (elem->type == GLOB_STAR)
+	    addposition(scratchset, i);
+	else if (elem->type == GLOB_CHARS
+			&& (elem->chars[ch / 8] & (1 << (ch % 8))))
+	    addposition(scratchset, i + 1);
+    }
+    next = dfastate(scratchset, &flushed);
+    if (!flushed)
+	dfanext[state * 256 + ch] = next;
+    return next;
+}
+
+/* buildglobs() prepares the automaton for matching the patterns that
+ * were compiled by addglob().
+ */
+static void buildglobs(void)
+{
+    int i;
+
+    if (!globcount)
+	return;
+    setwords = (globelemcount + SETBITS - 1) / SETBITS;
+    startset = NULL;
+    scratchset = NULL;
+    alloc(startset, setwords * sizeof *startset);
+    alloc(scratchset, setwords * sizeof *scratchset);
+    memset(startset, 0, setwords * sizeof *startset);
+    addposition(startset, 0);
+    for (i = 1 ; i < globelemcount ; ++i)
+	if (globelems[i - 1].type == GLOB_END)
+	    addposition(startset, i);
+    flushdfa();
+}
+
+/* inglobs() returns TRUE if the given string matches any of the
+ * patterns. Each character of the string is examined only once.
+ */
+static int inglobs(char const *name)
+{
+    unsigned char const *p;
+    int flushed, state, next;
+
+    if (!globcount)
+	return FALSE;
+    if (dfastartstate < 0) {
+	flushed = FALSE;
+	dfastartstate = dfastate(startset, &flushed);
+    }
+    state = dfastartstate;
+    for (p = (unsigned char const*)name ; *p ; ++p) {
+	next = dfanext[state * 256 + *p];
+	state = next >= 0 ? next : dfastep(state, *p);
+	if (dfaaccept[state] < 0)
+	    return FALSE;
+    }
+    return dfaaccept[state] > 0;
+}
 
 /* readheader() checks to make sure that this is in fact a proper ELF
  * object file that we're proposing to munge.
@@ -134,23 +574,51 @@ static int readheader(void)
     return TRUE;
 }
 
+/* markdirty() records that a symbol table entry has been altered and
+ * needs to be written back out. Since the entries are visited in
+ * order, an entry that immediately follows the last run is simply
+ * added to it.
+ */
+static void markdirty(int index)
+{
+    static int allocated = 0;
+
+    if (dirtycount && dirty[dirtycount - 1].to == index) {
+	++dirty[dirtycount - 1].to;
+	return;
+    }
+    if (dirtycount >= allocated) {
+	allocated = allocated ? allocated * 2 : 64;
+	alloc(dirty, allocated * sizeof *dirty);
+    }
+    dirty[dirtycount].from = index;
+    dirty[dirtycount].to = index + 1;
+    ++dirtycount;
+}
+
 /* changesymbols() finds all symbols in a given symbol table that
  * appear in the namelist and alters their binding and/or visibility.
  * Note that the program will refuse to change the binding of local
- * symbols, as that can easily render a symbol table invalid.
+ * symbols, as that can easily render a symbol table invalid. The
+ * entries that actually changed are recorded in dirty.
  */
 static int changesymbols(Elf64_Sym *symtab, char const *strtab, int count)
 {
     Elf64_Sym  *sym;
     char const *name;
+    unsigned char info, other;
     int		touched;
     int		i;
 
     touched = FALSE;
+    dirtycount = 0;
     for (i = 0, sym = symtab ; i < count ; ++i, ++sym) {
 	name = strtab + sym->st_name;
-	if (!bsearch(&name, namelist, namecount, sizeof *namelist, qstrcmp))
+	if (!innameset(name) && !inglobs(name))
 	    continue;
+	++filestats.matched;
+	info = sym->st_info;
+	other = sym->st_other;
 	if (chgbind) {
 	    if (ELF64_ST_BIND(sym->st_info) == STB_LOCAL) {
 		fprintf(stderr, "warning: cannot rebind local symbol \"%s\"\n",
@@ -161,20 +629,547 @@ static int changesymbols(Elf64_Sym *symtab, char const *strtab, int count)
 	}
 	if (chgvisibility)
 	    sym->st_other = ELF64_ST_VISIBILITY(tovisibility);
-	if (verbose)
+	if (sym->st_info != info || sym->st_other != other) {
+	    markdirty(i);
+	    ++filestats.changed;
+	}
+	if (verbose && !statsonly)
 	    printf("%s: \"%s\" altered.\n", thefilename, name);
 	touched = TRUE;
     }
     return touched;
 }
 
+/* writesymbols() stores the altered entries of a symbol table back in
+ * the object file. Only the runs of entries listed in dirty are
+ * written. When the object file is an archive member, only the
+ * st_info and st_other fields are copied, directly into the mapped
+ * archive, since these are single bytes and are the only fields that
+ * are ever changed.
+ */
+static int writesymbols(unsigned long offset, unsigned long entsize,
+			Elf64_Sym const *symtab, int count)
+{
+    unsigned char *p;
+    int i, j, n;
+
+    if (!theimage) {
+	for (i = 0 ; i < dirtycount ; ++i) {
+	    n = dirty[i].to - dirty[i].from;
+	    if (fseek(thefile, offset + dirty[i].from * entsize, SEEK_SET) ||
+			elfrw_write_Syms(thefile, symtab + dirty[i].from, n)
+								!= n)
+		return err("unable to write to the object file");
+	}
+	return TRUE;
+    }
+
+    if (offset + count * entsize > theimagesize)
+	return err("invalid symbol table");
+    n = entsize == sizeof(Elf32_Sym) ? offsetof(Elf32_Sym, st_info)
+				     : offsetof(Elf64_Sym, st_info);
+    for (i = 0 ; i < dirtycount ; ++i) {
+	for (j = dirty[i].from ; j < dirty[i].to ; ++j) {
+	    p = theimage + offset + j * entsize + n;
+	    p[0] = symtab[j].st_info;
+	    p[1] = symtab[j].st_other;
+	}
+    }
+    return TRUE;
+}
+
+/* The ways in which unexportsymbols() handles each dynamic symbol.
+ */
+enum { SYM_KEEP, SYM_UNHASH, SYM_DROP };
+
+/* gnuhash() returns the hash value used in the GNU hash table.
+ */
+static Elf64_Word gnuhash(char const *str)
+{
+    Elf64_Word h = 5381;
+
+    for ( ; *str ; ++str)
+	h = h * 33 + (unsigned char)*str;
+    return h;
+}
+
+/* elfhash() returns the hash value used in the standard hash table.
+ */
+static Elf64_Word elfhash(char const *str)
+{
+    Elf64_Word h = 0, g;
+
+    for ( ; *str ; ++str) {
+	h = (h << 4) + (unsigned char)*str;
+	g = h & 0xF0000000;
+	if (g)
+	    h ^= g >> 24;
+	h &= ~g;
+    }
+    return h;
+}
+
+/* writezeros() clears part of the file.
+ */
+static int writezeros(unsigned long offset, unsigned long size)
+{
+    static char const zeros[4096];
+    unsigned long     n;
+
+    if (fseek(thefile, offset, SEEK_SET))
+	return FALSE;
+    for ( ; size ; size -= n) {
+	n = size < sizeof zeros ? size : sizeof zeros;
+	if (fwrite(zeros, n, 1, thefile) != 1)
+	    return FALSE;
+    }
+    return TRUE;
+}
+
+/* updaterelocs() visits every entry in a relocation section that
+ * refers to the dynamic symbol table, which has symcount entries. If
+ * newindex is NULL, every symbol that is referred to is marked in
+ * used. Otherwise, the symbol indexes are changed to their new values
+ * and the section is written back out.
+ */
+static int updaterelocs(Elf64_Shdr const *sh, int symcount,
+			unsigned char *used, int const *newindex)
+{
+    Elf64_Rel *rels = NULL;
+    Elf64_Rela *relas = NULL;
+    Elf64_Xword *info;
+    int count, size, i, ok;
+
+    if (sh->sh_type == SHT_RELA) {
+	size = sizeof(Elf64_Rela);
+	count = sh->sh_size / (ehdr.e_ident[EI_CLASS] == ELFCLASS64 ?
+				sizeof(Elf64_Rela) : sizeof(Elf32_Rela));
+	alloc(relas, count * size);
+	ok = !fseek(thefile, sh->sh_offset, SEEK_SET) &&
+		elfrw_read_Relas(thefile, relas, count) == count;
+	info = &relas->r_info;
+    } else {
+	size = sizeof(Elf64_Rel);
+	count = sh->sh_size / (ehdr.e_ident[EI_CLASS] == ELFCLASS64 ?
+				sizeof(Elf64_Rel) : sizeof(Elf32_Rel));
+	alloc(rels, count * size);
+	ok = !fseek(thefile, sh->sh_offset, SEEK_SET) &&
+		elfrw_read_Rels(thefile, rels, count) == count;
+	info = &rels->r_info;
+    }
+    if (!ok) {
+	free(rels);
+	free(relas);
+	return err("invalid relocation section");
+    }
+
+    for (i = 0 ; i < count ; ++i) {
+	if (ELF64_R_SYM(*info) >= (Elf64_Xword)symcount) {
+	    ok = FALSE;
+	    break;
+	}
+	if (newindex)
+	    *info = ELF64_R_INFO(newindex[ELF64_R_SYM(*info)],
+				 ELF64_R_TYPE(*info));
+	else
+	    used[ELF64_R_SYM(*info)] = TRUE;
+	info = (Elf64_Xword*)((char*)info + size);
+    }
+    if (!ok) {
+	free(rels);
+	free(relas);
+	return err("invalid relocation section");
+    }
+
+    if (newindex) {
+	if (fseek(thefile, sh->sh_offset, SEEK_SET))
+	    ok = FALSE;
+	else if (relas)
+	    ok = elfrw_write_Relas(thefile, relas, count) == count;
+	else
+	    ok = elfrw_write_Rels(thefile, rels, count) == count;
+    }
+    free(rels);
+    free(relas);
+    return ok ? TRUE : err("unable to write to the object file");
+}
+
+/* writegnuhash() rebuilds a GNU hash table for the given symbols. The
+ * symbols starting at symoffset must already be sorted by bucket. The
+ * number of buckets and the size of the Bloom filter are unchanged,
+ * so the new table is never larger than the old one.
+ */
+static int writegnuhash(Elf64_Shdr const *sh, Elf64_Sym const *syms,
+			int count, int symoffset, char const *strtab)
+{
+    Elf64_Word hdr[4], *buckets = NULL, *chains = NULL, h;
+    Elf64_Addr *bloom = NULL;
+    unsigned long size;
+    int bits, nbuckets, maskwords, b, i;
+
+    if (fseek(thefile, sh->sh_offset, SEEK_SET))
+	return err("invalid GNU hash table");
+    for (i = 0 ; i < 4 ; ++i)
+	if (elfrw_read_Word(thefile, hdr + i) != 1)
+	    return err("invalid GNU hash table");
+    bits = ehdr.e_ident[EI_CLASS] == ELFCLASS64 ? 64 : 32;
+    nbuckets = hdr[0];
+    maskwords = hdr[2];
+    size = 16 + maskwords * (bits / 8) + (nbuckets + count - symoffset) * 4;
+    if (!nbuckets || !maskwords || (maskwords & (maskwords - 1))
+		  || size > sh->sh_size)
+	return err("GNU hash table cannot be rebuilt");
+
+    alloc(bloom, maskwords * sizeof *bloom);
+    alloc(buckets, nbuckets * sizeof *buckets);
+    alloc(chains, (count - symoffset + 1) * sizeof *chains);
+    memset(bloom, 0, maskwords * sizeof *bloom);
+    memset(buckets, 0, nbuckets * sizeof *buckets);
+    for (i = symoffset ; i < count ; ++i) {
+	h = gnuhash(strtab + syms[i].st_name);
+	bloom[(h / bits) & (maskwords - 1)] |=
+			((Elf64_Addr)1 << (h % bits))
+				| ((Elf64_Addr)1 << ((h >> hdr[3]) % bits));
+	b = h % nbuckets;
+	if (!buckets[b])
+	    buckets[b] = i;
+	else
+	    chains[i - symoffset - 1] &= ~1;
+	chains[i - symoffset] = h | 1;
+    }
+
+    hdr[1] = symoffset;
+    size = 16 + maskwords * (bits / 8) + (nbuckets + count - symoffset) * 4;
+    if (fseek(thefile, sh->sh_offset, SEEK_SET)) {
+	free(bloom);
+	free(buckets);
+	free(chains);
+	return err("unable to write to the object file");
+    }
+    for (i = 0 ; i < 4 ; ++i)
+	elfrw_write_Word(thefile, hdr + i);
+    for (i = 0 ; i < maskwords ; ++i)
+	elfrw_write_Addr(thefile, bloom + i);
+    for (i = 0 ; i < nbuckets ; ++i)
+	elfrw_write_Word(thefile, buckets + i);
+    for (i = 0 ; i < count - symoffset ; ++i)
+	elfrw_write_Word(thefile, chains + i);
+    free(bloom);
+    free(buckets);
+    free(chains);
+    if (ferror(thefile) || !writezeros(sh->sh_offset + size,
+				       sh->sh_size - size))
+	return err("unable to write to the object file");
+    return TRUE;
+}
+
+/* writeelfhash() rebuilds a standard hash table for the given
+ * symbols, leaving out any that are not to be exported. The number of
+ * buckets is unchanged, and the chain array shrinks to match the
+ * symbol table.
+ */
+static int writeelfhash(Elf64_Shdr *sh, Elf64_Sym const *syms, int count,
+			unsigned char const *state, char const *strtab)
+{
+    Elf64_Word hdr[2], *table = NULL;
+    unsigned long size;
+    int nbuckets, b, i;
+
+    if (sh->sh_entsize != 4 || fseek(thefile, sh->sh_offset, SEEK_SET)
+			    || elfrw_read_Word(thefile, hdr) != 1)
+	return err("invalid hash table");
+    nbuckets = hdr[0];
+    hdr[1] = count;
+    size = (2 + nbuckets + count) * 4;
+    if (!nbuckets || size > sh->sh_size)
+	return err("hash table cannot be rebuilt");
+
+    alloc(table, (nbuckets + count) * sizeof *table);
+    memset(table, 0, (nbuckets + count) * sizeof *table);
+    for (i = 1 ; i < count ; ++i) {
+	if (state[i] != SYM_KEEP)
+	    continue;
+	b = elfhash(strtab + syms[i].st_name) % nbuckets;
+	table[nbuckets + i] = table[b];
+	table[b] = i;
+    }
+
+    if (fseek(thefile, sh->sh_offset, SEEK_SET)) {
+	free(table);
+	return err("unable to write to the object file");
+    }
+    elfrw_write_Word(thefile, hdr);
+    elfrw_write_Word(thefile, hdr + 1);
+    for (i = 0 ; i < nbuckets + count ; ++i)
+	elfrw_write_Word(thefile, table + i);
+    free(table);
+    if (ferror(thefile) || !writezeros(sh->sh_offset + size,
+				       sh->sh_size - size))
+	return err("unable to write to the object file");
+    sh->sh_size = size;
+    return TRUE;
+}
+
+/* unexportsymbols() removes the defined symbols with hidden or
+ * internal visibility from a shared library's dynamic symbol table.
+ * Since such symbols cannot be used from outside the library, they
+ * do not need to be in the table at all, unless a relocation refers
+ * to them. Those that are referred to are kept, but moved out of the
+ * hash tables, so that the dynamic linker never sees them when
+ * looking up symbols (and binds the relocations locally). The
+ * sections cannot be moved, so the tables are compacted in place,
+ * and all of the sections that contain symbol indexes are updated to
+ * match: the hash tables, the symbol version table, and the dynamic
+ * relocations.
+ */
+static int unexportsymbols(Elf64_Shdr *shdrs, int dynsym)
+{
+    Elf64_Shdr *sh = shdrs + dynsym;
+    Elf64_Sym *syms = NULL, *newsyms = NULL;
+    Elf64_Versym *versyms = NULL, *newversyms = NULL;
+    Elf64_Word symoffset, nbuckets, *buckets = NULL;
+    unsigned char *used = NULL, *state = NULL, *newstate = NULL;
+    int *newindex = NULL, *order = NULL, *bucketstart = NULL;
+    char *strtab = NULL;
+    int gnuhashsec = 0, hashsec = 0, versymsec = 0;
+    int count, newcount, newsymoffset, dropped;
+    int vis, ok, i, n;
+
+    if (ehdr.e_machine == EM_MIPS)
+	return err("cannot unexport symbols from MIPS objects");
+    for (i = 1 ; i < ehdr.e_shnum ; ++i) {
+	if (shdrs[i].sh_link != (Elf64_Word)dynsym)
+	    continue;
+	if (shdrs[i].sh_type == SHT_GNU_HASH)
+	    gnuhashsec = i;
+	else if (shdrs[i].sh_type == SHT_HASH)
+	    hashsec = i;
+	else if (shdrs[i].sh_type == SHT_GNU_versym)
+	    versymsec = i;
+	else if (shdrs[i].sh_type == SHT_SUNW_syminfo
+			|| shdrs[i].sh_type == SHT_SYMTAB_SHNDX)
+	    return err("cannot unexport symbols from this object");
+    }
+    if (!gnuhashsec && !hashsec)
+	return err("no dynamic hash table.");
+
+    count = sh->sh_size / sh->sh_entsize;
+    n = shdrs[sh->sh_link].sh_size;
+    alloc(syms, count * sizeof *syms);
+    alloc(strtab, n + 1);
+    if (fseek(thefile, sh->sh_offset, SEEK_SET) ||
+			elfrw_read_Syms(thefile, syms, count) != count)
+	return err("invalid symbol table");
+    if (fseek(thefile, shdrs[sh->sh_link].sh_offset, SEEK_SET) ||
+			fread(strtab, n, 1, thefile) != 1)
+	return err("invalid associated string table");
+    strtab[n] = '\0';
+    for (i = 0 ; i < count ; ++i)
+	if (syms[i].st_name >= (Elf64_Word)n)
+	    return err("invalid symbol table");
+    if (versymsec) {
+	alloc(versyms, count * sizeof *versyms);
+	if (shdrs[versymsec].sh_size < count * sizeof(Elf32_Versym))
+	    return err("invalid symbol version table");
+	if (fseek(thefile, shdrs[versymsec].sh_offset, SEEK_SET))
+	    return err("invalid symbol version table");
+	for (i = 0 ; i < count ; ++i)
+	    if (elfrw_read_Versym(thefile, versyms + i) != 1)
+		return err("invalid symbol version table");
+    }
+
+    used = NULL;
+    alloc(used, count);
+    memset(used, 0, count);
+    for (i = 1 ; i < ehdr.e_shnum ; ++i)
+	if ((shdrs[i].sh_type == SHT_REL || shdrs[i].sh_type == SHT_RELA)
+			&& shdrs[i].sh_link == (Elf64_Word)dynsym)
+	    if (!updaterelocs(shdrs + i, count, used, NULL))
+		return FALSE;
+
+    /* Decide what to do with each symbol.
+     */
+    alloc(state, count);
+    dropped = 0;
+    for (i = 0 ; i < count ; ++i) {
+	state[i] = SYM_KEEP;
+	if (i < (int)sh->sh_info || syms[i].st_shndx == SHN_UNDEF)
+	    continue;
+	vis = ELF64_ST_VISIBILITY(syms[i].st_other);
+	if (vis != STV_HIDDEN && vis != STV_INTERNAL)
+	    continue;
+	if (used[i]) {
+	    state[i] = SYM_UNHASH;
+	} else {
+	    state[i] = SYM_DROP;
+	    ++dropped;
+	}
+    }
+
+    /* Choose the new order of the symbols. The symbols that are kept
+     * out of the GNU hash table have to come before the ones that are
+     * in it, and those have to be grouped by hash bucket.
+     */
+    symoffset = count;
+    nbuckets = 0;
+    if (gnuhashsec) {
+	if (fseek(thefile, shdrs[gnuhashsec].sh_offset, SEEK_SET)
+			|| elfrw_read_Word(thefile, &nbuckets) != 1
+			|| elfrw_read_Word(thefile, &symoffset) != 1
+			|| !nbuckets || symoffset > (Elf64_Word)count)
+	    return err("invalid GNU hash table");
+    }
+    alloc(order, count * sizeof *order);
+    alloc(newindex, count * sizeof *newindex);
+    newcount = 0;
+    for (i = 0 ; i < count ; ++i)
+	if (state[i] != SYM_DROP && (i < (int)symoffset
+					|| state[i] == SYM_UNHASH))
+	    order[newcount++] = i;
+    newsymoffset = newcount;
+    if (gnuhashsec) {
+	alloc(buckets, count * sizeof *buckets);
+	alloc(bucketstart, (nbuckets + 1) * sizeof *bucketstart);
+	memset(bucketstart, 0, (nbuckets + 1) * sizeof *bucketstart);
+	for (i = symoffset ; i < count ; ++i) {
+	    if (state[i] != SYM_KEEP)
+		continue;
+	    buckets[i] = gnuhash(strtab + syms[i].st_name) % nbuckets;
+	    ++bucketstart[buckets[i] + 1];
+	}
+	for (n = 0 ; n < (int)nbuckets ; ++n)
+	    bucketstart[n + 1] += bucketstart[n];
+	for (i = symoffset ; i < count ; ++i)
+	    if (state[i] == SYM_KEEP)
+		order[newsymoffset + bucketstart[buckets[i]]++] = i;
+	newcount = count - dropped;
+    }
+    for (i = 0 ; i < count ; ++i)
+	newindex[i] = -1;
+    for (i = 0 ; i < newcount ; ++i)
+	newindex[order[i]] = i;
+
+    /* Write out the new symbol table and symbol version table, and
+     * clear the unused space at the end of each.
+     */
+    alloc(newsyms, newcount * sizeof *newsyms);
+    alloc(newstate, newcount);
+    for (i = 0 ; i < newcount ; ++i) {
+	newsyms[i] = syms[order[i]];
+	newstate[i] = state[order[i]];
+    }
+    ok = !fseek(thefile, sh->sh_offset, SEEK_SET)
+	&& elfrw_write_Syms(thefile, newsyms, newcount) == newcount
+	&& writezeros(sh->sh_offset + newcount * sh->sh_entsize,
+		      dropped * sh->sh_entsize);
+    sh->sh_size = newcount * sh->sh_entsize;
+    if (ok && versymsec) {
+	alloc(newversyms, newcount * sizeof *newversyms);
+	for (i = 0 ; i < newcount ; ++i)
+	    newversyms[i] = versyms[order[i]];
+	ok = !fseek(thefile, shdrs[versymsec].sh_offset, SEEK_SET);
+	for (i = 0 ; ok && i < newcount ; ++i)
+	    ok = elfrw_write_Versym(thefile, newversyms + i) == 1;
+	ok = ok && writezeros(shdrs[versymsec].sh_offset
+				+ newcount * sizeof(Elf32_Versym),
+			      dropped * sizeof(Elf32_Versym));
+	shdrs[versymsec].sh_size = newcount * sizeof(Elf32_Versym);
+    }
+    if (!ok)
+	return err("unable to write to the object file");
+
+    /* Update everything that refers to the symbols by index.
+     */
+    for (i = 1 ; i < ehdr.e_shnum ; ++i)
+	if ((shdrs[i].sh_type == SHT_REL || shdrs[i].sh_type == SHT_RELA)
+			&& shdrs[i].sh_link == (Elf64_Word)dynsym)
+	    if (!updaterelocs(shdrs + i, count, NULL, newindex))
+		return FALSE;
+    if (gnuhashsec && !writegnuhash(shdrs + gnuhashsec, newsyms, newcount,
+				    newsymoffset, strtab))
+	return FALSE;
+    if (hashsec && !writeelfhash(shdrs + hashsec, newsyms, newcount,
+				 newstate, strtab))
+	return FALSE;
+    if (fseek(thefile, ehdr.e_shoff, SEEK_SET)
+		|| elfrw_write_Shdrs(thefile, shdrs, ehdr.e_shnum)
+							!= ehdr.e_shnum)
+	return err("unable to write to the object file");
+
+    if (verbose)
+	printf("%s: %d symbols removed from the dynamic symbol table.\n",
+	       thefilename, dropped);
+    free(syms);
+    free(newsyms);
+    free(versyms);
+    free(newversyms);
+    free(used);
+    free(state);
+    free(newstate);
+    free(order);
+    free(newindex);
+    free(buckets);
+    free(bucketstart);
+    free(strtab);
+    return TRUE;
+}
+
+/* countsymbols() adds the non-local symbols in a symbol table to the
+ * current file's statistics.
+ */
+static void countsymbols(Elf64_Sym const *symtab, int count)
+{
+    int vis, i;
+
+    for (i = 0 ; i < count ; ++i) {
+	if (symtab[i].st_shndx == SHN_UNDEF) {
+	    ++filestats.undefined;
+	    continue;
+	}
+	vis = ELF64_ST_VISIBILITY(symtab[i].st_other);
+	++filestats.visibility[vis];
+	if (vis == STV_DEFAULT || vis == STV_PROTECTED)
+	    ++filestats.exported;
+	if (ELF64_ST_BIND(symtab[i].st_info) == STB_WEAK)
+	    ++filestats.weak;
+    }
+}
+
+/* printstats() displays a line of symbol statistics.
+ */
+static void printstats(symstats const *stats, char const *name)
+{
+    printf("%lu\t%lu\t%lu\t%lu\t%lu\t%lu\t%lu\t%lu\t%lu\t%s\n",
+	   stats->exported, stats->weak, stats->undefined,
+	   stats->visibility[STV_DEFAULT], stats->visibility[STV_PROTECTED],
+	   stats->visibility[STV_HIDDEN], stats->visibility[STV_INTERNAL],
+	   stats->matched, stats->changed, name);
+}
+
+/* addstats() displays the statistics for the current file and adds
+ * them to the totals.
+ */
+static void addstats(void)
+{
+    unsigned long const *from = (unsigned long const*)&filestats;
+    unsigned long *to = (unsigned long*)totalstats;
+    unsigned int i;
+
+    printstats(&filestats, thefilename);
+    for (i = 0 ; i < STATSFIELDS ; ++i)
+	__atomic_fetch_add(to + i, from[i], __ATOMIC_RELAXED);
+}
+
 /* rebind() does the grunt work of locating the symbol tables. After
  * checking over the ELF headers, the function iterates through the
  * sections, looking for symbol tables containing non-local symbol.
  * When it finds one, it loads the non-local part of the table and the
  * associated string table into memory, and calls changesymbols(). If
  * changesymbols() actually changes anything, the altered symbol table
- * is written back out to the object file.
+ * is written back out to the object file. With --stats, nothing is
+ * written; the symbols are counted instead. Only the dynamic symbol
+ * table is counted when there is one, since it lists the symbols that
+ * are actually exported.
  */
 static int rebind(void)
 {
@@ -184,23 +1179,34 @@ static int rebind(void)
     unsigned long offset;
     int count;
     int changed;
+    int dynsym;
     int i, n;
 
     if (!readheader())
 	return FALSE;
     changed = FALSE;
+    dynsym = 0;
+    memset(&filestats, 0, sizeof filestats);
     alloc(shdrs, ehdr.e_shnum * sizeof *shdrs);
     if (fseek(thefile, ehdr.e_shoff, SEEK_SET) ||
 		elfrw_read_Shdrs(thefile, shdrs, ehdr.e_shnum) != ehdr.e_shnum)
 	return err("invalid section header table.");
+    if (statsonly)
+	for (i = 0 ; i < ehdr.e_shnum ; ++i)
+	    if (shdrs[i].sh_type == SHT_DYNSYM)
+		dynsym = i;
     for (i = 0 ; i < ehdr.e_shnum ; ++i) {
 	if (shdrs[i].sh_type != SHT_SYMTAB && shdrs[i].sh_type != SHT_DYNSYM)
 	    continue;
+	if (statsonly && dynsym && i != dynsym)
+	    continue;
 	if (shdrs[i].sh_entsize != sizeof(Elf32_Sym) &&
 			shdrs[i].sh_entsize != sizeof(Elf64_Sym)) {
 	    err("symbol table of unrecognized structure ignored.");
 	    continue;
 	}
+	if (shdrs[i].sh_type == SHT_DYNSYM)
+	    dynsym = i;
 	offset = shdrs[i].sh_offset + shdrs[i].sh_info * shdrs[i].sh_entsize;
 	count = shdrs[i].sh_size / shdrs[i].sh_entsize - shdrs[i].sh_info;
 	if (!count)
@@ -214,13 +1220,27 @@ static int rebind(void)
 	if (fseek(thefile, shdrs[shdrs[i].sh_link].sh_offset, SEEK_SET) ||
 			fread(strtab, n, 1, thefile) != 1)
 	    return err("invalid associated string table");
+	if (statsonly) {
+	    countsymbols(symtab, count);
+	    changesymbols(symtab, strtab, count);
+	    continue;
+	}
 	if (changesymbols(symtab, strtab, count)) {
-	    if (fseek(thefile, offset, SEEK_SET) ||
-			elfrw_write_Syms(thefile, symtab, count) != count)
-		return err("unable to write to the object file");
+	    if (!writesymbols(offset, shdrs[i].sh_entsize, symtab, count))
+		return FALSE;
 	    changed = TRUE;
 	}
     }
+    if (statsonly) {
+	addstats();
+	free(strtab);
+	free(symtab);
+	free(shdrs);
+	return TRUE;
+    }
+    if (unexport && dynsym && ehdr.e_type == ET_DYN && !theimage)
+	if (!unexportsymbols(shdrs, dynsym))
+	    return FALSE;
 
     if (verbose && !changed)
 	printf("%s: nothing changed.\n", thefilename);
@@ -230,17 +1250,135 @@ static int rebind(void)
     return TRUE;
 }
 
+/* addsymflags() adds flags to a name in the symbol graph, adding the
+ * name to the table if it isn't already present. The table is
+ * doubled in size whenever it becomes half full.
+ */
+static void addsymflags(char const *name, unsigned int flags)
+{
+    symnode *old;
+    unsigned long size, h, i;
+
+    if (2 * (symgraphcount + 1) > symgraphmask + 1 || !symgraph) {
+	size = symgraph ? 2 * (symgraphmask + 1) : 1024;
+	old = symgraph;
+	symgraph = NULL;
+	alloc(symgraph, size * sizeof *symgraph);
+	memset(symgraph, 0, size * sizeof *symgraph);
+	if (old) {
+	    for (i = 0 ; i <= symgraphmask ; ++i) {
+		if (!old[i].name)
+		    continue;
+		h = namehash(old[i].name) & (size - 1);
+		while (symgraph[h].name)
+		    h = (h + 1) & (size - 1);
+		symgraph[h] = old[i];
+	    }
+	    free(old);
+	}
+	symgraphmask = size - 1;
+    }
+
+    for (h = namehash(name) & symgraphmask ; symgraph[h].name ;
+					      h = (h + 1) & symgraphmask) {
+	if (!strcmp(symgraph[h].name, name)) {
+	    symgraph[h].flags |= flags;
+	    return;
+	}
+    }
+    symgraph[h].name = name;
+    symgraph[h].flags = flags;
+    ++symgraphcount;
+}
+
+/* collectsymbols() reads the non-local symbols in an ELF file and adds
+ * them to the symbol graph. For the files in the link set, defined
+ * symbols and undefined references are both recorded. For external
+ * files, only the undefined references matter, as these are the
+ * symbols that the link set must continue to provide. The string
+ * tables are kept in memory, as the graph points into them.
+ */
+static int collectsymbols(void)
+{
+    Elf64_Shdr *shdrs = NULL;
+    Elf64_Sym *symtab = NULL;
+    char *strtab;
+    char const *name;
+    unsigned long offset;
+    unsigned int flags;
+    int count, vis;
+    int i, j, n;
+
+    if (!readheader())
+	return FALSE;
+    alloc(shdrs, ehdr.e_shnum * sizeof *shdrs);
+    if (fseek(thefile, ehdr.e_shoff, SEEK_SET) ||
+		elfrw_read_Shdrs(thefile, shdrs, ehdr.e_shnum) != ehdr.e_shnum)
+	return err("invalid section header table.");
+    for (i = 0 ; i < ehdr.e_shnum ; ++i) {
+	if (shdrs[i].sh_type != SHT_SYMTAB && shdrs[i].sh_type != SHT_DYNSYM)
+	    continue;
+	if (shdrs[i].sh_entsize != sizeof(Elf32_Sym) &&
+			shdrs[i].sh_entsize != sizeof(Elf64_Sym))
+	    continue;
+	offset = shdrs[i].sh_offset + shdrs[i].sh_info * shdrs[i].sh_entsize;
+	count = shdrs[i].sh_size / shdrs[i].sh_entsize - shdrs[i].sh_info;
+	if (count <= 0 || shdrs[i].sh_link >= ehdr.e_shnum)
+	    continue;
+	n = shdrs[shdrs[i].sh_link].sh_size;
+	strtab = NULL;
+	alloc(symtab, count * sizeof *symtab);
+	alloc(strtab, n + 1);
+	if (fseek(thefile, offset, SEEK_SET) ||
+			elfrw_read_Syms(thefile, symtab, count) != count)
+	    return err("invalid symbol table");
+	if (fseek(thefile, shdrs[shdrs[i].sh_link].sh_offset, SEEK_SET) ||
+			fread(strtab, n, 1, thefile) != 1)
+	    return err("invalid associated string table");
+	strtab[n] = '\0';
+	for (j = 0 ; j < count ; ++j) {
+	    if (!symtab[j].st_name || symtab[j].st_name >= (unsigned)n)
+		continue;
+	    if (ELF64_ST_BIND(symtab[j].st_info) == STB_LOCAL)
+		continue;
+	    name = strtab + symtab[j].st_name;
+	    if (symtab[j].st_shndx == SHN_UNDEF) {
+		flags = collectexternal ? SYM_EXTERNAL : SYM_REFERENCED;
+	    } else if (collectexternal) {
+		continue;
+	    } else {
+		flags = SYM_DEFINED;
+		vis = ELF64_ST_VISIBILITY(symtab[j].st_other);
+		if (vis == STV_DEFAULT || vis == STV_PROTECTED)
+		    flags |= SYM_EXPORTED;
+	    }
+	    addsymflags(name, flags);
+	}
+    }
+
+    free(symtab);
+    free(shdrs);
+    return TRUE;
+}
+
 /* readoptions() parses the command-line arguments. It only returns if
  * the syntax is valid and there is work to do.
  */
 static void readcmdline(int argc, char *argv[])
 {
-    static char const *optstring = "b:hiv:w";
+    static char const *optstring = "ab:e:f:ghij:suv:w";
     static struct option const options[] = {
 	{ "binding", required_argument, 0, 'b' },
 	{ "visibility", required_argument, 0, 'v' },
 	{ "weaken", no_argument, 0, 'w' },
 	{ "hide", no_argument, 0, 'h' },
+	{ "symbols", required_argument, 0, 'f' },
+	{ "jobs", required_argument, 0, 'j' },
+	{ "glob", no_argument, 0, 'g' },
+	{ "unexport", no_argument, 0, 'u' },
+	{ "stats", no_argument, 0, 's' },
+	{ "advise", no_argument, 0, 'a' },
+	{ "external", required_argument, 0, 'e' },
 	{ "verbose", no_argument, 0, 'i' },
 	{ "help", no_argument, 0, 'H' },
 	{ "version", no_argument, 0, 'V' },
@@ -255,6 +1393,12 @@ static void readcmdline(int argc, char *argv[])
     }
 
     verbose = FALSE;
+    jobcount = 1;
+    useglobs = FALSE;
+    unexport = FALSE;
+    statsonly = FALSE;
+    advise = FALSE;
+    symbolfile = NULL;
     chgbind = FALSE;
     chgvisibility = FALSE;
 
@@ -299,7 +1443,33 @@ static void readcmdline(int argc, char *argv[])
 	    if (chgvisibility && tovisibility != STV_HIDDEN)
 		badcmdline("conflicting visibility arguments");
 	    chgvisibility = TRUE;
-	    tobind = STV_HIDDEN;
+	    tovisibility = STV_HIDDEN;
+	    break;
+	  case 'f':
+	    symbolfile = optarg;
+	    break;
+	  case 'j':
+	    jobcount = atoi(optarg);
+	    if (jobcount <= 0)
+		jobcount = sysconf(_SC_NPROCESSORS_ONLN);
+	    if (jobcount <= 0)
+		jobcount = 1;
+	    break;
+	  case 'g':
+	    useglobs = TRUE;
+	    break;
+	  case 'u':
+	    unexport = TRUE;
+	    break;
+	  case 's':
+	    statsonly = TRUE;
+	    break;
+	  case 'a':
+	    advise = TRUE;
+	    break;
+	  case 'e':
+	    alloc(externals, (externalcount + 1) * sizeof *externals);
+	    externals[externalcount++] = optarg;
 	    break;
 	  case 'i':
 	    verbose = TRUE;
@@ -314,38 +1484,387 @@ static void readcmdline(int argc, char *argv[])
     }
     if (optind == argc)
 	badcmdline("no input files");
-    if (!chgbind && !chgvisibility)
+    if (advise && symbolfile)
+	badcmdline("--advise and --symbols cannot be used together");
+    if (externalcount && !advise)
+	badcmdline("--external can only be used with --advise");
+    if (unexport) {
+	if (chgvisibility && tovisibility != STV_HIDDEN
+			  && tovisibility != STV_INTERNAL)
+	    badcmdline("--unexport requires hidden or internal visibility");
+	if (!chgvisibility)
+	    tovisibility = STV_HIDDEN;
+	chgvisibility = TRUE;
+    }
+    if (!chgbind && !chgvisibility && !advise && !statsonly)
 	badcmdline("nothing to do");
 
-    thefilename = argv[optind];
-    ++optind;
+    filelist = argv + optind;
+    if (symbolfile || advise || statsonly) {
+	filecount = argc - optind;
+	optind = argc;
+    } else {
+	filecount = 1;
+	++optind;
+    }
 }
 
-/* main() builds the array of symbol names, opens the object file, and
- * calls rebind().
+/* rebindmember() calls theaction on one member of a mapped archive.
+ * The ELF headers are read through a read-only stream over the
+ * member's contents, and any changes are written directly into the
+ * mapping by writesymbols().
  */
-int main(int argc, char *argv[])
+static int rebindmember(char const *archivename, struct ar_hdr const *hdr,
+			unsigned char *data, unsigned long size,
+			char const *longnames, unsigned long longnamessize)
+{
+    char const *name = hdr->ar_name;
+    char       *fullname = NULL;
+    unsigned long n;
+    int len, r;
+
+    if (name[0] == '/' && name[1] >= '0' && name[1] <= '9' && longnames) {
+	n = strtoul(name + 1, NULL, 10);
+	if (n >= longnamessize)
+	    n = longnamessize;
+	name = longnames + n;
+	for (len = 0 ; n + len < longnamessize ; ++len)
+	    if (name[len] == '/' || name[len] == '\n')
+		break;
+    } else {
+	for (len = 0 ; len < (int)sizeof hdr->ar_name ; ++len)
+	    if (name[len] == '/' || name[len] == ' ')
+		break;
+    }
+    alloc(fullname, strlen(archivename) + len + 3);
+    sprintf(fullname, "%s(%.*s)", archivename, len, name);
+    thefilename = fullname;
+
+    if (!(thefile = fmemopen(data, size, "rb"))) {
+	r = err("unable to read the archive member.");
+    } else {
+	theimage = data;
+	theimagesize = size;
+	r = theaction();
+	theimage = NULL;
+	fclose(thefile);
+    }
+    thefilename = archivename;
+    free(fullname);
+    return r;
+}
+
+/* rebindarchive() maps a static library into memory and calls
+ * theaction on each object file it contains. The symbol tables are
+ * modified in place, so the size and position of every member stays
+ * the same. The archive's symbol index does not need to be changed
+ * either, since it lists every defined symbol that is global or weak,
+ * regardless of visibility, and local symbols are never rebound.
+ */
+static int rebindarchive(void)
+{
+    struct ar_hdr const *hdr;
+    struct stat	    st;
+    unsigned char  *image;
+    char const	   *longnames = NULL;
+    unsigned long   longnamessize = 0;
+    unsigned long   pos, size;
+    int		    fd, ok = TRUE;
+
+    if ((fd = open(thefilename, readonly ? O_RDONLY : O_RDWR)) < 0)
+	return err("unable to open.");
+    if (fstat(fd, &st)) {
+	close(fd);
+	return err("unable to open.");
+    }
+    image = mmap(NULL, st.st_size,
+		 readonly ? PROT_READ : PROT_READ | PROT_WRITE,
+		 MAP_SHARED, fd, 0);
+    close(fd);
+    if (image == MAP_FAILED)
+	return err("unable to map the archive into memory.");
+
+    size = 0;
+    for (pos = SARMAG ; pos < (unsigned long)st.st_size ;
+						pos += size + (size & 1)) {
+	hdr = (struct ar_hdr const*)(image + pos);
+	if (pos + sizeof *hdr > (unsigned long)st.st_size
+			|| memcmp(hdr->ar_fmag, ARFMAG, sizeof hdr->ar_fmag)) {
+	    errno = 0;
+	    ok = err("invalid archive member header.");
+	    break;
+	}
+	pos += sizeof *hdr;
+	size = strtoul(hdr->ar_size, NULL, 10);
+	if (size > st.st_size - pos) {
+	    errno = 0;
+	    ok = err("truncated archive member.");
+	    break;
+	}
+	if (!memcmp(hdr->ar_name, "#1/", 3)) {
+	    errno = 0;
+	    ok = err("BSD-style archives are not supported.");
+	    break;
+	}
+	if (!memcmp(hdr->ar_name, "//              ", 16)) {
+	    longnames = (char const*)image + pos;
+	    longnamessize = size;
+	} else if (size >= EI_NIDENT
+			&& !memcmp(image + pos, ELFMAG, SELFMAG)) {
+	    errno = 0;
+	    if (!rebindmember(thefilename, hdr, image + pos, size,
+			      longnames, longnamessize))
+		ok = FALSE;
+	}
+    }
+
+    munmap(image, st.st_size);
+    return ok;
+}
+
+/* rebindfile() opens an object file or a static library and calls
+ * theaction on it.
+ */
+static int rebindfile(char const *filename)
 {
+    char magic[SARMAG];
     int r;
 
-    readcmdline(argc, argv);
+    thefilename = filename;
+    errno = 0;
+    if (!(thefile = fopen(thefilename, readonly ? "rb" : "rb+")))
+	return err("unable to open.");
+    if (fread(magic, SARMAG, 1, thefile) == 1
+				&& !memcmp(magic, ARMAG, SARMAG)) {
+	fclose(thefile);
+	r = rebindarchive();
+    } else {
+	rewind(thefile);
+	errno = 0;
+	r = theaction();
+	fclose(thefile);
+    }
+    fflush(stdout);
+    return r;
+}
+
+/* runworker() modifies files from the list until there are none left.
+ */
+static void runworker(progress *prog)
+{
+    int i;
+
+    totalstats = &prog->total;
+    for (;;) {
+	i = __atomic_fetch_add(&prog->next, 1, __ATOMIC_RELAXED);
+	if (i >= filecount)
+	    break;
+	if (rebindfile(filelist[i]))
+	    __atomic_fetch_add(&prog->done, 1, __ATOMIC_RELAXED);
+	else
+	    __atomic_fetch_add(&prog->failed, 1, __ATOMIC_RELAXED);
+    }
+}
+
+/* runworkers() modifies all the files in the list, using jobcount
+ * processes. The workers are forked after the name table has been
+ * built, so they all share a single read-only copy of it. (Separate
+ * processes are used instead of threads, since the elfrw functions
+ * keep per-file state in global variables.) The final tallies are
+ * copied into local, and the return value is the number of files that
+ * could not be modified.
+ */
+static int runworkers(progress *local)
+{
+    progress   *prog;
+    pid_t	pid;
+    int		status, i;
 
-    if (!(thefile = fopen(thefilename, "rb+"))) {
-	err("unable to open.");
-	return EXIT_FAILURE;
+    memset(local, 0, sizeof *local);
+    if (jobcount > filecount)
+	jobcount = filecount;
+    if (jobcount <= 1) {
+	runworker(local);
+	return local->failed;
     }
 
-    if (optind == argc) {
+    prog = mmap(NULL, sizeof *prog, PROT_READ | PROT_WRITE,
+		MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (prog == MAP_FAILED) {
+	perror(theprogram);
+	exit(EXIT_FAILURE);
+    }
+    memset(prog, 0, sizeof *prog);
+    fflush(stdout);
+    fflush(stderr);
+    for (i = 0 ; i < jobcount ; ++i) {
+	pid = fork();
+	if (pid < 0) {
+	    perror(theprogram);
+	    break;
+	}
+	if (pid == 0) {
+	    runworker(prog);
+	    _exit(EXIT_SUCCESS);
+	}
+    }
+    if (i == 0)
+	runworker(prog);
+
+    while (wait(&status) > 0) {
+	if (!WIFEXITED(status) || WEXITSTATUS(status)) {
+	    fprintf(stderr, "%s: a worker process failed.\n", theprogram);
+	    ++prog->failed;
+	}
+    }
+    if (prog->done + prog->failed < filecount)
+	prog->failed = filecount - prog->done;
+    *local = *prog;
+    munmap(prog, sizeof *prog);
+    return local->failed;
+}
+
+/* Standard qsort string comparison function.
+ */
+static int qstrcmp(void const *a, void const *b)
+{
+    return strcmp(*(char const**)a, *(char const**)b);
+}
+
+/* findunneeded() builds the symbol graph for the link set, and then
+ * fills namelist with the symbols that the link set defines and
+ * exports, but which nothing outside of the link set refers to. The
+ * external files can be ELF files, whose undefined symbols are taken
+ * to be needed, or plain lists of symbol names. The return value is
+ * the number of files that could not be read.
+ */
+static int findunneeded(void)
+{
+    FILE *fp;
+    char magic[SELFMAG];
+    unsigned long i;
+    int failures = 0;
+    int n;
+
+    readonly = TRUE;
+    theaction = collectsymbols;
+    collectexternal = TRUE;
+    for (n = 0 ; n < externalcount ; ++n) {
+	if (!(fp = fopen(externals[n], "r"))) {
+	    fprintf(stderr, "%s: %s: %s\n",
+		    theprogram, externals[n], strerror(errno));
+	    ++failures;
+	    continue;
+	}
+	if (fread(magic, SELFMAG, 1, fp) == 1
+			&& (!memcmp(magic, ELFMAG, SELFMAG)
+				|| !memcmp(magic, ARMAG, SELFMAG))) {
+	    fclose(fp);
+	    if (!rebindfile(externals[n]))
+		++failures;
+	    continue;
+	}
+	rewind(fp);
+	namecount = 0;
+	if (!namelistfromfile(fp))
+	    ++failures;
+	fclose(fp);
+	for (i = 0 ; i < (unsigned long)namecount ; ++i)
+	    addsymflags(namelist[i], SYM_EXTERNAL);
+    }
+
+    collectexternal = FALSE;
+    for (n = 0 ; n < filecount ; ++n)
+	if (!rebindfile(filelist[n]))
+	    ++failures;
+
+    namecount = 0;
+    for (i = 0 ; symgraph && i <= symgraphmask ; ++i) {
+	if (!symgraph[i].name)
+	    continue;
+	if ((symgraph[i].flags & (SYM_EXPORTED | SYM_EXTERNAL))
+						!= SYM_EXPORTED)
+	    continue;
+	if (namecount >= namelistsize) {
+	    namelistsize = namelistsize ? namelistsize * 2 : 1024;
+	    alloc(namelist, namelistsize * sizeof *namelist);
+	}
+	namelist[namecount++] = (char*)symgraph[i].name;
+    }
+    qsort(namelist, namecount, sizeof *namelist, qstrcmp);
+    return failures;
+}
+
+/* main() builds the array of symbol names and the hash table, either
+ * from the command line or by examining the link set, and then calls
+ * rebind() on each object file.
+ */
+int main(int argc, char *argv[])
+{
+    FILE *fp;
+    progress prog;
+    unsigned long h;
+    int failures, n;
+
+    readcmdline(argc, argv);
+
+    if (advise) {
+	if (findunneeded())
+	    return EXIT_FAILURE;
+	if (!chgbind && !chgvisibility && !statsonly) {
+	    for (n = 0 ; n < namecount ; ++n)
+		puts(namelist[n]);
+	    return EXIT_SUCCESS;
+	}
+    } else if (symbolfile) {
+	if (!strcmp(symbolfile, "-")) {
+	    fp = stdin;
+	} else if (!(fp = fopen(symbolfile, "r"))) {
+	    fprintf(stderr, "%s: %s: %s\n",
+		    theprogram, symbolfile, strerror(errno));
+	    return EXIT_FAILURE;
+	}
+	if (!namelistfromfile(fp))
+	    return EXIT_FAILURE;
+	if (fp != stdin)
+	    fclose(fp);
+    } else if (statsonly) {
+	namecount = 0;
+    } else if (optind == argc) {
 	if (!namelistfromfile(stdin))
 	    return EXIT_FAILURE;
     } else {
 	namelist = argv + optind;
 	namecount = argc - optind;
     }
-    qsort(namelist, namecount, sizeof *namelist, qstrcmp);
+    buildnameset();
+    buildglobs();
+
+    readonly = FALSE;
+    theaction = rebind;
+    if (statsonly) {
+	readonly = TRUE;
+	namefound = mmap(NULL, namesetmask + 1, PROT_READ | PROT_WRITE,
+			 MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (namefound == MAP_FAILED) {
+	    perror(theprogram);
+	    return EXIT_FAILURE;
+	}
+	printf("exported\tweak\tundef\tdefault\tprotect\thidden\t"
+	       "internal\tmatched\tchanged\tfile\n");
+    }
 
-    r = rebind();
+    failures = runworkers(&prog);
+    if (statsonly) {
+	printstats(&prog.total, "total");
+	for (h = 0 ; h <= namesetmask ; ++h)
+	    if (nameset[h] && !namefound[h])
+		printf("%s\tnot found\n", nameset[h]);
+    }
+    if (failures && filecount > 1)
+	fprintf(stderr, "%s: %d of %d files could not be %s.\n",
+		theprogram, failures, filecount,
+		statsonly ? "read" : "modified");
 
-    fclose(thefile);
-    return r ? EXIT_SUCCESS : EXIT_FAILURE;
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
 }
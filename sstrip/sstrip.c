@@ -3,13 +3,26 @@
  * This is free software; you are free to change and redistribute it.
  * There is NO WARRANTY, to the extent permitted by law.
  */
+#define _GNU_SOURCE
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <errno.h>
 #include <unistd.h>
 #include <getopt.h>
+#include <fcntl.h>
+#include <ar.h>
+#include <ftw.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <sys/sendfile.h>
+#include <sys/ioctl.h>
+#include <linux/fs.h>
 #include <elf.h>
+#if defined __SSE2__
+#include <emmintrin.h>
+#endif
 
 #include "elfrw.h"
 
@@ -22,8 +35,15 @@
  */
 static char const *yowzitch =
     "Usage: sstrip [OPTIONS] FILE...\n"
+    "       sstrip [OPTIONS] - < INPUT > OUTPUT\n"
     "Remove all nonessential bytes from executable ELF files.\n\n"
     "  -z, --zeroes        Also discard trailing zero bytes.\n"
+    "  -s, --safe          Replace files instead of modifying them.\n"
+    "  -a, --aggressive    Also remove unused bytes between segments.\n"
+    "  -o, --objects       Also strip relocatable objects and archives.\n"
+    "  -n, --dry-run       Report the savings without changing files.\n"
+    "  -r, --recursive     Strip the ELF files found in directories.\n"
+    "  -j, --jobs=N        Strip N files at a time.\n"
     "      --help          Display this help and exit.\n"
     "      --version       Display version information and exit.\n";
 
@@ -45,37 +65,128 @@ static char const *theprogram;
  */
 static int dozerotrunc = FALSE;
 
+/* The number of processes to strip files with.
+ */
+static int jobcount = 1;
+
+/* TRUE if directories are to be searched for files to strip.
+ */
+static int recurse = FALSE;
+
+/* TRUE if the stripped files are to be written out as new files that
+ * then replace the originals.
+ */
+static int safemode = FALSE;
+
+/* TRUE if segments are to be moved down to close the gaps between
+ * them.
+ */
+static int compact = FALSE;
+
+/* TRUE if relocatable objects and static archives are to be stripped
+ * as well.
+ */
+static int doobjects = FALSE;
+
+/* TRUE if files are only to be examined, and the potential savings
+ * reported.
+ */
+static int dryrun = FALSE;
+
 /* Information for each executable operated upon.
  */
-static char const  *thefilename;	/* the name of the current file */
-static FILE        *thefile;		/* the currently open file handle */
-static Elf64_Ehdr   ehdr;		/* the current file's ELF header */
-static Elf64_Phdr  *phdrs;		/* the program segment header table */
-unsigned long       newsize;		/* the proposed new file size */
+typedef struct sstripfile {
+    char const	   *filename;	/* the name of the file */
+    int		    fd;		/* the open file descriptor */
+    unsigned char  *image;	/* the file's contents, mapped */
+    unsigned long   size;	/* the file's original size */
+    FILE	   *fp;		/* a stream reading from image */
+    Elf64_Ehdr	    ehdr;	/* the file's ELF header */
+    Elf64_Phdr	   *phdrs;	/* the program segment header table */
+    unsigned long   newsize;	/* the proposed new file size */
+    struct stat	    st;		/* the file's original status */
+    int		    changed;	/* TRUE if the headers were modified */
+    unsigned long   movedfrom;	/* where moved contents begin, if any */
+    struct filemove *moves;	/* the blocks of the file to be moved */
+    int		    movecount;	/* the number of entries in moves */
+    int		    quiet;	/* TRUE if errors are not to be reported */
+} sstripfile;
+
+/* A block of the file's contents, and how far down it is to be moved.
+ */
+typedef struct filemove {
+    unsigned long   from;	/* the offset of the first byte */
+    unsigned long   to;		/* the offset just past the last byte */
+    unsigned long   delta;	/* the distance to move the block */
+} filemove;
+
+/* A part of the file that is referenced by the headers.
+ */
+typedef struct filerange {
+    unsigned long   from;	/* the offset of the first byte */
+    unsigned long   to;		/* the offset just past the last byte */
+    unsigned long   align;	/* the alignment that must be preserved */
+} filerange;
+
+/* A file to be stripped. Files that were found by searching a
+ * directory are quietly skipped if they are not ELF executables.
+ */
+typedef struct workitem {
+    char	   *filename;	/* the name of the file */
+    dev_t	    dev;	/* the device containing the file */
+    ino_t	    ino;	/* the file's inode */
+    unsigned long   index;	/* the file's position in the list */
+    int		    found;	/* TRUE if the file was not named directly */
+} workitem;
+
+/* The list of files to strip.
+ */
+static workitem	   *worklist = NULL;
+static unsigned long workcount = 0;
+static unsigned long workalloc = 0;
+
+/* The progress of the workers through the list. When there is more
+ * than one worker, this lives in memory shared between them.
+ */
+typedef struct progress {
+    unsigned long   next;	/* the index of the next file to strip */
+    unsigned long   stripped;	/* the number of files stripped */
+    unsigned long   failed;	/* the number of files not stripped */
+    unsigned long   modified;	/* the number of files changed */
+    unsigned long   oldbytes;	/* the total size of the files before */
+    unsigned long   newbytes;	/* the total size of the files after */
+} progress;
 
 /* A simple error-handling function. FALSE is always returned for the
  * convenience of the caller.
  */
-static int err(char const *errmsg)
+static int err(sstripfile const *sf, char const *errmsg)
 {
-    fprintf(stderr, "%s: %s: %s\n", theprogram, thefilename, errmsg);
+    if (!sf->quiet)
+	fprintf(stderr, "%s: %s: %s\n", theprogram, sf->filename, errmsg);
     return FALSE;
 }
 
 /* A macro for I/O errors: The given error message is used only when
  * errno is not set.
  */
-#define	ferr(msg) (err(ferror(thefile) ? strerror(errno) : (msg)))
+#define	ferr(sf, msg) (err(sf, ferror((sf)->fp) ? strerror(errno) : (msg)))
 
 /* readcmdline() attemps to parse the command line arguments, and only
  * returns if succeeded and there is work to do.
  */
 static void readcmdline(int argc, char *argv[])
 {
-    static char const *optstring = "z";
+    static char const *optstring = "aj:norsz";
     static struct option const options[] = {
 	{ "zeros", no_argument, 0, 'z' },
 	{ "zeroes", no_argument, 0, 'z' },
+	{ "recursive", no_argument, 0, 'r' },
+	{ "safe", no_argument, 0, 's' },
+	{ "dry-run", no_argument, 0, 'n' },
+	{ "aggressive", no_argument, 0, 'a' },
+	{ "objects", no_argument, 0, 'o' },
+	{ "jobs", required_argument, 0, 'j' },
 	{ "help", no_argument, 0, 'H' },
 	{ "version", no_argument, 0, 'V' },
 	{ 0, 0, 0, 0 }
@@ -94,6 +205,28 @@ static void readcmdline(int argc, char *argv[])
 	  case 'z':
 	    dozerotrunc = TRUE;
 	    break;
+	  case 'r':
+	    recurse = TRUE;
+	    break;
+	  case 's':
+	    safemode = TRUE;
+	    break;
+	  case 'n':
+	    dryrun = TRUE;
+	    break;
+	  case 'a':
+	    compact = TRUE;
+	    break;
+	  case 'o':
+	    doobjects = TRUE;
+	    break;
+	  case 'j':
+	    jobcount = atoi(optarg);
+	    if (jobcount <= 0)
+		jobcount = sysconf(_SC_NPROCESSORS_ONLN);
+	    if (jobcount <= 0)
+		jobcount = 1;
+	    break;
 	  case 'H':
 	    fputs(yowzitch, stdout);
 	    exit(EXIT_SUCCESS);
@@ -107,32 +240,36 @@ static void readcmdline(int argc, char *argv[])
     }
 }
 
-/* readelfheader() reads the ELF header into our global variable, and
+/* readelfheader() reads the ELF header into the file's context, and
  * checks to make sure that this is in fact a file that we should be
  * munging.
  */
-static int readelfheader(void)
+static int readelfheader(sstripfile *sf)
 {
-    if (elfrw_read_Ehdr(thefile, &ehdr) != 1)
-	return ferr("not a valid ELF file");
+    if (elfrw_read_Ehdr(sf->fp, &sf->ehdr) != 1)
+	return ferr(sf, "not a valid ELF file");
 
-    if (ehdr.e_type != ET_EXEC && ehdr.e_type != ET_DYN)
-	return err("not an executable or shared-object library.");
+    if (sf->ehdr.e_type != ET_EXEC && sf->ehdr.e_type != ET_DYN)
+	return err(sf, "not an executable or shared-object library.");
 
     return TRUE;
 }
 
 /* readphdrtable() loads the program segment header table into memory.
  */
-static int readphdrtable(void)
+static int readphdrtable(sstripfile *sf)
 {
-    if (!ehdr.e_phoff || !ehdr.e_phnum)
-	return err("ELF file has no program header table.");
+    int n;
 
-    if (!(phdrs = realloc(phdrs, ehdr.e_phnum * sizeof *phdrs)))
-	return err("Out of memory!");
-    if (elfrw_read_Phdrs(thefile, phdrs, ehdr.e_phnum) != ehdr.e_phnum)
-	return ferr("missing or incomplete program segment header table.");
+    if (!sf->ehdr.e_phoff || !sf->ehdr.e_phnum)
+	return err(sf, "ELF file has no program header table.");
+
+    n = sf->ehdr.e_phnum;
+    if (!(sf->phdrs = realloc(sf->phdrs, n * sizeof *sf->phdrs)))
+	return err(sf, "Out of memory!");
+    if (fseek(sf->fp, sf->ehdr.e_phoff, SEEK_SET)
+		|| elfrw_read_Phdrs(sf->fp, sf->phdrs, n) != n)
+	return ferr(sf, "missing or incomplete program segment header table.");
 
     return TRUE;
 }
@@ -142,7 +279,7 @@ static int readphdrtable(void)
  * (Anything in the file after that point is not used when the program
  * is executing, and thus can be safely discarded.)
  */
-static int getmemorysize(void)
+static int getmemorysize(sstripfile *sf)
 {
     unsigned long size, n;
     int i;
@@ -150,56 +287,239 @@ static int getmemorysize(void)
     /* Start by setting the size to include the ELF header and the
      * complete program segment header table.
      */
-    size = ehdr.e_phoff + ehdr.e_phnum * sizeof *phdrs;
-    if (size < ehdr.e_ehsize)
-	size = ehdr.e_ehsize;
+    size = sf->ehdr.e_phoff + sf->ehdr.e_phnum * sizeof *sf->phdrs;
+    if (size < sf->ehdr.e_ehsize)
+	size = sf->ehdr.e_ehsize;
 
     /* Then keep extending the size to include whatever data the
      * program segment header table references.
      */
-    for (i = 0 ; i < ehdr.e_phnum ; ++i) {
-	if (phdrs[i].p_type != PT_NULL) {
-	    n = phdrs[i].p_offset + phdrs[i].p_filesz;
+    for (i = 0 ; i < sf->ehdr.e_phnum ; ++i) {
+	if (sf->phdrs[i].p_type != PT_NULL) {
+	    n = sf->phdrs[i].p_offset + sf->phdrs[i].p_filesz;
 	    if (n > size)
 		size = n;
 	}
     }
 
-    newsize = size;
+    sf->newsize = size;
     return TRUE;
 }
 
+/* rangesorter() is passed to qsort() to sort file ranges by their
+ * starting offset.
+ */
+static int rangesorter(void const *a, void const *b)
+{
+    filerange const *r1 = a;
+    filerange const *r2 = b;
+
+    return r1->from < r2->from ? -1 : r1->from > r2->from;
+}
+
+/* compactsegments() closes the gaps between the parts of the file that
+ * the program header table refers to. Overlapping segments are merged
+ * into blocks, and each block is moved down as far as possible while
+ * keeping it at the same offset modulo the largest alignment of the
+ * segments within it, so that p_offset and p_vaddr remain congruent.
+ * The block at the start of the file, with the ELF header, never
+ * moves. Since section offsets are no longer valid afterwards, the
+ * section header table is dropped. Only the headers are changed here:
+ * the blocks are recorded in sf->moves, and the contents are not
+ * moved until movesegments() is called, after every check has been
+ * passed.
+ */
+static int compactsegments(sstripfile *sf)
+{
+    filerange	   *ranges;
+    filemove	   *moves;
+    unsigned long   from, to, align, end, delta, off;
+    int		    count, n, i, j, k;
+
+    if (!compact)
+	return TRUE;
+    if (!(ranges = malloc((sf->ehdr.e_phnum + 2) * sizeof *ranges)))
+	return err(sf, "Out of memory!");
+    count = 0;
+    ranges[count].from = 0;
+    ranges[count].to = sf->ehdr.e_ehsize;
+    ranges[count++].align = 1;
+    ranges[count].from = sf->ehdr.e_phoff;
+    ranges[count].to = sf->ehdr.e_phoff
+		     + sf->ehdr.e_phnum * sf->ehdr.e_phentsize;
+    ranges[count++].align = 1;
+    for (i = 0 ; i < sf->ehdr.e_phnum ; ++i) {
+	if (sf->phdrs[i].p_type == PT_NULL || !sf->phdrs[i].p_filesz)
+	    continue;
+	ranges[count].from = sf->phdrs[i].p_offset;
+	ranges[count].to = sf->phdrs[i].p_offset + sf->phdrs[i].p_filesz;
+	ranges[count++].align = sf->phdrs[i].p_align > 1 ?
+					sf->phdrs[i].p_align : 1;
+    }
+    for (i = 0 ; i < count ; ++i) {
+	if (ranges[i].to > sf->size) {
+	    free(ranges);
+	    return err(sf, "program segments extend past the end of file.");
+	}
+    }
+    qsort(ranges, count, sizeof *ranges, rangesorter);
+    if (!(moves = malloc(count * sizeof *moves))) {
+	free(ranges);
+	return err(sf, "Out of memory!");
+    }
+
+    for (end = 0, n = 0, i = 0 ; i < count ; i = j, ++n) {
+	from = ranges[i].from;
+	to = ranges[i].to;
+	align = ranges[i].align;
+	for (j = i + 1 ; j < count && ranges[j].from <= to ; ++j) {
+	    if (ranges[j].to > to)
+		to = ranges[j].to;
+	    if (ranges[j].align > align)
+		align = ranges[j].align;
+	}
+	delta = from > end ? (from - end) / align * align : 0;
+	moves[n].from = from;
+	moves[n].to = to;
+	moves[n].delta = delta;
+	if (delta) {
+	    for (k = 0 ; k < sf->ehdr.e_phnum ; ++k) {
+		off = sf->phdrs[k].p_offset;
+		if (sf->phdrs[k].p_type != PT_NULL && off >= from && off < to)
+		    sf->phdrs[k].p_offset -= delta;
+	    }
+	    if (sf->ehdr.e_phoff >= from && sf->ehdr.e_phoff < to)
+		sf->ehdr.e_phoff -= delta;
+	    if (!sf->movedfrom)
+		sf->movedfrom = from - delta;
+	}
+	end = to - delta;
+    }
+    free(ranges);
+
+    if (sf->movedfrom) {
+	sf->moves = moves;
+	sf->movecount = n;
+	sf->newsize = end;
+	sf->ehdr.e_shoff = 0;
+	sf->ehdr.e_shnum = 0;
+	sf->ehdr.e_shstrndx = 0;
+	sf->changed = TRUE;
+    } else {
+	free(moves);
+    }
+    return TRUE;
+}
+
+/* movesegments() moves the blocks of the file's contents to the
+ * positions chosen by compactsegments().
+ */
+static int movesegments(sstripfile *sf)
+{
+    filemove const *m;
+    int		    i;
+
+    for (i = 0, m = sf->moves ; i < sf->movecount ; ++i, ++m)
+	if (m->delta)
+	    memmove(sf->image + m->from - m->delta, sf->image + m->from,
+		    m->to - m->from);
+    return TRUE;
+}
+
+/* lastnonzero() returns the length of the given buffer with any
+ * trailing zero bytes excluded. The buffer is examined from the end
+ * a block at a time, using vector registers where available, so that
+ * long runs of zeroes are skipped at memory speed.
+ */
+static unsigned long lastnonzero(unsigned char const *buf, unsigned long size)
+{
+#if defined __SSE2__
+    __m128i const      *p;
+    __m128i		v;
+
+    while (size && ((unsigned long)(buf + size) & 15))
+	if (buf[--size])
+	    return size + 1;
+    p = (__m128i const*)(buf + size);
+    for ( ; size >= 64 ; size -= 64) {
+	p -= 4;
+	v = _mm_or_si128(_mm_or_si128(_mm_load_si128(p),
+				      _mm_load_si128(p + 1)),
+			 _mm_or_si128(_mm_load_si128(p + 2),
+				      _mm_load_si128(p + 3)));
+	if (_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_setzero_si128()))
+								!= 0xFFFF)
+	    break;
+    }
+#else
+    unsigned long const *p;
+
+    while (size && ((unsigned long)(buf + size) & (sizeof *p - 1)))
+	if (buf[--size])
+	    return size + 1;
+    p = (unsigned long const*)(buf + size);
+    for ( ; size >= 4 * sizeof *p ; size -= 4 * sizeof *p) {
+	p -= 4;
+	if (p[0] | p[1] | p[2] | p[3])
+	    break;
+    }
+#endif
+
+    /* The last block examined, if any, contains a nonzero byte.
+     */
+    while (size && !buf[size - 1])
+	--size;
+    return size;
+}
+
+/* lastmovednonzero() returns the length of the file, once its blocks
+ * have been moved, with any trailing zero bytes excluded. The blocks
+ * and the gaps left between them are examined where they are now,
+ * starting from the end.
+ */
+static unsigned long lastmovednonzero(sstripfile const *sf)
+{
+    filemove const *m;
+    unsigned long   start, n;
+    int		    i;
+
+    for (i = sf->movecount - 1 ; i >= 0 ; --i) {
+	m = sf->moves + i;
+	if ((n = lastnonzero(sf->image + m->from, m->to - m->from)))
+	    return m->from - m->delta + n;
+	if (i == 0)
+	    break;
+	start = m[-1].to - m[-1].delta;
+	if ((n = lastnonzero(sf->image + start, m->from - m->delta - start)))
+	    return start + n;
+    }
+    return 0;
+}
+
 /* truncatezeros() examines the bytes at the end of the file's
  * size-to-be, and reduces the size to exclude any trailing zero
- * bytes.
+ * bytes. Only the end of the file is read.
  */
-static int truncatezeros(void)
+static int truncatezeros(sstripfile *sf)
 {
-    unsigned char contents[1024];
-    unsigned long size, n;
+    unsigned long size;
 
     if (!dozerotrunc)
 	return TRUE;
 
-    size = newsize;
-    do {
-	n = sizeof contents;
-	if (n > size)
-	    n = size;
-	if (fseek(thefile, size - n, SEEK_SET))
-	    return ferr("cannot seek in file.");
-	if (fread(contents, n, 1, thefile) != 1)
-	    return ferr("cannot read file contents");
-	while (n && !contents[--n])
-	    --size;
-    } while (size && !n);
+    if (sf->newsize > sf->size)
+	return err(sf, "program segments extend past the end of the file.");
+    if (sf->movecount)
+	size = lastmovednonzero(sf);
+    else
+	size = lastnonzero(sf->image, sf->newsize);
 
     /* Sanity check.
      */
     if (!size)
-	return err("ELF file is completely blank!");
+	return err(sf, "ELF file is completely blank!");
 
-    newsize = size;
+    sf->newsize = size;
     return TRUE;
 }
 
@@ -207,110 +527,1776 @@ static int truncatezeros(void)
  * it was stripped, and reduces program header table entries that
  * included truncated bytes at the end of the file.
  */
-static int modifyheaders(void)
+static int modifyheaders(sstripfile *sf)
 {
     int i;
 
     /* If the section header table is gone, then remove all references
      * to it in the ELF header.
      */
-    if (ehdr.e_shoff >= newsize) {
-	ehdr.e_shoff = 0;
-	ehdr.e_shnum = 0;
-	ehdr.e_shstrndx = 0;
+    if (sf->ehdr.e_shoff >= sf->newsize) {
+	if (sf->ehdr.e_shoff || sf->ehdr.e_shnum || sf->ehdr.e_shstrndx)
+	    sf->changed = TRUE;
+	sf->ehdr.e_shoff = 0;
+	sf->ehdr.e_shnum = 0;
+	sf->ehdr.e_shstrndx = 0;
     }
 
     /* The program adjusts the file size of any segment that was
      * truncated. The case of a segment being completely stripped out
      * is handled separately.
      */
-    for (i = 0 ; i < ehdr.e_phnum ; ++i) {
-	if (phdrs[i].p_offset >= newsize) {
-	    phdrs[i].p_offset = newsize;
-	    phdrs[i].p_filesz = 0;
-	} else if (phdrs[i].p_offset + phdrs[i].p_filesz > newsize) {
-	    phdrs[i].p_filesz = newsize - phdrs[i].p_offset;
+    for (i = 0 ; i < sf->ehdr.e_phnum ; ++i) {
+	if (sf->phdrs[i].p_offset >= sf->newsize) {
+	    if (sf->phdrs[i].p_offset != sf->newsize
+				|| sf->phdrs[i].p_filesz)
+		sf->changed = TRUE;
+	    sf->phdrs[i].p_offset = sf->newsize;
+	    sf->phdrs[i].p_filesz = 0;
+	} else if (sf->phdrs[i].p_offset + sf->phdrs[i].p_filesz
+							> sf->newsize) {
+	    sf->phdrs[i].p_filesz = sf->newsize - sf->phdrs[i].p_offset;
+	    sf->changed = TRUE;
 	}
     }
 
     return TRUE;
 }
 
-/* commitchanges() writes the new headers back to the original file
- * and sets the file to its new size.
+/* The largest number of bytes at the start of a stream that will be
+ * held in memory in order to find the program header table.
+ */
+#define	MAXHEADERSIZE	(16 * 1024 * 1024)
+
+/* The size of the buffer used to examine the contents of a stream.
+ */
+#define	STREAMCHUNK	65536
+
+/* readall() reads up to size bytes, stopping early only at the end of
+ * the file. The number of bytes read is returned, or -1 on error.
+ */
+static long readall(int fd, void *buf, unsigned long size)
+{
+    unsigned long   done;
+    ssize_t	    n;
+
+    for (done = 0 ; done < size ; done += n) {
+	n = read(fd, (char*)buf + done, size - done);
+	if (n < 0 && errno == EINTR)
+	    n = 0;
+	else if (n < 0)
+	    return -1;
+	else if (n == 0)
+	    break;
+    }
+    return done;
+}
+
+/* writeall() writes all of the given bytes, returning FALSE on error.
  */
-static int commitchanges(void)
+static int writeall(int fd, void const *buf, unsigned long size)
+{
+    ssize_t n;
+
+    for ( ; size ; size -= n, buf = (char const*)buf + n) {
+	n = write(fd, buf, size);
+	if (n < 0 && errno == EINTR)
+	    n = 0;
+	else if (n <= 0)
+	    return FALSE;
+    }
+    return TRUE;
+}
+
+/* copybytes() copies count bytes from one file descriptor to another,
+ * without passing them through user memory when possible. splice()
+ * is tried first if either side is a pipe, then copy_file_range() and
+ * sendfile(), and finally plain reads and writes. Each method
+ * is abandoned only if it fails before copying anything.
+ */
+static int copybytes(int in, int out, unsigned long count)
+{
+    char	    buf[STREAMCHUNK];
+    struct stat	    st;
+    unsigned long   start;
+    ssize_t	    n;
+    int		    method;
+
+    method = 1;
+    if ((!fstat(in, &st) && S_ISFIFO(st.st_mode))
+		|| (!fstat(out, &st) && S_ISFIFO(st.st_mode)))
+	method = 0;
+    for ( ; method < 3 && count ; ++method) {
+	start = count;
+	while (count) {
+	    if (method == 0)
+		n = splice(in, NULL, out, NULL, count, SPLICE_F_MOVE);
+	    else if (method == 1)
+		n = copy_file_range(in, NULL, out, NULL, count, 0);
+	    else
+		n = sendfile(out, in, NULL, count);
+	    if (n < 0 && errno == EINTR)
+		continue;
+	    if (n == 0)
+		return FALSE;
+	    if (n < 0)
+		break;
+	    count -= n;
+	}
+	if (count && (count != start || (errno != EINVAL && errno != ENOSYS
+					 && errno != EXDEV && errno != EBADF
+					 && errno != EOPNOTSUPP)))
+	    return FALSE;
+    }
+    while (count) {
+	n = readall(in, buf, count < sizeof buf ? count : sizeof buf);
+	if (n <= 0 || !writeall(out, buf, n))
+	    return FALSE;
+	count -= n;
+    }
+    return TRUE;
+}
+
+/* writeheader() stores the file's copy of a header, which is first
+ * translated into the file's format in a scratch buffer.
+ */
+static int writeheader(sstripfile *sf, unsigned long offset,
+		       void const *hdr, int count,
+		       int (*write)(FILE*, void const*, int))
+{
+    FILE   *fp;
+    char   *buf = NULL;
+    size_t  size = 0;
+    int	    r;
+
+    if (!(fp = open_memstream(&buf, &size)))
+	return FALSE;
+    r = write(fp, hdr, count) == count;
+    if (fclose(fp))
+	r = FALSE;
+    if (r && (offset > sf->size || size > sf->size - offset))
+	r = FALSE;
+    if (r)
+	memcpy(sf->image + offset, buf, size);
+    free(buf);
+    return r;
+}
+
+/* Wrappers to give the elfrw functions a common signature.
+ */
+static int writeehdr(FILE *fp, void const *hdr, int count)
+{
+    (void)count;
+    return elfrw_write_Ehdr(fp, hdr);
+}
+static int writephdrs(FILE *fp, void const *hdrs, int count)
+{
+    return elfrw_write_Phdrs(fp, hdrs, count);
+}
+
+/* clonefile() copies the first size bytes of one file to another. The
+ * whole file is cloned, sharing its storage, if the filesystem
+ * supports it. Otherwise the data is copied, by the kernel if
+ * possible.
+ */
+static int clonefile(int in, int out, unsigned long size)
+{
+    if (!ioctl(out, FICLONE, in))
+	return !ftruncate(out, size);
+    if (lseek(in, 0, SEEK_SET) || lseek(out, 0, SEEK_SET))
+	return FALSE;
+    return copybytes(in, out, size);
+}
+
+/* opentemp() creates a temporary file in the same directory as the
+ * given file, which will later replace it. The file's real path and
+ * the temporary file's name are returned in newly allocated strings.
+ * The return value is the temporary file's descriptor, or -1 on error.
+ */
+static int opentemp(sstripfile const *sf, char **path, char **tmpname)
+{
+    char   *p;
+    int	    fd;
+
+    if (!(*path = realpath(sf->filename, NULL)))
+	return err(sf, strerror(errno)), -1;
+    if (!(*tmpname = malloc(strlen(*path) + 16))) {
+	free(*path);
+	return err(sf, "Out of memory!"), -1;
+    }
+    p = strrchr(*path, '/');
+    sprintf(*tmpname, "%.*s/.%s.XXXXXX", (int)(p - *path), *path, p + 1);
+    if ((fd = mkstemp(*tmpname)) < 0) {
+	err(sf, strerror(errno));
+	free(*tmpname);
+	free(*path);
+    }
+    return fd;
+}
+
+/* closetemp() finishes a temporary file created by opentemp(). If ok
+ * is TRUE, the file is given the original's ownership and permissions
+ * and renamed over the original; otherwise it is removed. The strings
+ * are freed in either case.
+ */
+static int closetemp(sstripfile const *sf, int fd, char *path, char *tmpname,
+		     int ok)
+{
+    if (ok && fchown(fd, sf->st.st_uid, sf->st.st_gid) && errno != EPERM)
+	ok = err(sf, strerror(errno));
+    if (ok && fchmod(fd, sf->st.st_mode & 07777))
+	ok = err(sf, strerror(errno));
+    if (close(fd) && ok)
+	ok = err(sf, strerror(errno));
+    if (ok && rename(tmpname, path))
+	ok = err(sf, strerror(errno));
+    if (!ok)
+	unlink(tmpname);
+    free(tmpname);
+    free(path);
+    return ok;
+}
+
+/* writecopy() writes the stripped file as a new file in the same
+ * directory, with the same ownership and permissions, and renames it
+ * over the original. The contents are cloned from the original, and
+ * only the modified headers, and any contents that were moved, are
+ * then written out.
+ */
+static int writecopy(sstripfile *sf)
+{
+    char	   *path, *tmpname;
+    unsigned long   n;
+    int		    fd;
+
+    if ((fd = opentemp(sf, &path, &tmpname)) < 0)
+	return FALSE;
+    n = sf->ehdr.e_phnum * sf->ehdr.e_phentsize;
+    if (!clonefile(sf->fd, fd, sf->newsize)
+		|| (sf->movedfrom && sf->movedfrom < sf->newsize
+		    && pwrite(fd, sf->image + sf->movedfrom,
+			      sf->newsize - sf->movedfrom, sf->movedfrom)
+				!= (ssize_t)(sf->newsize - sf->movedfrom))
+		|| pwrite(fd, sf->image, sf->ehdr.e_ehsize, 0)
+				!= (ssize_t)sf->ehdr.e_ehsize
+		|| pwrite(fd, sf->image + sf->ehdr.e_phoff, n,
+			  sf->ehdr.e_phoff) != (ssize_t)n) {
+	err(sf, errno ? strerror(errno) : "could not write to file");
+	return closetemp(sf, fd, path, tmpname, FALSE);
+    }
+    return closetemp(sf, fd, path, tmpname, TRUE);
+}
+
+/* commitchanges() writes the new headers back to the mapped file and
+ * sets the file to its new size, or writes out a replacement file in
+ * safe mode.
+ */
+static int commitchanges(sstripfile *sf)
 {
     size_t n;
 
     /* Save the changes to the ELF header, if any.
      */
-    if (fseek(thefile, 0, SEEK_SET))
-	return ferr("could not rewind file");
-    if (!elfrw_write_Ehdr(thefile, &ehdr))
-	return ferr("could not modify file");
+    if (!writeheader(sf, 0, &sf->ehdr, 1, writeehdr))
+	return err(sf, "could not modify file");
 
     /* Save the changes to the program segment header table, if any.
      */
-    if (fseek(thefile, ehdr.e_phoff, SEEK_SET)) {
-	ferr("could not seek in file");
-	goto warning;
-    }
-    if (elfrw_write_Phdrs(thefile, phdrs, ehdr.e_phnum) != ehdr.e_phnum) {
-	ferr("could not write to file");
+    if (!writeheader(sf, sf->ehdr.e_phoff, sf->phdrs, sf->ehdr.e_phnum,
+		     writephdrs)) {
+	err(sf, "could not write to file");
 	goto warning;
     }
 
     /* Eleventh-hour sanity check: don't truncate before the end of
      * the program segment header table.
      */
-    n = ehdr.e_phnum * ehdr.e_phentsize;
-    if (newsize < ehdr.e_phoff + n)
-	newsize = ehdr.e_phoff + n;
+    n = sf->ehdr.e_phnum * sf->ehdr.e_phentsize;
+    if (sf->newsize < sf->ehdr.e_phoff + n)
+	sf->newsize = sf->ehdr.e_phoff + n;
+
+    if (safemode)
+	return writecopy(sf);
 
     /* Chop off the end of the file.
      */
-    if (ftruncate(fileno(thefile), newsize)) {
-	err(errno ? strerror(errno) : "could not resize file");
+    if (sf->newsize != sf->size && ftruncate(sf->fd, sf->newsize)) {
+	err(sf, errno ? strerror(errno) : "could not resize file");
 	goto warning;
     }
 
     return TRUE;
 
   warning:
-    return err("ELF file may have been corrupted!");
+    return err(sf, "ELF file may have been corrupted!");
 }
 
-/* main() loops over the cmdline arguments, leaving all the real work
- * to the other functions.
+/* openfile() maps the named file into memory, and opens a stream for
+ * reading the headers from the mapping. In safe mode, or for a dry
+ * run, the mapping is private, so that changes to it never reach the
+ * original file. (Only the pages that are actually examined are ever
+ * read in.)
  */
-int main(int argc, char *argv[])
+static int openfile(sstripfile *sf)
 {
-    int failures = 0;
-    int i;
+    sf->fd = open(sf->filename, safemode || dryrun ? O_RDONLY : O_RDWR);
+    if (sf->fd < 0)
+	return err(sf, strerror(errno));
+    if (fstat(sf->fd, &sf->st)) {
+	err(sf, strerror(errno));
+	goto failure;
+    }
+    if (!S_ISREG(sf->st.st_mode) || sf->st.st_size == 0) {
+	err(sf, "not a valid ELF file");
+	goto failure;
+    }
+    sf->size = sf->st.st_size;
+    sf->image = mmap(NULL, sf->size, PROT_READ | PROT_WRITE,
+		     safemode || dryrun ? MAP_PRIVATE : MAP_SHARED, sf->fd, 0);
+    if (sf->image == MAP_FAILED) {
+	err(sf, strerror(errno));
+	goto failure;
+    }
+    if (!(sf->fp = fmemopen(sf->image, sf->size, "rb"))) {
+	err(sf, strerror(errno));
+	munmap(sf->image, sf->size);
+	goto failure;
+    }
+    return TRUE;
 
-    readcmdline(argc, argv);
+  failure:
+    close(sf->fd);
+    return FALSE;
+}
+
+/* closefile() releases the current file.
+ */
+static void closefile(sstripfile *sf)
+{
+    fclose(sf->fp);
+    munmap(sf->image, sf->size);
+    close(sf->fd);
+}
+
+/* copynonzero() copies count bytes from one file descriptor to a
+ * seekable one, holding back each run of zero bytes until a nonzero
+ * byte follows it. (The held-back bytes are skipped over, which also
+ * lets the filesystem leave holes.) The length of the final run of
+ * zero bytes, which is never written out, is returned in *zeros.
+ */
+static int copynonzero(int in, int out, unsigned long count,
+		       unsigned long *zeros)
+{
+    unsigned char   buf[STREAMCHUNK];
+    unsigned long   n, m;
+    long	    r;
+
+    *zeros = 0;
+    while (count) {
+	r = readall(in, buf, count < sizeof buf ? count : sizeof buf);
+	if (r <= 0)
+	    return FALSE;
+	n = r;
+	count -= n;
+	m = lastnonzero(buf, n);
+	if (!m) {
+	    *zeros += n;
+	    continue;
+	}
+	if (*zeros && lseek(out, *zeros, SEEK_CUR) < 0)
+	    return FALSE;
+	if (!writeall(out, buf, m))
+	    return FALSE;
+	*zeros = n - m;
+    }
+    return TRUE;
+}
+
+/* lastnonzeroat() finds the end of the nonzero contents of the given
+ * part of a seekable file, reading it backwards a chunk at a time.
+ * The return value is zero if the area is entirely zero bytes, or -1
+ * on error.
+ */
+static long lastnonzeroat(int fd, unsigned long offset, unsigned long size)
+{
+    unsigned char   buf[STREAMCHUNK];
+    unsigned long   n, m;
+
+    while (size) {
+	n = size < sizeof buf ? size : sizeof buf;
+	if (pread(fd, buf, n, offset + size - n) != (ssize_t)n)
+	    return -1;
+	m = lastnonzero(buf, n);
+	if (m)
+	    return size - n + m;
+	size -= n;
+    }
+    return 0;
+}
+
+/* discardrest() reads and discards whatever remains on a stream, so
+ * that the process writing to it is not cut off. The data is spliced
+ * directly to the null device, if possible.
+ */
+static void discardrest(int in)
+{
+    char	buf[STREAMCHUNK];
+    struct stat	st;
+    ssize_t	n;
+    int		fd;
+
+    if (fstat(in, &st) || S_ISREG(st.st_mode))
+	return;
+    if ((fd = open("/dev/null", O_WRONLY)) >= 0) {
+	while ((n = splice(in, NULL, fd, NULL, 1 << 20, SPLICE_F_MOVE)) > 0) ;
+	close(fd);
+    }
+    while (readall(in, buf, sizeof buf) > 0) ;
+}
+
+/* readstreamheaders() reads the beginning of an ELF file from a
+ * stream, up through the end of its program header table, and parses
+ * the headers. Only this part of the file is held in memory.
+ */
+static int readstreamheaders(sstripfile *sf)
+{
+    unsigned long   size;
+    long	    n;
+
+    if (!(sf->image = malloc(sizeof(Elf64_Ehdr))))
+	return err(sf, "Out of memory!");
+    if ((n = readall(sf->fd, sf->image, sizeof(Elf64_Ehdr))) < 0)
+	return err(sf, strerror(errno));
+    sf->size = n;
+    if (!n || !(sf->fp = fmemopen(sf->image, sf->size, "rb")))
+	return err(sf, "not a valid ELF file");
+    if (!readelfheader(sf))
+	return FALSE;
+    fclose(sf->fp);
+    sf->fp = NULL;
+
+    size = sf->ehdr.e_phoff + sf->ehdr.e_phnum * sf->ehdr.e_phentsize;
+    if (size > MAXHEADERSIZE)
+	return err(sf, "program header table is too far into the file.");
+    if (size > sf->size) {
+	if (!(sf->image = realloc(sf->image, size)))
+	    return err(sf, "Out of memory!");
+	if ((n = readall(sf->fd, sf->image + sf->size, size - sf->size)) < 0)
+	    return err(sf, strerror(errno));
+	sf->size += n;
+    }
+    if (!(sf->fp = fmemopen(sf->image, sf->size, "rb")))
+	return err(sf, strerror(errno));
+    return readphdrtable(sf);
+}
+
+/* stripstream() strips an ELF file read from standard input, writing
+ * the result to standard output. The file's headers are held in
+ * memory, the contents up to the new end of the file are copied
+ * across, and the remainder is discarded. Trailing zero bytes are
+ * found by reading backwards if the input is seekable. Otherwise, if
+ * the output is seekable, the zero bytes are held back as they pass
+ * by, and the headers are rewritten once the new size is known. An
+ * output opened for appending cannot be written out of order, and so
+ * is treated as unseekable.
+ */
+static int stripstream(void)
+{
+    sstripfile	    sf;
+    unsigned long   zeros, n;
+    long	    m;
+    off_t	    inpos, outpos;
+    struct stat	    st;
+    int		    scanin, scanout, r = FALSE;
+
+    memset(&sf, 0, sizeof sf);
+    sf.filename = "-";
+    sf.fd = STDIN_FILENO;
+    inpos = lseek(STDIN_FILENO, 0, SEEK_CUR);
+    outpos = lseek(STDOUT_FILENO, 0, SEEK_CUR);
+    if (outpos >= 0 && (fcntl(STDOUT_FILENO, F_GETFL) & O_APPEND))
+	outpos = -1;
+    if (!readstreamheaders(&sf) || !getmemorysize(&sf))
+	goto quit;
+
+    scanin = scanout = FALSE;
+    if (dozerotrunc) {
+	if (inpos >= 0 && !fstat(STDIN_FILENO, &st) && S_ISREG(st.st_mode))
+	    scanin = TRUE;
+	else if (outpos >= 0 && !fstat(STDOUT_FILENO, &st)
+			     && S_ISREG(st.st_mode))
+	    scanout = TRUE;
+	else
+	    err(&sf, "neither input nor output is seekable; "
+		     "not discarding trailing zero bytes.");
+    }
+
+    if (scanin) {
+	if ((unsigned long)(st.st_size - inpos) < sf.newsize) {
+	    err(&sf, "program segments extend past the end of the file.");
+	    goto quit;
+	}
+	if ((m = lastnonzeroat(STDIN_FILENO, inpos, sf.newsize)) < 0) {
+	    err(&sf, strerror(errno));
+	    goto quit;
+	}
+	if (!m) {
+	    err(&sf, "ELF file is completely blank!");
+	    goto quit;
+	}
+	sf.newsize = m;
+    }
+
+    /* Unless the size will only be known after the contents have been
+     * copied, the headers can be finalized now.
+     */
+    if (!scanout && !modifyheaders(&sf))
+	goto quit;
+    n = sf.ehdr.e_phoff + sf.ehdr.e_phnum * sf.ehdr.e_phentsize;
+    if (sf.newsize < n)
+	sf.newsize = n;
+    if (!writeheader(&sf, 0, &sf.ehdr, 1, writeehdr)
+		|| !writeheader(&sf, sf.ehdr.e_phoff, sf.phdrs,
+				sf.ehdr.e_phnum, writephdrs)) {
+	err(&sf, "could not write the headers.");
+	goto quit;
+    }
+    n = sf.size < sf.newsize ? sf.size : sf.newsize;
+    if (!writeall(STDOUT_FILENO, sf.image, n)) {
+	err(&sf, strerror(errno));
+	goto quit;
+    }
+
+    if (!scanout) {
+	if (sf.newsize > n && !copybytes(STDIN_FILENO, STDOUT_FILENO,
+					 sf.newsize - n)) {
+	    err(&sf, errno ? strerror(errno) : "unexpected end of file.");
+	    goto quit;
+	}
+	r = TRUE;
+	goto quit;
+    }
+
+    /* Copy the contents while watching for zero bytes, then go back
+     * and fill in the headers.
+     */
+    zeros = 0;
+    if (sf.newsize > n && !copynonzero(STDIN_FILENO, STDOUT_FILENO,
+				       sf.newsize - n, &zeros)) {
+	err(&sf, errno ? strerror(errno) : "unexpected end of file.");
+	goto quit;
+    }
+    if (zeros == sf.newsize - n)
+	sf.newsize = lastnonzero(sf.image, n);
+    else
+	sf.newsize -= zeros;
+    if (!sf.newsize) {
+	err(&sf, "ELF file is completely blank!");
+	goto quit;
+    }
+    modifyheaders(&sf);
+    n = sf.ehdr.e_phoff + sf.ehdr.e_phnum * sf.ehdr.e_phentsize;
+    if (sf.newsize < n)
+	sf.newsize = n;
+    if (!writeheader(&sf, 0, &sf.ehdr, 1, writeehdr)
+		|| !writeheader(&sf, sf.ehdr.e_phoff, sf.phdrs,
+				sf.ehdr.e_phnum, writephdrs)) {
+	err(&sf, "could not write the headers.");
+	goto quit;
+    }
+    n = sf.size < sf.newsize ? sf.size : sf.newsize;
+    if (pwrite(STDOUT_FILENO, sf.image, n, outpos) != (ssize_t)n
+		|| ftruncate(STDOUT_FILENO, outpos + sf.newsize)) {
+	err(&sf, strerror(errno));
+	goto quit;
+    }
+    r = TRUE;
+
+  quit:
+    discardrest(STDIN_FILENO);
+    if (sf.fp)
+	fclose(sf.fp);
+    free(sf.image);
+    free(sf.phdrs);
+    return r;
+}
+
+/* reportchanges() is used in place of commitchanges() for a dry run,
+ * and reports what would have been done to the file. The totals are
+ * updated as well.
+ */
+static int reportchanges(sstripfile *sf, progress *prog)
+{
+    unsigned long n;
+
+    n = sf->ehdr.e_phoff + sf->ehdr.e_phnum * sf->ehdr.e_phentsize;
+    if (sf->newsize < n)
+	sf->newsize = n;
+    if (sf->newsize != sf->size)
+	sf->changed = TRUE;
+
+    printf("%lu\t%lu\t%ld\t%s\t%s\n", sf->size, sf->newsize,
+	   (long)(sf->size - sf->newsize), sf->changed ? "yes" : "no",
+	   sf->filename);
+    fflush(stdout);
+
+    __atomic_fetch_add(&prog->oldbytes, sf->size, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&prog->newbytes, sf->newsize, __ATOMIC_RELAXED);
+    if (sf->changed)
+	__atomic_fetch_add(&prog->modified, 1, __ATOMIC_RELAXED);
+    return TRUE;
+}
+
+/*
+ * Relocatable objects and static archives.
+ */
+
+/* A growable string table.
+ */
+typedef struct strtable {
+    char	   *buf;	/* the contents of the table */
+    unsigned long   size;	/* the current size of the table */
+    unsigned long   alloc;	/* the allocated size of buf */
+} strtable;
+
+/* A string to be placed in a string table, and the offset that it is
+ * given there.
+ */
+typedef struct strentry {
+    char const	   *str;	/* the string */
+    unsigned long   len;	/* the length of the string */
+    unsigned long   off;	/* the string's offset within the table */
+} strentry;
+
+/* Information for each relocatable object operated upon.
+ */
+typedef struct objfile {
+    sstripfile const *sf;	/* the file (for reporting errors) */
+    unsigned char const *image;	/* the object's contents */
+    unsigned long   size;	/* the size of the object */
+    FILE	   *fp;		/* a stream reading from image */
+    Elf64_Ehdr	    ehdr;	/* the object's ELF header */
+    Elf64_Shdr	   *shdrs;	/* the section header table */
+    int		   *secmap;	/* each section's new index, or zero */
+    int		    symtab;	/* the symbol table's index, or zero */
+    int		    strtab;	/* the symbol names' index, or zero */
+    Elf64_Sym	   *syms;	/* the symbol table */
+    int		    symcount;	/* the number of symbols */
+    int		   *symmap;	/* each symbol's new index, or -1 */
+    int		    newlocals;	/* the number of local symbols kept */
+} objfile;
+
+/* addstring() appends a string to a string table, returning its
+ * offset within the table.
+ */
+static unsigned long addstring(strtable *tab, char const *str)
+{
+    unsigned long n, off;
+
+    n = strlen(str) + 1;
+    if (tab->size + n > tab->alloc) {
+	tab->alloc = 2 * tab->alloc + n + 1024;
+	if (!(tab->buf = realloc(tab->buf, tab->alloc))) {
+	    fputs("Out of memory!\n", stderr);
+	    exit(EXIT_FAILURE);
+	}
+    }
+    off = tab->size;
+    memcpy(tab->buf + off, str, n);
+    tab->size += n;
+    return off;
+}
+
+/* suffixsorter() is passed to qsort() to sort strings by comparing
+ * them backwards, so that a string is followed by the strings that
+ * end with it.
+ */
+static int suffixsorter(void const *a, void const *b)
+{
+    strentry const *sa = *(strentry const* const*)a;
+    strentry const *sb = *(strentry const* const*)b;
+    unsigned long   i = sa->len, j = sb->len;
+
+    while (i && j) {
+	--i;
+	--j;
+	if (sa->str[i] != sb->str[j])
+	    return (unsigned char)sa->str[i] - (unsigned char)sb->str[j];
+    }
+    return i ? 1 : j ? -1 : 0;
+}
+
+/* buildstrtable() creates a string table holding the given strings,
+ * and sets the offset of each one. A string that is the tail end of
+ * another, such as .text.foo and .rela.text.foo, is stored only once.
+ */
+static int buildstrtable(strtable *tab, strentry *entries, int count)
+{
+    strentry	  **order;
+    strentry const *prev = NULL;
+    int		    i, n;
+
+    if (!(order = malloc((count + 1) * sizeof *order)))
+	return FALSE;
+    addstring(tab, "");
+    for (i = 0, n = 0 ; i < count ; ++i) {
+	entries[i].len = strlen(entries[i].str);
+	entries[i].off = 0;
+	if (entries[i].len)
+	    order[n++] = entries + i;
+    }
+    qsort(order, n, sizeof *order, suffixsorter);
+    while (n--) {
+	if (prev && prev->len >= order[n]->len
+		 && !memcmp(prev->str + prev->len - order[n]->len,
+			    order[n]->str, order[n]->len))
+	    order[n]->off = prev->off + prev->len - order[n]->len;
+	else
+	    order[n]->off = addstring(tab, order[n]->str);
+	prev = order[n];
+    }
+    free(order);
+    return TRUE;
+}
+
+/* getobjstring() returns a string from one of the object's string
+ * tables, or an empty string if the reference is invalid.
+ */
+static char const *getobjstring(objfile const *obj, int shndx,
+				unsigned long off)
+{
+    Elf64_Shdr const *shdr;
+
+    if (shndx <= 0 || shndx >= obj->ehdr.e_shnum)
+	return "";
+    shdr = obj->shdrs + shndx;
+    if (shdr->sh_type != SHT_STRTAB || off >= shdr->sh_size)
+	return "";
+    if (!memchr(obj->image + shdr->sh_offset + off, '\0',
+		shdr->sh_size - off))
+	return "";
+    return (char const*)obj->image + shdr->sh_offset + off;
+}
+
+/* sectionname() returns the name of one of the object's sections.
+ */
+static char const *sectionname(objfile const *obj, int shndx)
+{
+    return getobjstring(obj, obj->ehdr.e_shstrndx,
+			obj->shdrs[shndx].sh_name);
+}
+
+/* freeobject() releases the memory used to examine an object.
+ */
+static void freeobject(objfile *obj)
+{
+    if (obj->fp)
+	fclose(obj->fp);
+    free(obj->shdrs);
+    free(obj->secmap);
+    free(obj->syms);
+    free(obj->symmap);
+}
+
+/* readobject() reads the headers and the symbol table of a relocatable
+ * object, and checks that it is one that can be stripped.
+ */
+static int readobject(objfile *obj)
+{
+    Elf64_Shdr *shdr;
+    int		i, n;
+
+    if (!(obj->fp = fmemopen((void*)obj->image, obj->size, "rb")))
+	return err(obj->sf, strerror(errno));
+    if (elfrw_read_Ehdr(obj->fp, &obj->ehdr) != 1)
+	return err(obj->sf, "not a valid ELF file");
+    if (obj->ehdr.e_type != ET_REL)
+	return err(obj->sf, "not a relocatable object.");
+    n = obj->ehdr.e_shnum;
+    if (!obj->ehdr.e_shoff || !n || obj->ehdr.e_shstrndx >= n)
+	return err(obj->sf, "missing or unsupported section header table.");
+
+    if (!(obj->shdrs = calloc(n, sizeof *obj->shdrs))
+		|| !(obj->secmap = calloc(n, sizeof *obj->secmap)))
+	return err(obj->sf, "Out of memory!");
+    if (fseek(obj->fp, obj->ehdr.e_shoff, SEEK_SET)
+		|| elfrw_read_Shdrs(obj->fp, obj->shdrs, n) != n)
+	return err(obj->sf, "missing or incomplete section header table.");
+
+    for (i = 1 ; i < n ; ++i) {
+	shdr = obj->shdrs + i;
+	if (shdr->sh_type != SHT_NOBITS && (shdr->sh_offset > obj->size
+			|| shdr->sh_size > obj->size - shdr->sh_offset))
+	    return err(obj->sf, "section extends past the end of the file.");
+	if (shdr->sh_type == SHT_SYMTAB_SHNDX)
+	    return err(obj->sf, "extended section indexes are not supported.");
+	if (shdr->sh_type == SHT_SYMTAB) {
+	    if (obj->symtab)
+		return err(obj->sf, "more than one symbol table.");
+	    obj->symtab = i;
+	}
+    }
+    if (!obj->symtab)
+	return TRUE;
+
+    shdr = obj->shdrs + obj->symtab;
+    obj->strtab = shdr->sh_link;
+    if (obj->strtab <= 0 || obj->strtab >= n
+			 || obj->strtab == obj->ehdr.e_shstrndx)
+	return err(obj->sf, "unsupported symbol name table.");
+    obj->symcount = elfrw_count_Syms(shdr->sh_size);
+    if (!(obj->syms = calloc(obj->symcount + 1, sizeof *obj->syms))
+		|| !(obj->symmap = calloc(obj->symcount + 1,
+					  sizeof *obj->symmap)))
+	return err(obj->sf, "Out of memory!");
+    if (fseek(obj->fp, shdr->sh_offset, SEEK_SET)
+		|| elfrw_read_Syms(obj->fp, obj->syms, obj->symcount)
+							!= obj->symcount)
+	return err(obj->sf, "invalid symbol table.");
+    for (i = 0 ; i < obj->symcount ; ++i)
+	if ((ELF64_ST_BIND(obj->syms[i].st_info) == STB_LOCAL)
+				!= (i < (int)shdr->sh_info))
+	    return err(obj->sf, "invalid symbol table.");
+    return TRUE;
+}
+
+/* isdiscardable() returns TRUE if a section, judging by its name, can
+ * be removed from a relocatable object. One .note.GNU-stack section
+ * is always retained, since without one the linker assumes that the
+ * object needs an executable stack.
+ */
+static int isdiscardable(char const *name, int *seenstacknote)
+{
+    if (!strcmp(name, ".comment"))
+	return TRUE;
+    if (!strncmp(name, ".debug", 6) || !strncmp(name, ".zdebug", 7))
+	return TRUE;
+    if (!strcmp(name, ".note.GNU-stack")) {
+	if (*seenstacknote)
+	    return TRUE;
+	*seenstacknote = TRUE;
+    }
+    return FALSE;
+}
+
+/* getreloccount() returns the number of entries in a relocation
+ * section.
+ */
+static unsigned long getreloccount(Elf64_Shdr const *shdr)
+{
+    return shdr->sh_entsize ? shdr->sh_size / shdr->sh_entsize : 0;
+}
+
+/* readreloc() reads one relocation from a relocation section. The
+ * addend is set to zero for a section with no addends.
+ */
+static int readreloc(objfile *obj, Elf64_Shdr const *shdr, Elf64_Rela *rela)
+{
+    Elf64_Rel rel;
+
+    if (shdr->sh_type == SHT_RELA)
+	return elfrw_read_Rela(obj->fp, rela) == 1;
+    if (elfrw_read_Rel(obj->fp, &rel) != 1)
+	return FALSE;
+    rela->r_offset = rel.r_offset;
+    rela->r_info = rel.r_info;
+    rela->r_addend = 0;
+    return TRUE;
+}
+
+/* readgroup() reads a section group into a newly allocated array. The
+ * first entry is the group's flags, and the rest are the indexes of
+ * the member sections.
+ */
+static Elf64_Word *readgroup(objfile *obj, int shndx, int *count)
+{
+    Elf64_Shdr const   *shdr = obj->shdrs + shndx;
+    Elf64_Word	       *words;
+    int			i;
+
+    *count = shdr->sh_size / 4;
+    if (!*count || !(words = malloc(*count * sizeof *words)))
+	return NULL;
+    if (fseek(obj->fp, shdr->sh_offset, SEEK_SET))
+	goto failure;
+    for (i = 0 ; i < *count ; ++i)
+	if (elfrw_read_Word(obj->fp, words + i) != 1
+			|| (i && words[i] >= obj->ehdr.e_shnum))
+	    goto failure;
+    return words;
+
+  failure:
+    free(words);
+    return NULL;
+}
+
+/* planobject() decides which sections and symbols will be kept, and
+ * assigns their new indexes. Debugging sections, comments and extra
+ * stack notes are dropped, along with their relocations, and so are
+ * local symbols that nothing refers to. FALSE is returned if the
+ * object cannot be stripped safely. *changed is set to TRUE if there
+ * is anything to remove.
+ */
+static int planobject(objfile *obj, int *changed)
+{
+    Elf64_Shdr const   *shdr;
+    Elf64_Word	       *members;
+    Elf64_Rela		rela;
+    unsigned long	r;
+    int			seenstacknote = FALSE;
+    int			n, i, j, count;
+
+    n = obj->ehdr.e_shnum;
+    for (i = 1 ; i < n ; ++i)
+	obj->secmap[i] = !isdiscardable(sectionname(obj, i), &seenstacknote);
+    for (i = 1 ; i < n ; ++i) {
+	shdr = obj->shdrs + i;
+	if ((shdr->sh_type == SHT_REL || shdr->sh_type == SHT_RELA)
+			&& shdr->sh_info < (unsigned)n
+			&& !obj->secmap[shdr->sh_info])
+	    obj->secmap[i] = 0;
+    }
+
+    /* A group is dropped if all of its members are being dropped.
+     */
+    for (i = 1 ; i < n ; ++i) {
+	if (obj->shdrs[i].sh_type != SHT_GROUP || !obj->secmap[i])
+	    continue;
+	if (!(members = readgroup(obj, i, &count)))
+	    return err(obj->sf, "invalid section group.");
+	for (j = 1 ; j < count && !obj->secmap[members[j]] ; ++j) ;
+	if (j == count)
+	    obj->secmap[i] = 0;
+	free(members);
+    }
+
+    /* It is not safe to go on if a section that is kept refers to one
+     * that is dropped, or refers to symbols in an unknown way.
+     */
+    for (i = 1 ; i < n ; ++i) {
+	shdr = obj->shdrs + i;
+	if (!obj->secmap[i])
+	    continue;
+	if (shdr->sh_link && shdr->sh_link < (unsigned)n
+			  && !obj->secmap[shdr->sh_link])
+	    return err(obj->sf, "a kept section refers to a removed one.");
+	if (obj->symtab && (int)shdr->sh_link == obj->symtab
+			&& shdr->sh_type != SHT_REL
+			&& shdr->sh_type != SHT_RELA
+			&& shdr->sh_type != SHT_GROUP)
+	    return err(obj->sf, "unsupported section refers to symbols.");
+    }
+
+    /* Mark the symbols that are still needed: the global symbols, and
+     * the local symbols that the kept sections refer to.
+     */
+    for (i = 1 ; i < n && obj->symtab ; ++i) {
+	shdr = obj->shdrs + i;
+	if (!obj->secmap[i] || (int)shdr->sh_link != obj->symtab)
+	    continue;
+	if (shdr->sh_type == SHT_GROUP) {
+	    if (shdr->sh_info >= (unsigned)obj->symcount)
+		return err(obj->sf, "invalid section group.");
+	    obj->symmap[shdr->sh_info] = 1;
+	    continue;
+	}
+	if (fseek(obj->fp, shdr->sh_offset, SEEK_SET))
+	    return err(obj->sf, "invalid relocation section.");
+	for (r = getreloccount(shdr) ; r ; --r) {
+	    if (!readreloc(obj, shdr, &rela)
+		    || ELF64_R_SYM(rela.r_info) >= (unsigned)obj->symcount)
+		return err(obj->sf, "invalid relocation section.");
+	    obj->symmap[ELF64_R_SYM(rela.r_info)] = 1;
+	}
+    }
+    for (i = 0, j = 0 ; i < obj->symcount ; ++i) {
+	if (i == 0 || ELF64_ST_BIND(obj->syms[i].st_info) != STB_LOCAL)
+	    obj->symmap[i] = 1;
+	if (!obj->symmap[i]) {
+	    obj->symmap[i] = -1;
+	    *changed = TRUE;
+	    continue;
+	}
+	count = obj->syms[i].st_shndx;
+	if (count > 0 && count < SHN_LORESERVE
+		      && (count >= n || !obj->secmap[count]))
+	    return err(obj->sf, "a kept symbol is in a removed section.");
+	obj->symmap[i] = j++;
+	if (ELF64_ST_BIND(obj->syms[i].st_info) == STB_LOCAL)
+	    obj->newlocals = j;
+    }
+
+    for (i = 1, j = 1 ; i < n ; ++i) {
+	if (obj->secmap[i])
+	    obj->secmap[i] = j++;
+	else
+	    *changed = TRUE;
+    }
+    return TRUE;
+}
+
+/* buildsection() creates the new contents of a section that refers to
+ * symbol or section indexes, in a newly allocated buffer. symnames
+ * gives the new offsets of the symbol names.
+ */
+static int buildsection(objfile *obj, int shndx, strentry const *symnames,
+			char **buf, size_t *size)
+{
+    Elf64_Shdr const   *shdr = obj->shdrs + shndx;
+    Elf64_Word	       *members;
+    Elf64_Word		w;
+    Elf64_Rela		rela;
+    Elf64_Rel		rel;
+    Elf64_Sym		sym;
+    unsigned long	r;
+    FILE	       *out;
+    int			ok = TRUE;
+    int			i, count;
+
+    if (!(out = open_memstream(buf, size)))
+	return FALSE;
+    if (shdr->sh_type == SHT_SYMTAB) {
+	for (i = 0 ; i < obj->symcount && ok ; ++i) {
+	    if (obj->symmap[i] < 0)
+		continue;
+	    sym = obj->syms[i];
+	    sym.st_name = symnames[i].off;
+	    if (sym.st_shndx > 0 && sym.st_shndx < SHN_LORESERVE)
+		sym.st_shndx = obj->secmap[sym.st_shndx];
+	    ok = elfrw_write_Sym(out, &sym) == 1;
+	}
+    } else if (shdr->sh_type == SHT_GROUP) {
+	if ((members = readgroup(obj, shndx, &count))) {
+	    ok = elfrw_write_Word(out, members) == 1;
+	    for (i = 1 ; i < count && ok ; ++i) {
+		if (!(w = obj->secmap[members[i]]))
+		    continue;
+		ok = elfrw_write_Word(out, &w) == 1;
+	    }
+	    free(members);
+	} else {
+	    ok = FALSE;
+	}
+    } else {
+	ok = !fseek(obj->fp, shdr->sh_offset, SEEK_SET);
+	for (r = getreloccount(shdr) ; r && ok ; --r) {
+	    ok = readreloc(obj, shdr, &rela);
+	    rela.r_info = ELF64_R_INFO(obj->symmap[ELF64_R_SYM(rela.r_info)],
+				       ELF64_R_TYPE(rela.r_info));
+	    if (shdr->sh_type == SHT_RELA) {
+		ok = ok && elfrw_write_Rela(out, &rela) == 1;
+	    } else {
+		rel.r_offset = rela.r_offset;
+		rel.r_info = rela.r_info;
+		ok = ok && elfrw_write_Rel(out, &rel) == 1;
+	    }
+	}
+    }
+    if (fclose(out))
+	ok = FALSE;
+    if (!ok) {
+	free(*buf);
+	*buf = NULL;
+    }
+    return ok;
+}
+
+/* writezeros() writes the given number of zero bytes to a stream.
+ */
+static int writezeros(FILE *fp, unsigned long count)
+{
+    static char const zeros[4096];
+    unsigned long     n;
 
-    for (i = optind ; i < argc ; ++i)
-    {
-	thefilename = argv[i];
-	thefile = fopen(thefilename, "r+");
-	if (!thefile) {
-	    err(strerror(errno));
-	    ++failures;
+    for ( ; count ; count -= n) {
+	n = count < sizeof zeros ? count : sizeof zeros;
+	if (fwrite(zeros, n, 1, fp) != 1)
+	    return FALSE;
+    }
+    return TRUE;
+}
+
+/* writeobject() creates the stripped object in a newly allocated
+ * buffer. The sections keep their original order and alignment, and
+ * the section header table is placed at the end.
+ */
+static int writeobject(objfile *obj, char **outbuf, size_t *outsize)
+{
+    Elf64_Shdr	   *newshdrs;
+    Elf64_Ehdr	    ehdr;
+    Elf64_Shdr	   *shdr;
+    strtable	    shnames = { NULL, 0, 0 };
+    strtable	    symnames = { NULL, 0, 0 };
+    strentry	   *shentries, *symentries;
+    char	  **bufs;
+    FILE	   *out;
+    unsigned long   pos, align;
+    size_t	    size;
+    int		    n, newn, i, j, ok = TRUE;
+
+    n = obj->ehdr.e_shnum;
+    newshdrs = calloc(n, sizeof *newshdrs);
+    bufs = calloc(n, sizeof *bufs);
+    shentries = calloc(n, sizeof *shentries);
+    symentries = calloc(obj->symcount + 1, sizeof *symentries);
+    if (!newshdrs || !bufs || !shentries || !symentries) {
+	ok = err(obj->sf, "Out of memory!");
+	n = 0;
+	goto quit;
+    }
+
+    /* Build the new string tables first, so that their sizes and the
+     * offsets of the names are known.
+     */
+    for (i = 0 ; i < n ; ++i)
+	shentries[i].str = obj->secmap[i] ? sectionname(obj, i) : "";
+    for (i = 0 ; i < obj->symcount ; ++i)
+	symentries[i].str = i && obj->symmap[i] >= 0
+			? getobjstring(obj, obj->strtab, obj->syms[i].st_name)
+			: "";
+    if (!buildstrtable(&shnames, shentries, n)
+		|| !buildstrtable(&symnames, symentries, obj->symcount)) {
+	ok = err(obj->sf, "Out of memory!");
+	goto quit;
+    }
+
+    /* Fill in the new section headers.
+     */
+    for (i = 1, newn = 1 ; i < n && ok ; ++i) {
+	if (!(j = obj->secmap[i]))
 	    continue;
+	newn = j + 1;
+	shdr = newshdrs + j;
+	*shdr = obj->shdrs[i];
+	shdr->sh_name = shentries[i].off;
+	if (shdr->sh_link && shdr->sh_link < (unsigned)n)
+	    shdr->sh_link = obj->secmap[shdr->sh_link];
+	if (shdr->sh_type == SHT_GROUP)
+	    shdr->sh_info = obj->symmap[shdr->sh_info];
+	else if (shdr->sh_type == SHT_SYMTAB)
+	    shdr->sh_info = obj->newlocals;
+	else if ((shdr->sh_type == SHT_REL || shdr->sh_type == SHT_RELA
+				|| (shdr->sh_flags & SHF_INFO_LINK))
+			&& shdr->sh_info && shdr->sh_info < (unsigned)n)
+	    shdr->sh_info = obj->secmap[shdr->sh_info];
+	if (i == obj->symtab || shdr->sh_type == SHT_GROUP
+		|| ((shdr->sh_type == SHT_REL || shdr->sh_type == SHT_RELA)
+			&& (int)obj->shdrs[i].sh_link == obj->symtab)) {
+	    ok = buildsection(obj, i, symentries, bufs + i, &size);
+	    shdr->sh_size = size;
 	}
+    }
+    if (!ok) {
+	err(obj->sf, "invalid section contents.");
+	goto quit;
+    }
+    newshdrs[obj->secmap[obj->ehdr.e_shstrndx]].sh_size = shnames.size;
+    if (obj->strtab)
+	newshdrs[obj->secmap[obj->strtab]].sh_size = symnames.size;
 
-	if (!(readelfheader() &&
-	      readphdrtable() &&
-	      getmemorysize() &&
-	      truncatezeros() &&
-	      modifyheaders() &&
-	      commitchanges()))
-	    ++failures;
+    /* Lay out the sections, and then write everything out.
+     */
+    pos = obj->ehdr.e_ehsize;
+    for (j = 1 ; j < newn ; ++j) {
+	shdr = newshdrs + j;
+	align = shdr->sh_addralign > 1 ? shdr->sh_addralign : 1;
+	pos = (pos + align - 1) / align * align;
+	shdr->sh_offset = pos;
+	if (shdr->sh_type != SHT_NOBITS)
+	    pos += shdr->sh_size;
+    }
+    align = obj->ehdr.e_ident[EI_CLASS] == ELFCLASS64 ? 8 : 4;
+    ehdr = obj->ehdr;
+    ehdr.e_shoff = (pos + align - 1) / align * align;
+    ehdr.e_shnum = newn;
+    ehdr.e_shstrndx = obj->secmap[obj->ehdr.e_shstrndx];
 
-	fclose(thefile);
+    if (!(out = open_memstream(outbuf, outsize))) {
+	ok = err(obj->sf, strerror(errno));
+	goto quit;
+    }
+    ok = elfrw_write_Ehdr(out, &ehdr) == 1;
+    for (i = 1 ; i < n && ok ; ++i) {
+	if (!(j = obj->secmap[i]) || newshdrs[j].sh_type == SHT_NOBITS)
+	    continue;
+	shdr = newshdrs + j;
+	pos = ftell(out);
+	if (pos < shdr->sh_offset)
+	    ok = writezeros(out, shdr->sh_offset - pos);
+	if (!ok)
+	    break;
+	if (bufs[i])
+	    ok = !shdr->sh_size || fwrite(bufs[i], shdr->sh_size, 1, out) == 1;
+	else if (i == obj->ehdr.e_shstrndx)
+	    ok = fwrite(shnames.buf, shnames.size, 1, out) == 1;
+	else if (i == obj->strtab)
+	    ok = fwrite(symnames.buf, symnames.size, 1, out) == 1;
+	else
+	    ok = !shdr->sh_size || fwrite(obj->image + obj->shdrs[i].sh_offset,
+					  shdr->sh_size, 1, out) == 1;
     }
+    pos = ftell(out);
+    if (ok && pos < ehdr.e_shoff)
+	ok = writezeros(out, ehdr.e_shoff - pos);
+    if (ok)
+	ok = elfrw_write_Shdrs(out, newshdrs, newn) == newn;
+    if (fclose(out))
+	ok = FALSE;
+    if (!ok) {
+	free(*outbuf);
+	*outbuf = NULL;
+	err(obj->sf, "could not create the stripped object.");
+    }
+
+  quit:
+    for (i = 0 ; i < n ; ++i)
+	free(bufs[i]);
+    free(bufs);
+    free(newshdrs);
+    free(shentries);
+    free(symentries);
+    free(shnames.buf);
+    free(symnames.buf);
+    return ok;
+}
+
+/* stripobject() strips an ELF relocatable object held in memory. If
+ * the object can be made smaller, the new contents are returned in a
+ * newly allocated buffer; otherwise *outbuf is set to NULL.
+ */
+static int stripobject(sstripfile const *sf, unsigned char const *image,
+		       unsigned long size, char **outbuf, size_t *outsize)
+{
+    objfile	obj;
+    int		changed = FALSE;
+    int		ok;
+
+    memset(&obj, 0, sizeof obj);
+    obj.sf = sf;
+    obj.image = image;
+    obj.size = size;
+    *outbuf = NULL;
+    *outsize = 0;
+    ok = readobject(&obj) && planobject(&obj, &changed);
+    if (ok && changed)
+	ok = writeobject(&obj, outbuf, outsize);
+    if (*outbuf && *outsize >= size) {
+	free(*outbuf);
+	*outbuf = NULL;
+	*outsize = 0;
+    }
+    freeobject(&obj);
+    return ok;
+}
+
+/* A member of an archive being stripped.
+ */
+typedef struct armember {
+    struct ar_hdr const *hdr;	/* the member's original header */
+    unsigned long   oldpos;	/* the original position of the header */
+    unsigned long   newpos;	/* the new position of the header */
+    unsigned char const *data;	/* the member's original contents */
+    unsigned long   size;	/* the size of the original contents */
+    char	   *newdata;	/* the stripped contents, if any */
+    size_t	    newsize;	/* the size of the stripped contents */
+    int		    wordsize;	/* for the symbol index, its number size */
+} armember;
+
+/* getelftype() returns the file type from the start of an ELF file,
+ * or -1 if it is not an ELF file.
+ */
+static int getelftype(unsigned char const *id, unsigned long size)
+{
+    if (size < EI_NIDENT + 2 || memcmp(id, ELFMAG, SELFMAG))
+	return -1;
+    if (id[EI_DATA] == ELFDATA2MSB)
+	return (id[EI_NIDENT] << 8) | id[EI_NIDENT + 1];
+    else
+	return id[EI_NIDENT] | (id[EI_NIDENT + 1] << 8);
+}
+
+/* readarchive() divides an archive into its members, and strips every
+ * member that is a relocatable object. A member that cannot be
+ * stripped safely is quietly kept as it is. The return value is the
+ * number of members, or -1 on error.
+ */
+static int readarchive(sstripfile *sf, armember **pmembers)
+{
+    armember	   *members = NULL;
+    sstripfile	    membersf;
+    struct ar_hdr const *hdr;
+    unsigned long   pos, size;
+    int		    count = 0, alloc = 0, ok = TRUE;
+
+    for (pos = SARMAG ; pos < sf->size && ok ; pos += size + (size & 1)) {
+	hdr = (struct ar_hdr const*)(sf->image + pos);
+	if (pos + sizeof *hdr > sf->size
+			|| memcmp(hdr->ar_fmag, ARFMAG, sizeof hdr->ar_fmag)) {
+	    ok = err(sf, "invalid archive member header.");
+	    break;
+	}
+	size = strtoul(hdr->ar_size, NULL, 10);
+	if (size > sf->size - pos - sizeof *hdr) {
+	    ok = err(sf, "truncated archive member.");
+	    break;
+	}
+	if (!memcmp(hdr->ar_name, "#1/", 3)) {
+	    ok = err(sf, "BSD-style archives are not supported.");
+	    break;
+	}
+	if (count == alloc) {
+	    alloc = alloc ? 2 * alloc : 64;
+	    if (!(members = realloc(members, alloc * sizeof *members))) {
+		fputs("Out of memory!\n", stderr);
+		exit(EXIT_FAILURE);
+	    }
+	}
+	memset(members + count, 0, sizeof *members);
+	members[count].hdr = hdr;
+	members[count].oldpos = pos;
+	pos += sizeof *hdr;
+	members[count].data = sf->image + pos;
+	members[count].size = size;
+	if (!memcmp(hdr->ar_name, "/               ", 16))
+	    members[count].wordsize = 4;
+	else if (!memcmp(hdr->ar_name, "/SYM64/         ", 16))
+	    members[count].wordsize = 8;
+	else if (getelftype(sf->image + pos, size) == ET_REL) {
+	    membersf = *sf;
+	    membersf.quiet = TRUE;
+	    stripobject(&membersf, sf->image + pos, size,
+			&members[count].newdata, &members[count].newsize);
+	}
+	++count;
+    }
+
+    *pmembers = members;
+    return ok ? count : -1;
+}
+
+/* updatearmap() changes the member positions stored in an archive's
+ * symbol index to their new values. The symbols themselves do not
+ * change, since global symbols are never removed.
+ */
+static int updatearmap(sstripfile *sf, armember *members, int count,
+		       armember *armap)
+{
+    unsigned char  *map;
+    unsigned long   n, i, pos;
+    int		    w, lo, hi, mid;
+
+    w = armap->wordsize;
+    if (armap->size < (unsigned long)w)
+	return err(sf, "invalid archive symbol table.");
+    for (n = 0, i = 0 ; i < (unsigned long)w ; ++i)
+	n = (n << 8) | armap->data[i];
+    if (n > armap->size / w - 1)
+	return err(sf, "invalid archive symbol table.");
+    if (!(armap->newdata = malloc(armap->size)))
+	return err(sf, "Out of memory!");
+    memcpy(armap->newdata, armap->data, armap->size);
+    armap->newsize = armap->size;
+
+    map = (unsigned char*)armap->newdata + w;
+    for ( ; n ; --n, map += w) {
+	for (pos = 0, i = 0 ; i < (unsigned long)w ; ++i)
+	    pos = (pos << 8) | map[i];
+	for (lo = 0, hi = count ; lo < hi ; ) {
+	    mid = (lo + hi) / 2;
+	    if (members[mid].oldpos < pos)
+		lo = mid + 1;
+	    else
+		hi = mid;
+	}
+	if (lo == count || members[lo].oldpos != pos)
+	    return err(sf, "invalid archive symbol table.");
+	pos = members[lo].newpos;
+	for (i = w ; i-- ; pos >>= 8)
+	    map[i] = pos & 0xFF;
+    }
+    return TRUE;
+}
+
+/* writearchive() writes out the new archive to a temporary file that
+ * then replaces the original.
+ */
+static int writearchive(sstripfile *sf, armember *members, int count)
+{
+    struct ar_hdr   hdr;
+    char	   *path, *tmpname;
+    char	    sizefield[sizeof hdr.ar_size + 1];
+    FILE	   *fp;
+    unsigned long   size;
+    int		    fd, i, ok;
+
+    if ((fd = opentemp(sf, &path, &tmpname)) < 0)
+	return FALSE;
+    if (!(fp = fdopen(dup(fd), "wb"))) {
+	err(sf, strerror(errno));
+	return closetemp(sf, fd, path, tmpname, FALSE);
+    }
+    ok = fwrite(ARMAG, SARMAG, 1, fp) == 1;
+    for (i = 0 ; i < count && ok ; ++i) {
+	size = members[i].newdata ? members[i].newsize : members[i].size;
+	hdr = *members[i].hdr;
+	sprintf(sizefield, "%-*lu", (int)sizeof hdr.ar_size, size);
+	memcpy(hdr.ar_size, sizefield, sizeof hdr.ar_size);
+	ok = fwrite(&hdr, sizeof hdr, 1, fp) == 1
+	  && fwrite(members[i].newdata ? (void const*)members[i].newdata
+				       : (void const*)members[i].data,
+		    size, 1, fp) == 1
+	  && (!(size & 1) || fputc('\n', fp) != EOF);
+    }
+    if (fclose(fp) || !ok) {
+	err(sf, errno ? strerror(errno) : "could not write to file");
+	ok = FALSE;
+    }
+    return closetemp(sf, fd, path, tmpname, ok);
+}
+
+/* striparchive() strips each relocatable object in a static archive,
+ * and then rewrites the archive with the member positions in its
+ * symbol index updated.
+ */
+static int striparchive(sstripfile *sf, progress *prog)
+{
+    armember	   *members = NULL;
+    unsigned long   pos;
+    int		    count, i, ok = TRUE;
+
+    if ((count = readarchive(sf, &members)) < 0) {
+	ok = FALSE;
+	goto quit;
+    }
+    for (pos = SARMAG, i = 0 ; i < count ; ++i) {
+	if (members[i].newdata)
+	    sf->changed = TRUE;
+	members[i].newpos = pos;
+	pos += sizeof(struct ar_hdr);
+	pos += members[i].newdata ? members[i].newsize : members[i].size;
+	pos += pos & 1;
+    }
+    sf->newsize = pos;
+    if (!sf->changed)
+	sf->newsize = sf->size;
+    else
+	for (i = 0 ; i < count && ok ; ++i)
+	    if (members[i].wordsize)
+		ok = updatearmap(sf, members, count, members + i);
+
+    if (ok && dryrun)
+	ok = reportchanges(sf, prog);
+    else if (ok && sf->changed)
+	ok = writearchive(sf, members, count);
+
+  quit:
+    for (i = 0 ; i < count ; ++i)
+	free(members[i].newdata);
+    free(members);
+    return ok;
+}
+
+/* stripobjects() strips a relocatable object or a static archive,
+ * which is written out as a new file replacing the original.
+ */
+static int stripobjects(sstripfile *sf, progress *prog)
+{
+    char   *buf, *path, *tmpname;
+    size_t  size;
+    int	    fd, ok;
+
+    if (sf->size >= SARMAG && !memcmp(sf->image, ARMAG, SARMAG))
+	return striparchive(sf, prog);
+
+    if (!stripobject(sf, sf->image, sf->size, &buf, &size))
+	return FALSE;
+    sf->newsize = buf ? size : sf->size;
+    sf->changed = buf != NULL;
+    if (dryrun) {
+	ok = reportchanges(sf, prog);
+    } else if (buf) {
+	if ((fd = opentemp(sf, &path, &tmpname)) < 0) {
+	    ok = FALSE;
+	} else {
+	    ok = writeall(fd, buf, size) || err(sf, strerror(errno));
+	    ok = closetemp(sf, fd, path, tmpname, ok);
+	}
+    } else {
+	ok = TRUE;
+    }
+    free(buf);
+    return ok;
+}
+
+/* isstrippable() checks the beginning of a file to see if it is an
+ * ELF executable or shared-object library (or, if requested, an
+ * object file or archive), without opening it for writing.
+ */
+static int isstrippable(char const *filename)
+{
+    unsigned char   id[EI_NIDENT + 2];
+    int		    fd, n, type;
+
+    if ((fd = open(filename, O_RDONLY)) < 0)
+	return FALSE;
+    n = read(fd, id, sizeof id);
+    close(fd);
+    if (n < 0)
+	return FALSE;
+    if (doobjects && n >= SARMAG && !memcmp(id, ARMAG, SARMAG))
+	return TRUE;
+    type = getelftype(id, n);
+    return type == ET_EXEC || type == ET_DYN
+			   || (doobjects && type == ET_REL);
+}
+
+/* stripfile() strips one file, returning FALSE if the file could not
+ * be stripped.
+ */
+static int stripfile(workitem const *item, progress *prog)
+{
+    sstripfile	sf;
+    int		r;
+
+    if (item->found && !isstrippable(item->filename))
+	return TRUE;
+    memset(&sf, 0, sizeof sf);
+    sf.filename = item->filename;
+    if (!openfile(&sf))
+	return FALSE;
+    if (doobjects && ((sf.size >= SARMAG && !memcmp(sf.image, ARMAG, SARMAG))
+			|| getelftype(sf.image, sf.size) == ET_REL)) {
+	r = stripobjects(&sf, prog);
+	closefile(&sf);
+	return r;
+    }
+    r = readelfheader(&sf) &&
+	readphdrtable(&sf) &&
+	getmemorysize(&sf) &&
+	compactsegments(&sf) &&
+	truncatezeros(&sf) &&
+	modifyheaders(&sf) &&
+	(dryrun ? reportchanges(&sf, prog)
+		: movesegments(&sf) && commitchanges(&sf));
+    closefile(&sf);
+    free(sf.phdrs);
+    free(sf.moves);
+    return r;
+}
+
+/* addwork() appends a file to the list of files to strip.
+ */
+static void addwork(char const *filename, struct stat const *st, int found)
+{
+    workitem *item;
+
+    if (workcount == workalloc) {
+	workalloc = workalloc ? 2 * workalloc : 256;
+	if (!(worklist = realloc(worklist, workalloc * sizeof *worklist))) {
+	    fputs("Out of memory!\n", stderr);
+	    exit(EXIT_FAILURE);
+	}
+    }
+    item = worklist + workcount++;
+    if (!(item->filename = strdup(filename))) {
+	fputs("Out of memory!\n", stderr);
+	exit(EXIT_FAILURE);
+    }
+    item->dev = st ? st->st_dev : 0;
+    item->ino = st ? st->st_ino : 0;
+    item->index = workcount - 1;
+    item->found = found;
+}
+
+/* addfoundfile() is called by nftw() for each entry in a directory
+ * tree being searched. Only regular files are added.
+ */
+static int addfoundfile(char const *filename, struct stat const *st,
+			int type, struct FTW *ftw)
+{
+    (void)ftw;
+    if (type == FTW_F && S_ISREG(st->st_mode))
+	addwork(filename, st, TRUE);
+    else if (type == FTW_DNR || type == FTW_NS)
+	fprintf(stderr, "%s: %s: %s\n", theprogram, filename, strerror(errno));
+    return 0;
+}
+
+/* workitemsorter() is passed to qsort() to sort the list of files so
+ * that multiple links to the same file are adjacent, in the order
+ * that they were added to the list.
+ */
+static int workitemsorter(void const *a, void const *b)
+{
+    workitem const *item1 = a;
+    workitem const *item2 = b;
+
+    if (item1->dev != item2->dev)
+	return item1->dev < item2->dev ? -1 : 1;
+    if (item1->ino != item2->ino)
+	return item1->ino < item2->ino ? -1 : 1;
+    return item1->index < item2->index ? -1 : item1->index > item2->index;
+}
+
+/* workorderer() is passed to qsort() to restore the list of files to
+ * the order that they were added in.
+ */
+static int workorderer(void const *a, void const *b)
+{
+    workitem const *item1 = a;
+    workitem const *item2 = b;
+
+    return item1->index < item2->index ? -1 : item1->index > item2->index;
+}
+
+/* removeduplicates() removes repeated links to the same file from the
+ * list, so that no two workers can ever strip the same file at once,
+ * and so that a dry run counts each file only once.
+ * The first name given for each file is the one kept, and the files
+ * are otherwise left in their original order.
+ */
+static void removeduplicates(void)
+{
+    unsigned long i, n;
+
+    qsort(worklist, workcount, sizeof *worklist, workitemsorter);
+    for (i = n = 0 ; i < workcount ; ++i) {
+	if (n && worklist[i].ino && worklist[i].dev == worklist[n - 1].dev
+				 && worklist[i].ino == worklist[n - 1].ino) {
+	    free(worklist[i].filename);
+	    continue;
+	}
+	worklist[n++] = worklist[i];
+    }
+    workcount = n;
+    qsort(worklist, workcount, sizeof *worklist, workorderer);
+}
+
+/* runworker() strips files from the list until there are none left.
+ * The files are claimed one at a time, so that a few large files do
+ * not leave the other workers idle.
+ */
+static void runworker(progress *prog)
+{
+    unsigned long i;
+
+    for (;;) {
+	i = __atomic_fetch_add(&prog->next, 1, __ATOMIC_RELAXED);
+	if (i >= workcount)
+	    break;
+	if (stripfile(worklist + i, prog))
+	    __atomic_fetch_add(&prog->stripped, 1, __ATOMIC_RELAXED);
+	else
+	    __atomic_fetch_add(&prog->failed, 1, __ATOMIC_RELAXED);
+    }
+}
+
+/* runworkers() strips all the files in the list, using jobcount
+ * processes. (Separate processes are used instead of threads, since
+ * the elfrw functions keep per-file state in global variables.) The
+ * final tallies are copied into local, and the return value is the
+ * number of files that could not be stripped.
+ */
+static unsigned long runworkers(progress *local)
+{
+    progress	   *prog;
+    pid_t	    pid;
+    int		    status, i;
+
+    memset(local, 0, sizeof *local);
+    if (jobcount > 1 && (unsigned long)jobcount > workcount)
+	jobcount = workcount;
+    if (jobcount <= 1) {
+	runworker(local);
+	return local->failed;
+    }
+
+    prog = mmap(NULL, sizeof *prog, PROT_READ | PROT_WRITE,
+		MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (prog == MAP_FAILED) {
+	perror(theprogram);
+	exit(EXIT_FAILURE);
+    }
+    memset(prog, 0, sizeof *prog);
+    fflush(stdout);
+    fflush(stderr);
+    for (i = 0 ; i < jobcount ; ++i) {
+	pid = fork();
+	if (pid < 0) {
+	    perror(theprogram);
+	    break;
+	}
+	if (pid == 0) {
+	    runworker(prog);
+	    _exit(EXIT_SUCCESS);
+	}
+    }
+    if (i == 0)
+	runworker(prog);
+
+    /* A worker that dies abnormally may leave the file it was working
+     * on unaccounted for. Such files are counted as failures below, so
+     * that each one is only counted once.
+     */
+    while (wait(&status) > 0) {
+	if (!WIFEXITED(status) || WEXITSTATUS(status))
+	    fprintf(stderr, "%s: a worker process failed.\n", theprogram);
+    }
+    if (prog->stripped + prog->failed < workcount)
+	prog->failed = workcount - prog->stripped;
+    *local = *prog;
+    munmap(prog, sizeof *prog);
+    return local->failed;
+}
+
+/* main() builds the list of files to strip, and then hands them out
+ * to the workers.
+ */
+int main(int argc, char *argv[])
+{
+    struct stat	    st;
+    progress	    prog;
+    unsigned long   failures = 0;
+    int		    i;
+
+    readcmdline(argc, argv);
+
+    if (optind < argc && !strcmp(argv[optind], "-")) {
+	if (optind + 1 < argc) {
+	    fprintf(stderr, "%s: - cannot be combined with other files.\n",
+		    theprogram);
+	    return EXIT_FAILURE;
+	}
+	if (dryrun || compact) {
+	    fprintf(stderr, "%s: - cannot be used with --%s.\n",
+		    theprogram, dryrun ? "dry-run" : "aggressive");
+	    return EXIT_FAILURE;
+	}
+	return stripstream() ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    for (i = optind ; i < argc ; ++i) {
+	if (stat(argv[i], &st)) {
+	    addwork(argv[i], NULL, FALSE);
+	} else if (recurse && S_ISDIR(st.st_mode)) {
+	    if (nftw(argv[i], addfoundfile, 16, FTW_PHYS)) {
+		fprintf(stderr, "%s: %s: %s\n",
+			theprogram, argv[i], strerror(errno));
+		++failures;
+	    }
+	} else {
+	    addwork(argv[i], &st, FALSE);
+	}
+    }
+    removeduplicates();
+
+    failures += runworkers(&prog);
+    if (dryrun)
+	printf("%lu\t%lu\t%ld\t%lu\ttotal\n", prog.oldbytes, prog.newbytes,
+	       (long)(prog.oldbytes - prog.newbytes), prog.modified);
+    if (failures && (recurse || jobcount > 1))
+	fprintf(stderr, "%s: %lu of %lu files could not be stripped.\n",
+		theprogram, failures, workcount);
 
     return failures ? EXIT_FAILURE : EXIT_SUCCESS;
 }